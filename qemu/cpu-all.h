@@ -545,6 +545,7 @@ extern int mem_prealloc;
 
 #define VGA_DIRTY_FLAG       0x01
 #define CODE_DIRTY_FLAG      0x02
+#define PANDA_DIRTY_FLAG     0x04
 #define MIGRATION_DIRTY_FLAG 0x08
 
 /* read dirty bit (return 0 or 1) */
@@ -608,6 +609,8 @@ int cpu_physical_log_stop(target_phys_addr_t start_addr,
                           ram_addr_t size);
 
 void dump_exec_info(FILE *f, fprintf_function cpu_fprintf);
+void tb_dump_cache_info(FILE *f, fprintf_function cpu_fprintf);
+void panda_vtlb_dump_info(FILE *f, fprintf_function cpu_fprintf);
 #endif /* !CONFIG_USER_ONLY */
 
 int cpu_memory_rw_debug(CPUState *env, target_ulong addr,
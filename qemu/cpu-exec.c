@@ -124,6 +124,21 @@ static void cpu_exec_nocache(CPUState *env, int max_cycles,
     tb_free(tb);
 }
 
+#if defined(CONFIG_LLVM)
+/* With LLVM on, a block runs under LLVM unless plugins registered
+   before_block_exec_llvm_opt callbacks and none of them want it to. */
+static inline bool panda_block_wants_llvm(CPUState *env, TranslationBlock *tb)
+{
+    panda_cb_list *plist = panda_cbs[PANDA_CB_BEFORE_BLOCK_EXEC_LLVM_OPT];
+    bool want_llvm = (plist == NULL);
+
+    for(; plist != NULL; plist = plist->next) {
+        want_llvm |= plist->entry.before_block_exec_llvm_opt(env, tb);
+    }
+    return want_llvm;
+}
+#endif
+
 static TranslationBlock *tb_find_slow(CPUState *env,
                                       target_ulong pc,
                                       target_ulong cs_base,
@@ -234,6 +249,76 @@ static void cpu_handle_debug_exception(CPUState *env)
 
 
 
+#if defined(CONFIG_LLVM)
+/* Set when an LLVM trace has stopped at a boundary, after running the
+   after_block_exec callbacks for the TB it stopped after */
+static bool llvm_trace_ran_after_cbs = false;
+
+/* Called by an LLVM trace (see tcg-llvm.h) after its i'th TB, with the
+   value that TB returned, in place of a trip around the cpu_exec loop.
+   Runs the callbacks for the end of that TB and the start of the next one
+   and returns 1 if the loop would have run the trace's next TB straight
+   away. Otherwise returns 0, and the trace returns to cpu_exec, which
+   carries on from the TB that just ran. */
+uintptr_t cpu_llvm_trace_boundary(struct TCGLLVMTrace *trace, uintptr_t i,
+                                  uintptr_t next_tb)
+{
+    CPUState *env = cpu_single_env;
+    TranslationBlock *tb = trace->tbs[i], *next = trace->tbs[i + 1];
+    target_ulong cs_base, pc;
+    int flags;
+    panda_cb_list *plist;
+
+    for(plist = panda_cbs[PANDA_CB_AFTER_BLOCK_EXEC]; plist != NULL; plist = plist->next) {
+        plist->entry.after_block_exec(env, tb, (TranslationBlock *)(next_tb & ~3));
+    }
+    llvm_trace_ran_after_cbs = true;
+
+    /* instruction counter expired, or something else for the loop */
+    if ((next_tb & 3) == 2 || env->exit_request || tb_invalidated_flag ||
+        panda_plugin_to_unload || panda_please_flush_tb ||
+        panda_please_invalidate_tb ||
+        panda_please_disable_llvm || !execute_llvm ||
+        panda_cbs[PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT] ||
+        panda_cbs[PANDA_CB_BEFORE_BLOCK_EXEC_LLVM_OPT] ||
+        qemu_loglevel_mask(CPU_LOG_TB_CPU | CPU_LOG_EXEC | CPU_LOG_RR)) {
+        return 0;
+    }
+
+    /* the loop finds next in tb_jmp_cache (invalidating a TB takes it
+       out); anything else is left to tb_find_slow */
+    cpu_get_tb_cpu_state(env, &pc, &cs_base, &flags);
+    if (env->tb_jmp_cache[tb_jmp_cache_hash_func(pc)] != next ||
+        next->pc != pc || next->cs_base != cs_base || next->flags != flags) {
+        return 0;
+    }
+
+    rr_set_program_point();
+    if (rr_in_replay()) {
+        /* with nothing logged before the end of next, the loop would
+           replay no calls and set interrupt_request to 0 */
+        if (rr_replay_finished() ||
+            rr_num_instr_before_next_interrupt == 0 ||
+            next->num_guest_insns > rr_num_instr_before_next_interrupt) {
+            return 0;
+        }
+        env->interrupt_request = 0;
+    } else if (env->interrupt_request) {
+        return 0;
+    }
+
+    env->current_tb = next;
+    tcg_llvm_runtime.last_tb = next;
+    llvm_trace_ran_after_cbs = false;
+
+    for(plist = panda_cbs[PANDA_CB_BEFORE_BLOCK_EXEC];
+            plist != NULL; plist = plist->next) {
+        plist->entry.before_block_exec(env, next);
+    }
+    return 1;
+}
+#endif
+
 void rr_set_program_point(void) {
     if (cpu_single_env) {
 #if defined( TARGET_I386 )
@@ -268,6 +353,7 @@ int cpu_exec(CPUState *env)
     TranslationBlock *tb;
     uint8_t *tc_ptr;
     unsigned long next_tb;
+    bool prev_block_in_llvm = false;
 
     RR_prog_point saved_prog_point = rr_prog_point;
     int rr_loop_tries = 20;
@@ -701,10 +787,21 @@ int cpu_exec(CPUState *env)
                     }
                 }
 
+#if defined(CONFIG_LLVM)
+                if (panda_please_disable_llvm) {
+                    panda_do_disable_llvm();
+                    tb_invalidated_flag = 1;
+                }
+#endif
+
                 if(panda_flush_tb()) {
                     tb_flush(env);
                     tb_invalidated_flag = 1;
                 }
+                else if(panda_please_invalidate_tb) {
+                    panda_invalidate_tb();
+                    tb_invalidated_flag = 1;
+                }
 
                 spin_lock(&tb_lock);
 
@@ -749,6 +846,15 @@ int cpu_exec(CPUState *env)
                 }
 #endif //CONFIG_SOFTMMU
 
+#if defined(CONFIG_LLVM)
+                // PANDA: pick the backend for this block. TCG and LLVM
+                // code both keep the CPU state in env between blocks, so
+                // switching from one to the other needs nothing else.
+                prev_block_in_llvm = panda_block_in_llvm;
+                panda_block_in_llvm = execute_llvm &&
+                    panda_block_wants_llvm(env, tb);
+#endif
+
 #ifdef CONFIG_DEBUG_EXEC
                 qemu_log_mask(CPU_LOG_EXEC, "Trace 0x%08lx [" TARGET_FMT_lx "] %s\n",
                              (long)tb->tc_ptr, tb->pc,
@@ -761,7 +867,10 @@ int cpu_exec(CPUState *env)
                 // (T0 & ~3) contains pointer to previous translation block.
                 // (T0 & 3) contains info about which branch we took (why 2 bits?)
                 // tb is current translation block.  
-                if ((rr_mode != RR_REPLAY) && (panda_tb_chaining == true)){
+                // LLVM code is never chained, so only link TCG blocks
+                // to TCG blocks.
+                if ((rr_mode != RR_REPLAY) && (panda_tb_chaining == true)
+                        && !prev_block_in_llvm && !panda_block_in_llvm){
                     if (next_tb != 0 && tb->page_addr[1] == -1) {
                         tb_add_jump((TranslationBlock *)(next_tb & ~3), next_tb & 3, tb);
                     }
@@ -815,6 +924,20 @@ int cpu_exec(CPUState *env)
                     //mz Actually jump into the generated code
                     /* execute the generated code */
 
+#if defined(CONFIG_LLVM)
+                    /* LLVM code is only generated for TBs that run */
+                    if(panda_block_in_llvm && !tb->llvm_function) {
+                        cpu_gen_llvm(env, tb);
+                    }
+                    /* With -llvm-async it may still be compiling (or not
+                       even lowered, if the compile thread was busy), so run
+                       the TCG code in the meantime */
+                    if(panda_block_in_llvm && !tb->llvm_tc_ptr) {
+                        panda_block_in_llvm = false;
+                        llvm_tbs_pending_execs++;
+                    }
+#endif
+
                     // PANDA instrumentation: before basic block exec
                     for(plist = panda_cbs[PANDA_CB_BEFORE_BLOCK_EXEC];
                             plist != NULL; plist = plist->next) {
@@ -822,17 +945,27 @@ int cpu_exec(CPUState *env)
                     }
 
 #if defined(CONFIG_LLVM)
-                    if(execute_llvm) {
+                    if(panda_block_in_llvm) {
                         assert(tb->llvm_tc_ptr);
                         next_tb = tcg_llvm_qemu_tb_exec(env, tb);
+                        /* a trace may have run more TBs after this one */
+                        tb = tcg_llvm_runtime.last_tb;
                     } else {
                         assert(tc_ptr);
+                        /* so cpu_restore_state knows this TB ran under TCG */
+                        tcg_llvm_runtime.last_tb = NULL;
                         next_tb = tcg_qemu_tb_exec(env, tc_ptr);
                     }
 #else
                     next_tb = tcg_qemu_tb_exec(env, tc_ptr);
 #endif
 
+#if defined(CONFIG_LLVM)
+                    /* a trace that stopped at a boundary already ran them */
+                    if (llvm_trace_ran_after_cbs) {
+                        llvm_trace_ran_after_cbs = false;
+                    } else
+#endif
                     for(plist = panda_cbs[PANDA_CB_AFTER_BLOCK_EXEC]; plist != NULL; plist = plist->next) {
                         plist->entry.after_block_exec(env, tb, (TranslationBlock *)(next_tb & ~3));
                     }
@@ -99,6 +99,9 @@ int cpu_gen_code(CPUState *env, struct TranslationBlock *tb,
                  int *gen_code_size_ptr);
 int cpu_restore_state(struct TranslationBlock *tb,
                       CPUState *env, unsigned long searched_pc);
+#ifdef CONFIG_LLVM
+int cpu_gen_llvm(CPUState *env, struct TranslationBlock *tb);
+#endif
 void cpu_resume_from_signal(CPUState *env1, void *puc);
 void cpu_io_recompile(CPUState *env, void *retaddr);
 TranslationBlock *tb_gen_code(CPUState *env, 
@@ -194,6 +197,20 @@ struct TranslationBlock {
     uint8_t *llvm_tc_ptr;
     uint8_t *llvm_tc_end;
     struct TranslationBlock* llvm_tb_next[2];
+    /* optimization tier of the LLVM code, and how many times and for how
+       long it has run at tier 0 */
+    uint8_t llvm_tier;
+    uint64_t llvm_exec_count;
+    uint64_t llvm_exec_ns;
+    /* the LLVM TB that last ran after this one, and how many times in a
+       row it did, and the trace starting here (see tcg-llvm.h) */
+    struct TranslationBlock *llvm_succ;
+    uint32_t llvm_succ_count;
+    struct TCGLLVMTrace *llvm_trace;
+    /* estimated size of the IR, and when the TB last ran under LLVM (see
+       llvm_mem_limit) */
+    uint32_t llvm_ir_bytes;
+    uint64_t llvm_last_use;
 #endif
 
 };
@@ -223,6 +240,10 @@ void tb_flush(CPUState *env);
 void tb_link_page(TranslationBlock *tb,
                   tb_page_addr_t phys_pc, tb_page_addr_t phys_page2);
 void tb_phys_invalidate(TranslationBlock *tb, tb_page_addr_t page_addr);
+int tb_invalidate_virt_range(target_ulong start, target_ulong end);
+
+/* number of regions the code buffer is split into (-tb-regions) */
+extern int tb_regions;
 
 extern TranslationBlock *tb_phys_hash[CODE_GEN_PHYS_HASH_SIZE];
 
@@ -434,4 +455,14 @@ extern int generate_llvm;
 extern int execute_llvm;
 extern const int has_llvm_engine;
 
+#ifdef CONFIG_LLVM
+/* TBs translated while generate_llvm was set, and how many of them
+   were lowered to LLVM */
+extern uint64_t llvm_tbs_translated;
+extern uint64_t llvm_tbs_lowered;
+/* Executions of TBs chosen for LLVM that ran under TCG because their LLVM
+   code wasn't ready yet (see llvm_async_compile) */
+extern uint64_t llvm_tbs_pending_execs;
+#endif
+
 #endif
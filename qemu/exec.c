@@ -73,11 +73,22 @@
 
 #include "rr_log.h"
 #include "panda_plugin.h"
+#include "bitops.h"
 
 #ifdef CONFIG_LLVM
 //#include "tcg-llvm.h"
 void tcg_llvm_tb_alloc(TranslationBlock *tb);
 void tcg_llvm_tb_free(struct TranslationBlock *tb);
+void tcg_llvm_tb_evict(struct TranslationBlock *begin,
+                       struct TranslationBlock *end);
+extern uint64_t llvm_opt_threshold;
+extern int llvm_async_compile;
+extern uint64_t llvm_trace_threshold;
+void tcg_llvm_dump_tier_stats(FILE *f, fprintf_function cpu_fprintf);
+void tcg_llvm_dump_trace_stats(FILE *f, fprintf_function cpu_fprintf);
+void tcg_llvm_dump_mem_stats(FILE *f, fprintf_function cpu_fprintf);
+extern uint64_t llvm_inline_threshold;
+void dump_llvm_helper_inline_stats(FILE *f, fprintf_function cpu_fprintf);
 #endif
 
 //#define DEBUG_TB_INVALIDATE
@@ -102,7 +113,6 @@ void tcg_llvm_tb_free(struct TranslationBlock *tb);
 static TranslationBlock *tbs;
 static int code_gen_max_blocks;
 TranslationBlock *tb_phys_hash[CODE_GEN_PHYS_HASH_SIZE];
-static int nb_tbs;
 /* any access to the tbs or the page table must use this lock */
 spinlock_t tb_lock = SPIN_LOCK_UNLOCKED;
 
@@ -125,9 +135,29 @@ spinlock_t tb_lock = SPIN_LOCK_UNLOCKED;
 uint8_t code_gen_prologue[1024] code_gen_section;
 static uint8_t *code_gen_buffer;
 static unsigned long code_gen_buffer_size;
-/* threshold to flush the translated code buffer */
-static unsigned long code_gen_buffer_max_size;
-static uint8_t *code_gen_ptr;
+
+/* The code buffer and the TB array are split into regions that are filled
+   in turn. When the last one is full, the TBs of the oldest region are
+   invalidated and its space reused, so only one generation of translations
+   is lost instead of the whole cache. With a single region, running out of
+   space flushes everything as before. */
+#define CODE_GEN_MAX_REGIONS 64
+
+typedef struct CodeGenRegion {
+    uint8_t *start;
+    uint8_t *end;           /* threshold to move on to the next region */
+    uint8_t *ptr;           /* where the code of the next TB goes */
+    TranslationBlock *tbs;  /* the region's TBs, in code order */
+    int nb_tbs;
+} CodeGenRegion;
+
+int tb_regions = 8;
+static CodeGenRegion code_gen_regions[CODE_GEN_MAX_REGIONS];
+static int code_gen_nb_regions;
+static unsigned long code_gen_region_size;
+static int code_gen_region_max_blocks;
+/* the region TBs are being generated in; the next one holds the oldest */
+static int cur_region;
 
 #if !defined(CONFIG_USER_ONLY)
 int phys_ram_fd;
@@ -248,6 +278,15 @@ static int tlb_flush_count;
 #endif
 static int tb_flush_count;
 static int tb_phys_invalidate_count;
+static int tb_region_evict_count;
+static int tb_evict_count;
+static int tb_virt_invalidate_count;
+static int64_t tb_translate_count;
+static int64_t tb_retranslate_count;
+static int64_t tb_stats_start;
+/* physical hash buckets that lost a TB, so that translating code there
+   again can be counted as a retranslation */
+static unsigned long tb_discarded[BITS_TO_LONGS(CODE_GEN_PHYS_HASH_SIZE)];
 
 #ifdef _WIN32
 static void map_exec(void *addr, long size)
@@ -579,12 +618,40 @@ static void code_gen_alloc(unsigned long tb_size)
 #endif
 #endif /* !USE_STATIC_CODE_GEN_BUFFER */
     map_exec(code_gen_prologue, sizeof(code_gen_prologue));
-    code_gen_buffer_max_size = code_gen_buffer_size -
-        (TCG_MAX_OP_SIZE * OPC_BUF_SIZE);
     code_gen_max_blocks = code_gen_buffer_size / CODE_GEN_AVG_BLOCK_SIZE;
     tbs = g_malloc(code_gen_max_blocks * sizeof(TranslationBlock));
 }
 
+/* Split the code buffer and the TB array into tb_regions regions, or fewer
+   if the buffer is too small for each of them to hold several worst case
+   TBs. */
+static void code_gen_regions_init(void)
+{
+    unsigned long reserve = TCG_MAX_OP_SIZE * OPC_BUF_SIZE;
+    CodeGenRegion *r;
+    int i, n;
+
+    n = tb_regions;
+    if (n > CODE_GEN_MAX_REGIONS)
+        n = CODE_GEN_MAX_REGIONS;
+    if (n > code_gen_buffer_size / (4 * reserve))
+        n = code_gen_buffer_size / (4 * reserve);
+    if (n < 1)
+        n = 1;
+    code_gen_nb_regions = n;
+    code_gen_region_size = (code_gen_buffer_size / n) & ~(CODE_GEN_ALIGN - 1);
+    code_gen_region_max_blocks = code_gen_max_blocks / n;
+    for (i = 0; i < n; i++) {
+        r = &code_gen_regions[i];
+        r->start = code_gen_buffer + i * code_gen_region_size;
+        r->end = r->start + code_gen_region_size - reserve;
+        r->ptr = r->start;
+        r->tbs = tbs + i * code_gen_region_max_blocks;
+        r->nb_tbs = 0;
+    }
+    cur_region = 0;
+}
+
 /* Must be called before using the QEMU cpus. 'tb_size' is the size
    (in bytes) allocated to the translation buffer. Zero means default
    size. */
@@ -592,7 +659,8 @@ void tcg_exec_init(unsigned long tb_size)
 {
     cpu_gen_init();
     code_gen_alloc(tb_size);
-    code_gen_ptr = code_gen_buffer;
+    code_gen_regions_init();
+    tb_stats_start = get_clock_realtime();
     page_init();
 #if !defined(CONFIG_USER_ONLY) || !defined(CONFIG_USE_GUEST_BASE)
     /* There's no guest base to take into account, so go ahead and
@@ -692,12 +760,12 @@ void cpu_exec_init(CPUState *env)
    too many translation blocks or too much generated code. */
 static TranslationBlock *tb_alloc(target_ulong pc)
 {
+    CodeGenRegion *r = &code_gen_regions[cur_region];
     TranslationBlock *tb;
 
-    if (nb_tbs >= code_gen_max_blocks ||
-        (code_gen_ptr - code_gen_buffer) >= code_gen_buffer_max_size)
+    if (r->nb_tbs >= code_gen_region_max_blocks || r->ptr >= r->end)
         return NULL;
-    tb = &tbs[nb_tbs++];
+    tb = &r->tbs[r->nb_tbs++];
     tb->pc = pc;
     tb->cflags = 0;
 
@@ -710,19 +778,43 @@ static TranslationBlock *tb_alloc(target_ulong pc)
 
 void tb_free(TranslationBlock *tb)
 {
+    CodeGenRegion *r = &code_gen_regions[cur_region];
+
     printf("Calling tb_free on TB %p PC=0x" TARGET_FMT_lx "\n", tb, tb->pc);
     /* In practice this is mostly used for single use temporary TB
        Ignore the hard cases and just back up if this TB happens to
        be the last one generated.  */
-    if (nb_tbs > 0 && tb == &tbs[nb_tbs - 1]) {
-        code_gen_ptr = tb->tc_ptr;
+    if (r->nb_tbs > 0 && tb == &r->tbs[r->nb_tbs - 1]) {
+        r->ptr = tb->tc_ptr;
 
 #if defined(CONFIG_LLVM)
         tcg_llvm_tb_free(tb);
 #endif
 
-        nb_tbs--;
+        r->nb_tbs--;
+    }
+}
+
+/* number of TBs and bytes of code in all the regions */
+static inline int tb_count(void)
+{
+    int i, n = 0;
+
+    for (i = 0; i < code_gen_nb_regions; i++) {
+        n += code_gen_regions[i].nb_tbs;
     }
+    return n;
+}
+
+static inline unsigned long code_gen_used(void)
+{
+    unsigned long used = 0;
+    int i;
+
+    for (i = 0; i < code_gen_nb_regions; i++) {
+        used += code_gen_regions[i].ptr - code_gen_regions[i].start;
+    }
+    return used;
 }
 
 static inline void invalidate_page_bitmap(PageDesc *p)
@@ -770,32 +862,46 @@ static void page_flush_tb(void)
 void tb_flush(CPUState *env1)
 {
     CPUState *env;
+    CodeGenRegion *r;
+    int i;
 #if defined(DEBUG_FLUSH)
     printf("qemu: flush code_size=%ld nb_tbs=%d avg_tb_size=%ld\n",
-           (unsigned long)(code_gen_ptr - code_gen_buffer),
-           nb_tbs, nb_tbs > 0 ?
-           ((unsigned long)(code_gen_ptr - code_gen_buffer)) / nb_tbs : 0);
+           code_gen_used(), tb_count(), tb_count() > 0 ?
+           code_gen_used() / tb_count() : 0);
 #endif
-    if ((unsigned long)(code_gen_ptr - code_gen_buffer) > code_gen_buffer_size)
-        cpu_abort(env1, "Internal error: code buffer overflow\n");
+    for (i = 0; i < code_gen_nb_regions; i++) {
+        r = &code_gen_regions[i];
+        if ((unsigned long)(r->ptr - r->start) > code_gen_region_size)
+            cpu_abort(env1, "Internal error: code buffer overflow\n");
+    }
 
 #if defined(CONFIG_LLVM)
     int i2;
-    for(i2 = 0; i2 < nb_tbs; ++i2){
-        tcg_llvm_tb_free(&tbs[i2]);
+    for (i = 0; i < code_gen_nb_regions; i++) {
+        r = &code_gen_regions[i];
+        for(i2 = 0; i2 < r->nb_tbs; ++i2){
+            tcg_llvm_tb_free(&r->tbs[i2]);
+        }
     }
 #endif
 
-    nb_tbs = 0;
-
     for(env = first_cpu; env != NULL; env = env->next_cpu) {
         memset (env->tb_jmp_cache, 0, TB_JMP_CACHE_SIZE * sizeof (void *));
     }
 
+    for (i = 0; i < CODE_GEN_PHYS_HASH_SIZE; i++) {
+        if (tb_phys_hash[i])
+            set_bit(i, tb_discarded);
+    }
     memset (tb_phys_hash, 0, CODE_GEN_PHYS_HASH_SIZE * sizeof (void *));
     page_flush_tb();
 
-    code_gen_ptr = code_gen_buffer;
+    for (i = 0; i < code_gen_nb_regions; i++) {
+        r = &code_gen_regions[i];
+        r->ptr = r->start;
+        r->nb_tbs = 0;
+    }
+    cur_region = 0;
     /* XXX: flush processor icache at this point if cache flush is
        expensive */
     tb_flush_count++;
@@ -910,7 +1016,9 @@ static inline void tb_reset_jump(TranslationBlock *tb, int n)
 #endif
 }
 
-void tb_phys_invalidate(TranslationBlock *tb, tb_page_addr_t page_addr)
+/* take tb out of the hash tables and page lists and unlink all jumps to
+   and from it */
+static void tb_unlink(TranslationBlock *tb, tb_page_addr_t page_addr)
 {
     CPUState *env;
     PageDesc *p;
@@ -923,6 +1031,7 @@ void tb_phys_invalidate(TranslationBlock *tb, tb_page_addr_t page_addr)
     h = tb_phys_hash_func(phys_pc);
     tb_remove(&tb_phys_hash[h], tb,
               offsetof(TranslationBlock, phys_hash_next));
+    set_bit(h, tb_discarded);
 
     /* remove the TB from the page list */
     if (tb->page_addr[0] != page_addr) {
@@ -962,10 +1071,84 @@ void tb_phys_invalidate(TranslationBlock *tb, tb_page_addr_t page_addr)
         tb1 = tb2;
     }
     tb->jmp_first = (TranslationBlock *)((long)tb | 2); /* fail safe */
+}
 
+void tb_phys_invalidate(TranslationBlock *tb, tb_page_addr_t page_addr)
+{
+    tb_unlink(tb, page_addr);
     tb_phys_invalidate_count++;
 }
 
+/* whether tb is still in the physical hash table, i.e. has not been
+   invalidated since it was generated */
+static int tb_is_live(TranslationBlock *tb)
+{
+    TranslationBlock *tb1;
+    tb_page_addr_t phys_pc;
+
+    phys_pc = tb->page_addr[0] + (tb->pc & ~TARGET_PAGE_MASK);
+    for (tb1 = tb_phys_hash[tb_phys_hash_func(phys_pc)]; tb1 != NULL;
+         tb1 = tb1->phys_hash_next) {
+        if (tb1 == tb)
+            return 1;
+    }
+    return 0;
+}
+
+/* Move on to the next region, discarding the oldest generation of TBs
+   that it holds. Jumps from the other regions into them are reset, and
+   the TBs of the other regions stay valid. */
+static void tb_evict_region(void)
+{
+    CodeGenRegion *r;
+    TranslationBlock *tb;
+    int i;
+
+    cur_region = (cur_region + 1) % code_gen_nb_regions;
+    r = &code_gen_regions[cur_region];
+    if (r->nb_tbs == 0)
+        return;
+#if defined(CONFIG_LLVM)
+    tcg_llvm_tb_evict(r->tbs, r->tbs + r->nb_tbs);
+#endif
+    for (i = 0; i < r->nb_tbs; i++) {
+        tb = &r->tbs[i];
+        if (tb_is_live(tb)) {
+            tb_unlink(tb, -1);
+            tb_evict_count++;
+        }
+    }
+    r->ptr = r->start;
+    r->nb_tbs = 0;
+    tb_region_evict_count++;
+}
+
+/* invalidate the TBs whose guest code intersects the virtual address
+   range [start;end[, in all address spaces, so that they are translated
+   again. Must not be called while generated code is running. Returns the
+   number of TBs invalidated. */
+int tb_invalidate_virt_range(target_ulong start, target_ulong end)
+{
+    CodeGenRegion *r;
+    TranslationBlock *tb;
+    int i, j, n = 0;
+
+    for (i = 0; i < code_gen_nb_regions; i++) {
+        r = &code_gen_regions[i];
+        for (j = 0; j < r->nb_tbs; j++) {
+            tb = &r->tbs[j];
+            if (tb->pc + tb->size <= start || tb->pc >= end)
+                continue;
+            if (tb_is_live(tb)) {
+                tb_phys_invalidate(tb, -1);
+                n++;
+            }
+        }
+    }
+    tb_virt_invalidate_count += n;
+    return n;
+}
+
 static inline void set_bits(uint8_t *tab, int start, int len)
 {
     int end, mask, end1;
@@ -1025,6 +1208,7 @@ TranslationBlock *tb_gen_code(CPUState *env,
                               target_ulong pc, target_ulong cs_base,
                               int flags, int cflags)
 {
+    CodeGenRegion *r;
     TranslationBlock *tb;
     uint8_t *tc_ptr;
     tb_page_addr_t phys_pc, phys_page2;
@@ -1034,20 +1218,26 @@ TranslationBlock *tb_gen_code(CPUState *env,
     phys_pc = get_page_addr_code(env, pc);
     tb = tb_alloc(pc);
     if (!tb) {
-        /* flush must be done */
-        tb_flush(env);
+        /* reuse the oldest region, or flush everything if there is only
+           one */
+        if (code_gen_nb_regions > 1) {
+            tb_evict_region();
+        } else {
+            tb_flush(env);
+        }
         /* cannot fail at this point */
         tb = tb_alloc(pc);
         /* Don't forget to invalidate previous TB info.  */
         tb_invalidated_flag = 1;
     }
-    tc_ptr = code_gen_ptr;
+    r = &code_gen_regions[cur_region];
+    tc_ptr = r->ptr;
     tb->tc_ptr = tc_ptr;
     tb->cs_base = cs_base;
     tb->flags = flags;
     tb->cflags = cflags;
     cpu_gen_code(env, tb, &code_gen_size);
-    code_gen_ptr = (void *)(((unsigned long)code_gen_ptr + code_gen_size + CODE_GEN_ALIGN - 1) & ~(CODE_GEN_ALIGN - 1));
+    r->ptr = (void *)(((unsigned long)r->ptr + code_gen_size + CODE_GEN_ALIGN - 1) & ~(CODE_GEN_ALIGN - 1));
 
     /* check next page if needed */
     virt_page2 = (pc + tb->size - 1) & TARGET_PAGE_MASK;
@@ -1056,6 +1246,10 @@ TranslationBlock *tb_gen_code(CPUState *env,
         phys_page2 = get_page_addr_code(env, virt_page2);
     }
     tb_link_page(tb, phys_pc, phys_page2);
+
+    tb_translate_count++;
+    if (test_and_clear_bit(tb_phys_hash_func(phys_pc), tb_discarded))
+        tb_retranslate_count++;
     return tb;
 }
 
@@ -1374,18 +1568,24 @@ TranslationBlock *tb_find_pc(unsigned long tc_ptr)
     int m_min, m_max, m;
     unsigned long v;
     TranslationBlock *tb;
-
-    if (nb_tbs <= 0)
-        return NULL;
+    CodeGenRegion *r;
 
 #if defined(CONFIG_LLVM)
-    if(execute_llvm) {
-        for(m=0; m<nb_tbs; m++) {
-            tb = &tbs[m];
-            if(tb->llvm_function) {
-                if(tc_ptr >= (uintptr_t) tb->llvm_tc_ptr &&
-                   tc_ptr <  (uintptr_t) tb->llvm_tc_end)
-                    return tb;
+    /* blocks may run under either backend, so only search the LLVM
+       code if tc_ptr is not in the TCG code buffer */
+    if(execute_llvm && (tc_ptr < (unsigned long)code_gen_buffer ||
+                        tc_ptr >= (unsigned long)(code_gen_buffer +
+                                                  code_gen_buffer_size))) {
+        int i;
+        for(i=0; i<code_gen_nb_regions; i++) {
+            r = &code_gen_regions[i];
+            for(m=0; m<r->nb_tbs; m++) {
+                tb = &r->tbs[m];
+                if(tb->llvm_function) {
+                    if(tc_ptr >= (uintptr_t) tb->llvm_tc_ptr &&
+                       tc_ptr <  (uintptr_t) tb->llvm_tc_end)
+                        return tb;
+                }
             }
         }
         return NULL;
@@ -1393,14 +1593,20 @@ TranslationBlock *tb_find_pc(unsigned long tc_ptr)
 #endif
 
     if (tc_ptr < (unsigned long)code_gen_buffer ||
-        tc_ptr >= (unsigned long)code_gen_ptr)
+        tc_ptr >= (unsigned long)(code_gen_buffer +
+                                  code_gen_nb_regions * code_gen_region_size))
+        return NULL;
+    /* the TBs of a region are in the same order as their code */
+    r = &code_gen_regions[(tc_ptr - (unsigned long)code_gen_buffer) /
+                          code_gen_region_size];
+    if (r->nb_tbs <= 0 || tc_ptr >= (unsigned long)r->ptr)
         return NULL;
     /* binary search (cf Knuth) */
     m_min = 0;
-    m_max = nb_tbs - 1;
+    m_max = r->nb_tbs - 1;
     while (m_min <= m_max) {
         m = (m_min + m_max) >> 1;
-        tb = &tbs[m];
+        tb = &r->tbs[m];
         v = (unsigned long)tb->tc_ptr;
         if (v == tc_ptr)
             return tb;
@@ -1410,7 +1616,7 @@ TranslationBlock *tb_find_pc(unsigned long tc_ptr)
             m_min = m + 1;
         }
     }
-    return &tbs[m_max];
+    return &r->tbs[m_max];
 }
 
 static void tb_reset_jump_recursive(TranslationBlock *tb);
@@ -2090,6 +2296,94 @@ static CPUTLBEntry s_cputlb_empty_entry = {
     .addend     = -1,
 };
 
+/* PANDA: small software TLB of guest virtual page -> RAM host pointer
+   translations, used by panda_virtual_memory_rw and panda_virt_to_host so
+   that plugins reading guest memory at high rates don't walk the guest
+   page tables on every call.  Any flush of QEMU's own TLB (which the guest
+   has to trigger after changing a mapping) also flushes this one.  Entries
+   are tagged with the address space they were made in (CR3 on x86, the
+   translation table base on ARM).  That only saves flushes on ARM, where
+   writing the translation table base doesn't flush the TLB; on x86,
+   cpu_x86_update_cr3 flushes it, and this cache with it.  With
+   panda_vtlb_enabled cleared (-panda-vtlb off), every lookup walks the
+   page tables, for comparison. */
+#define PANDA_VTLB_BITS 10
+#define PANDA_VTLB_SIZE (1 << PANDA_VTLB_BITS)
+
+typedef struct PandaVTLBEntry {
+    target_ulong vpage;
+    target_ulong asid;
+    target_phys_addr_t ppage;
+    uint8_t *host;              /* NULL if the page is not RAM */
+    int valid;
+} PandaVTLBEntry;
+
+static PandaVTLBEntry panda_vtlb[PANDA_VTLB_SIZE];
+int panda_vtlb_enabled = 1;
+uint64_t panda_vtlb_hits;
+uint64_t panda_vtlb_misses;
+
+static inline target_ulong panda_vtlb_asid(CPUState *env, target_ulong addr)
+{
+#if defined(TARGET_I386)
+    return env->cr[3];
+#elif defined(TARGET_ARM)
+    if (addr & env->cp15.c2_mask)
+        return env->cp15.c2_base1 & 0xffffc000;
+    return env->cp15.c2_base0 & env->cp15.c2_base_mask;
+#else
+    return 0;
+#endif
+}
+
+static void panda_vtlb_flush(void)
+{
+    memset(panda_vtlb, 0, sizeof(panda_vtlb));
+}
+
+static void panda_vtlb_flush_page(target_ulong addr)
+{
+    PandaVTLBEntry *e;
+
+    e = &panda_vtlb[(addr >> TARGET_PAGE_BITS) & (PANDA_VTLB_SIZE - 1)];
+    if (e->valid && e->vpage == (addr & TARGET_PAGE_MASK))
+        e->valid = 0;
+}
+
+/* Returns the entry for the page containing addr, filling it on a miss,
+   or NULL if the page is not mapped. */
+static PandaVTLBEntry *panda_vtlb_lookup(CPUState *env, target_ulong addr)
+{
+    target_ulong vpage = addr & TARGET_PAGE_MASK;
+    target_ulong asid = panda_vtlb_asid(env, addr);
+    PandaVTLBEntry *e;
+    target_phys_addr_t phys_addr;
+    ram_addr_t pd;
+
+    e = &panda_vtlb[(vpage >> TARGET_PAGE_BITS) & (PANDA_VTLB_SIZE - 1)];
+    if (panda_vtlb_enabled && e->valid && e->vpage == vpage &&
+        e->asid == asid) {
+        panda_vtlb_hits++;
+        return e;
+    }
+    panda_vtlb_misses++;
+
+    phys_addr = cpu_get_phys_page_debug(env, vpage);
+    if (phys_addr == -1)
+        return NULL;
+    pd = cpu_get_physical_page_desc(phys_addr);
+
+    e->vpage = vpage;
+    e->asid = asid;
+    e->ppage = phys_addr;
+    if ((pd & ~TARGET_PAGE_MASK) == IO_MEM_RAM)
+        e->host = qemu_get_ram_ptr(pd & TARGET_PAGE_MASK);
+    else
+        e->host = NULL;
+    e->valid = 1;
+    return e;
+}
+
 /* NOTE: if flush_global is true, also flush global entries (not
    implemented yet) */
 void tlb_flush(CPUState *env, int flush_global)
@@ -2115,6 +2409,8 @@ void tlb_flush(CPUState *env, int flush_global)
     env->tlb_flush_addr = -1;
     env->tlb_flush_mask = 0;
     tlb_flush_count++;
+
+    panda_vtlb_flush();
 }
 
 static inline void tlb_flush_entry(CPUTLBEntry *tlb_entry, target_ulong addr)
@@ -2157,6 +2453,8 @@ void tlb_flush_page(CPUState *env, target_ulong addr)
         tlb_flush_entry(&env->tlb_table[mmu_idx][i], addr);
 
     tlb_flush_jmp_cache(env, addr);
+
+    panda_vtlb_flush_page(addr);
 }
 
 /* update the TLBs so that writes to code in the virtual page 'addr'
@@ -2675,7 +2973,6 @@ int page_check_range(target_ulong start, target_ulong len, int flags)
                 if (!page_unprotect(addr, 0, NULL))
                     return -1;
             }
-            return 0;
         }
     }
     return 0;
@@ -4072,10 +4369,42 @@ int cpu_memory_rw_debug(CPUState *env, target_ulong addr,
     return 0;
 }
 
+/* In user mode all of guest memory is mapped contiguously at g2h(), so the
+   PANDA accessors only have to check the guest page flags. Unlike the
+   softmmu versions, a range may span several pages. */
+static int panda_user_range_ok(target_ulong addr, int len, int flags)
+{
+    if (len <= 0)
+        return 0;
+#if TARGET_ABI_BITS > L1_MAP_ADDR_SPACE_BITS
+    /* page_check_range asserts on addresses outside the guest space */
+    if (addr >= ((abi_ulong)1 << L1_MAP_ADDR_SPACE_BITS))
+        return 0;
+#endif
+    return page_check_range(addr, len, flags) == 0;
+}
+
 int panda_virtual_memory_rw(CPUState *env, target_ulong addr,
-                        uint8_t *buf, int len, int is_write) {
-    // XXX Unimplemented for linux user mode
-    return -1;
+                        uint8_t *buf, int len, int is_write)
+{
+    if (len == 0)
+        return 0;
+    /* checking for PAGE_WRITE also unprotects pages holding translated
+       code, so the TBs on them are invalidated before we write */
+    if (!panda_user_range_ok(addr, len, is_write ? PAGE_WRITE : PAGE_READ))
+        return -1;
+    if (is_write)
+        memcpy(g2h(addr), buf, len);
+    else
+        memcpy(buf, g2h(addr), len);
+    return 0;
+}
+
+uint8_t *panda_virt_to_host(CPUState *env, target_ulong addr, int len)
+{
+    if (!panda_user_range_ok(addr, len, PAGE_READ))
+        return NULL;
+    return g2h(addr);
 }
 
 #else
@@ -4995,23 +5324,24 @@ int panda_virtual_memory_rw(CPUState *env, target_ulong addr,
 {
     int l;
     int ret;
-    target_phys_addr_t phys_addr;
     target_ulong page;
+    PandaVTLBEntry *e;
 
     while (len > 0) {
         page = addr & TARGET_PAGE_MASK;
-        phys_addr = cpu_get_phys_page_debug(env, page);
+        e = panda_vtlb_lookup(env, page);
         /* if no physical page mapped, return an error */
-        if (phys_addr == -1)
+        if (!e)
             return -1;
         l = (page + TARGET_PAGE_SIZE) - addr;
         if (l > len)
             l = len;
-        phys_addr += (addr & ~TARGET_PAGE_MASK);
         if (is_write)
-            cpu_physical_memory_write_rom(phys_addr, buf, l);
+            cpu_physical_memory_write_rom(e->ppage + (addr & ~TARGET_PAGE_MASK), buf, l);
+        else if (e->host)
+            memcpy(buf, e->host + (addr & ~TARGET_PAGE_MASK), l);
         else {
-            ret = panda_physical_memory_rw(phys_addr, buf, l, is_write);
+            ret = panda_physical_memory_rw(e->ppage + (addr & ~TARGET_PAGE_MASK), buf, l, is_write);
             if(ret < 0) return ret;
         }
         len -= l;
@@ -5021,6 +5351,18 @@ int panda_virtual_memory_rw(CPUState *env, target_ulong addr,
     return 0;
 }
 
+uint8_t *panda_virt_to_host(CPUState *env, target_ulong addr, int len)
+{
+    PandaVTLBEntry *e;
+
+    if (len <= 0 || (addr & ~TARGET_PAGE_MASK) + len > TARGET_PAGE_SIZE)
+        return NULL;
+    e = panda_vtlb_lookup(env, addr);
+    if (!e || !e->host)
+        return NULL;
+    return e->host + (addr & ~TARGET_PAGE_MASK);
+}
+
 #endif
 
 /* in deterministic execution mode, instructions doing device I/Os
@@ -5091,10 +5433,40 @@ void cpu_io_recompile(CPUState *env, void *retaddr)
 
 #if !defined(CONFIG_USER_ONLY)
 
+void panda_vtlb_dump_info(FILE *f, fprintf_function cpu_fprintf)
+{
+    cpu_fprintf(f, "PANDA vtlb %s       %" PRIu64 " hits, %" PRIu64
+                " misses\n", panda_vtlb_enabled ? "on " : "off",
+                panda_vtlb_hits, panda_vtlb_misses);
+}
+
+/* flushes, evictions and retranslations, in total and per second since
+   the translator was initialized */
+void tb_dump_cache_info(FILE *f, fprintf_function cpu_fprintf)
+{
+    double secs = (get_clock_realtime() - tb_stats_start) / 1e9;
+
+    if (secs <= 0)
+        secs = 1;
+    cpu_fprintf(f, "TB regions          %d of %lu bytes (current %d)\n",
+                code_gen_nb_regions, code_gen_region_size, cur_region);
+    cpu_fprintf(f, "TB flushes          %d (%.2f/s)\n",
+                tb_flush_count, tb_flush_count / secs);
+    cpu_fprintf(f, "TB region evictions %d (%.2f/s, %d TBs)\n",
+                tb_region_evict_count, tb_region_evict_count / secs,
+                tb_evict_count);
+    cpu_fprintf(f, "TB range invalidate %d TBs\n", tb_virt_invalidate_count);
+    cpu_fprintf(f, "TB translations     %" PRId64 " (%.1f/s)\n",
+                tb_translate_count, tb_translate_count / secs);
+    cpu_fprintf(f, "TB retranslations   %" PRId64 " (%.1f/s)\n",
+                tb_retranslate_count, tb_retranslate_count / secs);
+}
+
 void dump_exec_info(FILE *f, fprintf_function cpu_fprintf)
 {
-    int i, target_code_size, max_target_code_size;
+    int i, j, nb_tbs, target_code_size, max_target_code_size;
     int direct_jmp_count, direct_jmp2_count, cross_page;
+    unsigned long code_size;
     TranslationBlock *tb;
 
     target_code_size = 0;
@@ -5102,32 +5474,37 @@ void dump_exec_info(FILE *f, fprintf_function cpu_fprintf)
     cross_page = 0;
     direct_jmp_count = 0;
     direct_jmp2_count = 0;
-    for(i = 0; i < nb_tbs; i++) {
-        tb = &tbs[i];
-        target_code_size += tb->size;
-        if (tb->size > max_target_code_size)
-            max_target_code_size = tb->size;
-        if (tb->page_addr[1] != -1)
-            cross_page++;
-        if (tb->tb_next_offset[0] != 0xffff) {
-            direct_jmp_count++;
-            if (tb->tb_next_offset[1] != 0xffff) {
-                direct_jmp2_count++;
+    for(i = 0; i < code_gen_nb_regions; i++) {
+        for(j = 0; j < code_gen_regions[i].nb_tbs; j++) {
+            tb = &code_gen_regions[i].tbs[j];
+            target_code_size += tb->size;
+            if (tb->size > max_target_code_size)
+                max_target_code_size = tb->size;
+            if (tb->page_addr[1] != -1)
+                cross_page++;
+            if (tb->tb_next_offset[0] != 0xffff) {
+                direct_jmp_count++;
+                if (tb->tb_next_offset[1] != 0xffff) {
+                    direct_jmp2_count++;
+                }
             }
         }
     }
+    nb_tbs = tb_count();
+    code_size = code_gen_used();
     /* XXX: avoid using doubles ? */
     cpu_fprintf(f, "Translation buffer state:\n");
-    cpu_fprintf(f, "gen code size       %td/%ld\n",
-                code_gen_ptr - code_gen_buffer, code_gen_buffer_max_size);
+    cpu_fprintf(f, "gen code size       %lu/%lu\n", code_size,
+                code_gen_nb_regions * (code_gen_region_size -
+                                       TCG_MAX_OP_SIZE * OPC_BUF_SIZE));
     cpu_fprintf(f, "TB count            %d/%d\n", 
-                nb_tbs, code_gen_max_blocks);
+                nb_tbs, code_gen_nb_regions * code_gen_region_max_blocks);
     cpu_fprintf(f, "TB avg target size  %d max=%d bytes\n",
                 nb_tbs ? target_code_size / nb_tbs : 0,
                 max_target_code_size);
-    cpu_fprintf(f, "TB avg host size    %td bytes (expansion ratio: %0.1f)\n",
-                nb_tbs ? (code_gen_ptr - code_gen_buffer) / nb_tbs : 0,
-                target_code_size ? (double) (code_gen_ptr - code_gen_buffer) / target_code_size : 0);
+    cpu_fprintf(f, "TB avg host size    %lu bytes (expansion ratio: %0.1f)\n",
+                nb_tbs ? code_size / nb_tbs : 0,
+                target_code_size ? (double) code_size / target_code_size : 0);
     cpu_fprintf(f, "cross page TB count %d (%d%%)\n",
             cross_page,
             nb_tbs ? (cross_page * 100) / nb_tbs : 0);
@@ -5137,9 +5514,31 @@ void dump_exec_info(FILE *f, fprintf_function cpu_fprintf)
                 direct_jmp2_count,
                 nb_tbs ? (direct_jmp2_count * 100) / nb_tbs : 0);
     cpu_fprintf(f, "\nStatistics:\n");
-    cpu_fprintf(f, "TB flush count      %d\n", tb_flush_count);
+    tb_dump_cache_info(f, cpu_fprintf);
     cpu_fprintf(f, "TB invalidate count %d\n", tb_phys_invalidate_count);
     cpu_fprintf(f, "TLB flush count     %d\n", tlb_flush_count);
+    panda_vtlb_dump_info(f, cpu_fprintf);
+#if defined(CONFIG_LLVM)
+    if (generate_llvm) {
+        cpu_fprintf(f, "LLVM lowered TBs    %" PRId64 "/%" PRId64 "\n",
+                    llvm_tbs_lowered, llvm_tbs_translated);
+        tcg_llvm_dump_mem_stats(f, cpu_fprintf);
+        if (llvm_async_compile) {
+            cpu_fprintf(f, "LLVM pending execs  %" PRId64 "\n",
+                        llvm_tbs_pending_execs);
+        }
+        if (llvm_opt_threshold) {
+            tcg_llvm_dump_tier_stats(f, cpu_fprintf);
+        }
+        if (llvm_trace_threshold) {
+            tcg_llvm_dump_trace_stats(f, cpu_fprintf);
+        }
+        if (llvm_inline_threshold) {
+            dump_llvm_helper_inline_stats(f, cpu_fprintf);
+        }
+    }
+#endif
+    tcg_dump_opt_info(f, cpu_fprintf);
     tcg_dump_info(f, cpu_fprintf);
 }
 
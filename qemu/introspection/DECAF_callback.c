@@ -81,45 +81,76 @@ static int bEnableAllBlockEndCallbacks = 0;
 static int enableAllBlockEndCallbacksCount = 0;
 
 
-//We use hashtables to keep track of individual basic blocks
-// that is associated with a callback - we ignore
-// the conditional that is registered with the callback 
-// right now - that is the conditional has been changed
-// into a simple "enable" bit. The reasoning is that the condition is controlled
-// by the user, and so there is no way for us to update
-// the hashtables accordingly.
-//Specifically, we use a counting hashtable (essentially a hashmap)
-// where the value is the number of callbacks that have registered for
-// this particular condition. The affected translation block
-// is flushed at the 0 to 1 or 1 to 0 transitions.
+//All of the optimized callbacks are registered in a single table indexed
+// by virtual page, so that deciding whether a block needs a callback at
+// translation time (stage 1) is one or two array lookups instead of a probe
+// into each of several hashtables. Each page keeps the number of callbacks
+// of each kind that involve it - the conditional has been changed into a
+// simple "enable" bit, since the condition is controlled by the user and
+// there is no way for us to update the table accordingly. The translation
+// blocks that start in a page are invalidated when one of its counts goes
+// from 0 to 1 or 1 to 0, and no others.
+typedef struct _PageCallbackCounts
+{
+  uint32_t blockBegin; //OCB_PAGE block begin callbacks for this page
+  uint32_t blockBeginConst; //OCB_CONST block begin callbacks for addresses in it
+  uint32_t blockEndFrom; //block end callbacks from this page, to anywhere
+  uint32_t blockEndPair; //block end callbacks from this page to a given page
+  uint32_t blockEndTo; //block end callbacks from anywhere to this page
+} PageCallbackCounts;
+
+//The table is a two level radix tree on the page number, and the second
+// level is only allocated for pages that have had a callback. Only the low
+// 32 bits of the address are used, so on a 64 bit guest pages 4GB apart
+// share an entry. That only means a block might get a callback check it
+// didn't need - the invoke helpers below still match the exact addresses.
+#define PAGE_CB_L2_BITS 10
+#define PAGE_CB_L2_SIZE (1 << PAGE_CB_L2_BITS)
+#define PAGE_CB_L1_SIZE (1 << (32 - TARGET_PAGE_BITS - PAGE_CB_L2_BITS))
+static PageCallbackCounts* pageCallbackCounts[PAGE_CB_L1_SIZE];
+
+//Returns the counts for the page that addr is in. If bCreate is not set and
+// the page has never had a callback, NULL is returned instead.
+static inline PageCallbackCounts* getPageCallbackCounts(gva_t addr, int bCreate)
+{
+  uint32_t page = (uint32_t)addr >> TARGET_PAGE_BITS;
+  PageCallbackCounts** ppLeaf = &pageCallbackCounts[page >> PAGE_CB_L2_BITS];
+
+  if (*ppLeaf == NULL)
+  {
+    if (!bCreate)
+    {
+      return (NULL);
+    }
+    *ppLeaf = (PageCallbackCounts*)calloc(PAGE_CB_L2_SIZE, sizeof(PageCallbackCounts));
+    if (*ppLeaf == NULL)
+    {
+      return (NULL);
+    }
+  }
+  return (&(*ppLeaf)[page & (PAGE_CB_L2_SIZE - 1)]);
+}
+
+//Invalidates the translation blocks that start in the page that addr is in
+static inline void flushTranslationPage(gva_t addr)
+{
+  addr &= TARGET_PAGE_MASK;
+  DECAF_flushTranslationBlocksInRange(addr, addr + TARGET_PAGE_SIZE);
+}
+
+//The page table only says that there are OCB_CONST callbacks in a page. This
+// counting hashtable (essentially a hashmap) has the number of callbacks for
+// each address, and it is only consulted for pages that have any.
 static CountingHashtable* pOBBTable;
 
-//A second page table at the page level
-//There are two different hashtables so that determining
-// whether a callback is needed at translation time (stage 1)
-// can be done in the order of - allBlockBegins, Page level and then
-// individual address or constant level.
-static CountingHashtable* pOBBPageTable;
-
-//Similarly we declare hashtables for block end
-// the unique aspect of these hashtables is that they are
-// only defined at the page level AND they are defined
-// for the block end source (i.e. the location of the current
-// basic block), the block end target (i.e. where is the next
-// basic block), and then a map that contains both.
-
-//This first table is for block ends callbacks that only specify the
-// from address - i.e. where the block currently is
-static CountingHashtable* pOBEFromPageTable;
-
-//This second table is for callbacks that only specify the to address
-// that is where the next block is
-static CountingHashtable* pOBEToPageTable;
-
-//This third table is for callbacks that specify both the from and to
-// addresses. The hashmap maps the "from" page to a hashtable of "to" pages
+//Similarly, the page table only says that there are callbacks from a page to
+// some specific pages. This maps the "from" page to a hashtable of "to" pages.
 static CountingHashmap* pOBEPageMap;
 
+//The number of registered callbacks with a condition function, by type. Only
+// those need their conditions evaluated at translation time.
+static int condCallbackCount[DECAF_LAST_CB];
+
 
 //data structures for storing the userspace callbacks (stage 2)
 typedef struct callback_struct{
@@ -170,69 +201,89 @@ int DECAF_is_callback_needed(DECAF_callback_type_t cb_type, gva_t cur_pc, gva_t
   return (0);
 }
 
-//here we search from the broadest to the narrowest
-// to determine whether the callback is needed
-int DECAF_is_BlockBeginCallback_needed(gva_t pc)
+//Same as DECAF_is_callback_needed, but only for the callbacks that have
+// a condition. The ones without are the optimized callbacks, which are
+// looked up in the page table instead.
+static int is_cond_callback_needed(DECAF_callback_type_t cb_type, gva_t cur_pc, gva_t next_pc)
 {
-  //go through the page list first
-  if (bEnableAllBlockBeginCallbacks)
+  callback_struct_t *cb_struct;
+
+  if (condCallbackCount[cb_type] == 0)
   {
-    return (1);
+    return (0);
   }
 
-  //TODO: FIX THIS LOGIC It doesn't make sense
-  // since we make the call here, it will never get down to the
-  // other tests - because if there is OBBPage or wahtever
-  // then the callback function is going to be NULL
-  // which makes this return 1.
-  if (DECAF_is_callback_needed(DECAF_BLOCK_BEGIN_CB, pc, INV_ADDR))
+  LIST_FOREACH(cb_struct, &callback_list_heads[cb_type], link)
   {
-    return (1);
+    DEFENSIVE_CHECK1(cb_struct == NULL, 0);
+
+    if ( (cb_struct->cb_cond_func != NULL) && cb_struct->cb_cond_func(cb_type, cur_pc, next_pc) )
+    {
+      return (1);
+    }
   }
+  return (0);
+}
 
-  if (CountingHashtable_exist(pOBBPageTable, pc & TARGET_PAGE_MASK))
+//here we search from the broadest to the narrowest
+// to determine whether the callback is needed
+int DECAF_is_BlockBeginCallback_needed(gva_t pc)
+{
+  PageCallbackCounts* page;
+
+  if (bEnableAllBlockBeginCallbacks)
   {
     return (1);
   }
 
-  if (CountingHashtable_exist(pOBBTable, pc))
+  page = getPageCallbackCounts(pc, 0);
+  if (page != NULL)
   {
-    return (1);
+    if (page->blockBegin != 0)
+    {
+      return (1);
+    }
+    if ( (page->blockBeginConst != 0) && CountingHashtable_exist(pOBBTable, pc) )
+    {
+      return (1);
+    }
   }
 
-  return 0;
+  return (is_cond_callback_needed(DECAF_BLOCK_BEGIN_CB, pc, INV_ADDR));
 }
 
 int DECAF_is_BlockEndCallback_needed(gva_t from, gva_t to)
 {
+  PageCallbackCounts* page;
+
   if (bEnableAllBlockEndCallbacks)
   {
     return (1);
   }
 
-  if (DECAF_is_callback_needed(DECAF_BLOCK_END_CB, from, to))
+  page = getPageCallbackCounts(from, 0);
+  if ( (page != NULL) && (page->blockEndFrom != 0) )
   {
     return (1);
   }
 
-  from &= TARGET_PAGE_MASK;
-  //go through the page list first
-  if (CountingHashtable_exist(pOBEFromPageTable, from))
+  //to == INV_ADDR is a special case where the target is not known at translation time
+  if (to != INV_ADDR)
   {
-    return (1);
-  }
-  if (to == INV_ADDR) //this is a special case where the target is not known at translation time
-  {
-    return (0);
-  }
+    if ( (page != NULL) && (page->blockEndPair != 0)
+         && CountingHashmap_exist(pOBEPageMap, from & TARGET_PAGE_MASK, to & TARGET_PAGE_MASK) )
+    {
+      return (1);
+    }
 
-  to &= TARGET_PAGE_MASK;
-  if (CountingHashtable_exist(pOBEToPageTable, to))
-  {
-    return (1);
+    page = getPageCallbackCounts(to, 0);
+    if ( (page != NULL) && (page->blockEndTo != 0) )
+    {
+      return (1);
+    }
   }
 
-  return (CountingHashmap_exist(pOBEPageMap, from, to));
+  return (is_cond_callback_needed(DECAF_BLOCK_END_CB, from, to));
 }
 
 
@@ -242,6 +293,7 @@ DECAF_Handle DECAF_registerOptimizedBlockBeginCallback(
     OCB_t type)
 {
 
+  PageCallbackCounts* page;
   callback_struct_t * cb_struct = (callback_struct_t *)malloc(sizeof(callback_struct_t));
   if (cb_struct == NULL)
   {
@@ -276,15 +328,17 @@ DECAF_Handle DECAF_registerOptimizedBlockBeginCallback(
     }
     case (OCB_CONST):
     {
-      if (pOBBTable == NULL)
+      page = getPageCallbackCounts(addr, 1);
+      if ( (pOBBTable == NULL) || (page == NULL) )
       {
         free(cb_struct);
         return (DECAF_NULL_HANDLE);
       }
       //This is not necessarily thread-safe
+      page->blockBeginConst++;
       if (CountingHashtable_add(pOBBTable, addr) == 1)
       {
-        DECAF_flushTranslationBlock(addr);
+        DECAF_flushTranslationBlocksInRange(addr, addr + 1);
       }
       break;
     }
@@ -298,18 +352,18 @@ DECAF_Handle DECAF_registerOptimizedBlockBeginCallback(
     }
     case (OCB_PAGE):
     {
-      addr &= TARGET_PAGE_MASK;
-      if (pOBBPageTable == NULL)
+      page = getPageCallbackCounts(addr, 1);
+      if (page == NULL)
       {
         free(cb_struct);
         return (DECAF_NULL_HANDLE);
       }
 
       //This is not necessarily thread-safe
-      if (CountingHashtable_add(pOBBPageTable, addr) == 1)
+      page->blockBegin++;
+      if (page->blockBegin == 1)
       {
-        //DECAF_flushTranslationPage(addr);
-        DECAF_flushTranslationCache();
+        flushTranslationPage(addr);
       }
       break;
     }
@@ -327,6 +381,7 @@ DECAF_Handle DECAF_registerOptimizedBlockEndCallback(
     gva_t to)
 {
 
+  PageCallbackCounts* page;
   callback_struct_t * cb_struct = (callback_struct_t *)malloc(sizeof(callback_struct_t));
   if (cb_struct == NULL)
   {
@@ -350,45 +405,52 @@ DECAF_Handle DECAF_registerOptimizedBlockEndCallback(
       DECAF_flushTranslationCache();
     }
   }
-  else if (to == INV_ADDR) //this means only looking at the FROM list
+  else if (to == INV_ADDR) //this means only looking at the FROM page
   {
-    if (pOBEFromPageTable == NULL)
+    page = getPageCallbackCounts(from, 1);
+    if (page == NULL)
     {
       free(cb_struct);
       return(DECAF_NULL_HANDLE);
     }
 
-    if (CountingHashtable_add(pOBEFromPageTable, from & TARGET_PAGE_MASK) == 1)
+    page->blockEndFrom++;
+    if (page->blockEndFrom == 1)
     {
-      DECAF_flushTranslationPage(from);
+      flushTranslationPage(from);
     }
   }
   else if (from == INV_ADDR)
     //this is tricky, because it involves flushing the WHOLE cache
+    // - a block anywhere can jump to the page, and blocks don't record where to
   {
-    if (pOBEToPageTable == NULL)
+    page = getPageCallbackCounts(to, 1);
+    if (page == NULL)
     {
       free(cb_struct);
       return(DECAF_NULL_HANDLE);
     }
 
-    if (CountingHashtable_add(pOBEToPageTable, to & TARGET_PAGE_MASK) == 1)
+    page->blockEndTo++;
+    if (page->blockEndTo == 1)
     {
       DECAF_flushTranslationCache();
     }
   }
   else
   {
-    if (pOBEPageMap == NULL)
+    page = getPageCallbackCounts(from, 1);
+    if ( (pOBEPageMap == NULL) || (page == NULL) )
     {
       free(cb_struct);
       return(DECAF_NULL_HANDLE);
     }
 
     //if we are here then that means we need the hashmap
+    page->blockEndPair++;
     if (CountingHashmap_add(pOBEPageMap, from & TARGET_PAGE_MASK, to & TARGET_PAGE_MASK) == 1)
     {
-      DECAF_flushTranslationPage(from);
+      flushTranslationPage(from);
     }
   }
 
@@ -430,12 +492,20 @@ DECAF_Handle DECAF_register_callback(
   cb_struct->cb_cond_func = cb_cond_func;
   cb_struct->from = INV_ADDR;
   cb_struct->to = INV_ADDR;
+  cb_struct->ocb_type = OCB_ALL;
 
-  if(LIST_EMPTY(&callback_list_heads[cb_type]))
+  //a condition can select any block - including ones translated before it
+  // was registered, which don't have the callback
+  if(LIST_EMPTY(&callback_list_heads[cb_type]) || (cb_cond_func != NULL))
   {
     DECAF_flushTranslationCache();
   }
 
+  if (cb_cond_func != NULL)
+  {
+    condCallbackCount[cb_type]++;
+  }
+
   LIST_INSERT_HEAD(&callback_list_heads[cb_type], cb_struct, link);
 
   return ((DECAF_Handle)cb_struct);
@@ -445,6 +515,7 @@ DECAF_Handle DECAF_register_callback(
 DECAF_errno_t DECAF_unregisterOptimizedBlockBeginCallback(DECAF_Handle handle)
 {
   callback_struct_t *cb_struct;
+  PageCallbackCounts* page;
   //to unregister the callback, we have to first find the
   // callback and its conditions and then remove it from the
   // corresonding hashtable
@@ -483,26 +554,29 @@ DECAF_errno_t DECAF_unregisterOptimizedBlockBeginCallback(DECAF_Handle handle)
       }
       case (OCB_CONST):
       {
-        if (pOBBTable == NULL)
+        page = getPageCallbackCounts(cb_struct->from, 0);
+        if ( (pOBBTable == NULL) || (page == NULL) )
         {
           return (NULL_POINTER_ERROR);
         }
+        page->blockBeginConst--;
         if (CountingHashtable_remove(pOBBTable, cb_struct->from) == 0)
         {
-          DECAF_flushTranslationBlock(cb_struct->from);
+          DECAF_flushTranslationBlocksInRange(cb_struct->from, cb_struct->from + 1);
         }
         break;
       }
       case (OCB_PAGE):
       {
-        if (pOBBPageTable == NULL)
+        page = getPageCallbackCounts(cb_struct->from, 0);
+        if (page == NULL)
         {
           return (NULL_POINTER_ERROR);
         }
-        if (CountingHashtable_remove(pOBBPageTable, cb_struct->from) == 0)
+        page->blockBegin--;
+        if (page->blockBegin == 0)
         {
-          //DECAF_flushTranslationPage(cb_struct->from);
-          DECAF_flushTranslationCache();
+          flushTranslationPage(cb_struct->from);
         }
         break;
       }
@@ -523,6 +597,7 @@ DECAF_errno_t DECAF_unregisterOptimizedBlockBeginCallback(DECAF_Handle handle)
 DECAF_errno_t DECAF_unregisterOptimizedBlockEndCallback(DECAF_Handle handle)
 {
   callback_struct_t *cb_struct;
+  PageCallbackCounts* page;
 
   //to unregister the callback, we have to first find the
   // callback and its conditions and then remove it from the
@@ -553,23 +628,31 @@ DECAF_errno_t DECAF_unregisterOptimizedBlockEndCallback(DECAF_Handle handle)
     }
     else if (cb_struct->to == INV_ADDR)
     {
-      gva_t from = cb_struct->from & TARGET_PAGE_MASK;
-      if (CountingHashtable_remove(pOBEFromPageTable, from) == 0)
+      page = getPageCallbackCounts(cb_struct->from, 0);
+      if ( (page != NULL) && (--page->blockEndFrom == 0) )
       {
-        DECAF_flushTranslationPage(from);
+        flushTranslationPage(cb_struct->from);
       }
     }
     else if (cb_struct->from == INV_ADDR)
     {
-      gva_t to = cb_struct->to & TARGET_PAGE_MASK;
-      if (CountingHashtable_remove(pOBEToPageTable, to) == 0)
+      page = getPageCallbackCounts(cb_struct->to, 0);
+      if ( (page != NULL) && (--page->blockEndTo == 0) )
       {
         DECAF_flushTranslationCache();
       }
     }
-    else if (CountingHashmap_remove(pOBEPageMap, cb_struct->from & TARGET_PAGE_MASK, cb_struct->to & TARGET_PAGE_MASK) == 0)
+    else
     {
-      DECAF_flushTranslationPage(cb_struct->from & TARGET_PAGE_MASK);
+      page = getPageCallbackCounts(cb_struct->from, 0);
+      if (page != NULL)
+      {
+        page->blockEndPair--;
+      }
+      if (CountingHashmap_remove(pOBEPageMap, cb_struct->from & TARGET_PAGE_MASK, cb_struct->to & TARGET_PAGE_MASK) == 0)
+      {
+        flushTranslationPage(cb_struct->from);
+      }
     }
 
     //we can now remove the entry
@@ -605,6 +688,10 @@ DECAF_errno_t DECAF_unregister_callback(DECAF_callback_type_t cb_type, DECAF_Han
       continue;
     }
 
+    if (cb_struct->cb_cond_func != NULL)
+    {
+      condCallbackCount[cb_type]--;
+    }
     LIST_REMOVE(cb_struct, link);
     free(cb_struct);
 
@@ -817,12 +904,15 @@ void DECAF_callback_init(void)
   }
 
   pOBBTable = CountingHashtable_new();
-  pOBBPageTable = CountingHashtable_new();
-
-  pOBEFromPageTable = CountingHashtable_new();
-  pOBEToPageTable = CountingHashtable_new();
   pOBEPageMap = CountingHashmap_new();
 
+  for (i = 0; i < PAGE_CB_L1_SIZE; i++)
+  {
+    free(pageCallbackCounts[i]);
+    pageCallbackCounts[i] = NULL;
+  }
+  memset(condCallbackCount, 0, sizeof(condCallbackCount));
+
   bEnableAllBlockBeginCallbacks = 0;
   enableAllBlockBeginCallbacksCount = 0;
   bEnableAllBlockEndCallbacks = 0;
@@ -143,7 +143,7 @@ gva_t DECAF_get_next_task_struct(CPUState* env, gva_t addr)
   return retval;
 }
 
-gva_t prev_task_struct(CPUState* env, gva_t addr)
+gva_t DECAF_get_prev_task_struct(CPUState* env, gva_t addr)
 {
   gva_t retval;
 
@@ -170,17 +170,142 @@ gva_t prev_task_struct(CPUState* env, gva_t addr)
   return retval;
 }
 
+int DECAF_read_span(CPUState* env, gva_t struct_addr, DECAF_struct_span* span)
+{
+  if ( (span->hi <= span->lo) || (span->hi - span->lo > DECAF_STRUCT_SPAN_MAX) )
+  {
+    return (-1);
+  }
+  return (DECAF_read_mem(env, struct_addr + span->lo, span->buf, span->hi - span->lo));
+}
+
+DECAF_errno_t DECAF_get_task_info(CPUState* env, gva_t addr, DECAF_task_info* info)
+{
+  DECAF_struct_span span;
+  int commlen = (size_of_task_struct_comm < DECAF_TASK_COMM_LEN) ? size_of_task_struct_comm : DECAF_TASK_COMM_LEN - 1;
+
+  DECAF_span_init(&span);
+  DECAF_span_add(&span, task_struct_pid_offset, sizeof(info->pid));
+  DECAF_span_add(&span, task_struct_tgid_offset, sizeof(info->tgid));
+  DECAF_span_add(&span, task_struct_group_leader_offset, sizeof(gva_t));
+  DECAF_span_add(&span, task_struct_real_parent_offset, sizeof(gva_t));
+  DECAF_span_add(&span, task_struct_thread_group_offset, sizeof(gva_t));
+  DECAF_span_add(&span, task_struct_stack_offset, sizeof(gva_t));
+  //active_mm follows mm
+  DECAF_span_add(&span, task_struct_mm_offset, 2 * sizeof(gva_t));
+  DECAF_span_add(&span, task_struct_cred_offset, sizeof(gva_t));
+  DECAF_span_add(&span, task_struct_tasks_offset, sizeof(gva_t));
+  DECAF_span_add(&span, task_struct_comm_offset, commlen);
+
+  if (DECAF_read_span(env, addr, &span) != 0)
+  {
+    return (-1);
+  }
+
+  DECAF_span_get(&span, task_struct_pid_offset, &info->pid);
+  DECAF_span_get(&span, task_struct_tgid_offset, &info->tgid);
+  DECAF_span_get(&span, task_struct_group_leader_offset, &info->group_leader);
+  DECAF_span_get(&span, task_struct_real_parent_offset, &info->real_parent);
+  DECAF_span_get(&span, task_struct_thread_group_offset, &info->thread_group);
+  DECAF_span_get(&span, task_struct_stack_offset, &info->stack);
+  DECAF_span_get(&span, task_struct_mm_offset, &info->mm);
+  DECAF_span_get(&span, task_struct_mm_offset + sizeof(gva_t), &info->active_mm);
+  DECAF_span_get(&span, task_struct_cred_offset, &info->cred);
+  DECAF_span_get(&span, task_struct_tasks_offset, &info->next);
+  if (info->next != 0)
+  {
+    info->next -= task_struct_tasks_offset;
+  }
+  memcpy(info->comm, span.buf + task_struct_comm_offset - span.lo, commlen);
+  info->comm[commlen] = '\0';
+
+  return (0);
+}
+
+DECAF_errno_t DECAF_get_cred_info(CPUState* env, gva_t addr, DECAF_cred_info* info)
+{
+  DECAF_struct_span span;
+
+  DECAF_span_init(&span);
+  DECAF_span_add(&span, cred_uid_offset, sizeof(info->uid));
+  DECAF_span_add(&span, cred_gid_offset, sizeof(info->gid));
+  DECAF_span_add(&span, cred_euid_offset, sizeof(info->euid));
+  DECAF_span_add(&span, cred_egid_offset, sizeof(info->egid));
+
+  if ( (addr == 0) || (DECAF_read_span(env, addr, &span) != 0) )
+  {
+    return (-1);
+  }
+
+  DECAF_span_get(&span, cred_uid_offset, &info->uid);
+  DECAF_span_get(&span, cred_gid_offset, &info->gid);
+  DECAF_span_get(&span, cred_euid_offset, &info->euid);
+  DECAF_span_get(&span, cred_egid_offset, &info->egid);
+  return (0);
+}
+
+DECAF_errno_t DECAF_get_mm_info(CPUState* env, gva_t addr, DECAF_mm_info* info)
+{
+  DECAF_struct_span span;
+
+  DECAF_span_init(&span);
+  //mmap is the first field
+  DECAF_span_add(&span, 0, sizeof(info->mmap));
+  DECAF_span_add(&span, mm_struct_pgd_offset, sizeof(info->pgd));
+  DECAF_span_add(&span, mm_struct_mm_arg_start_offset, sizeof(info->arg_start));
+  DECAF_span_add(&span, mm_struct_start_brk_offset, sizeof(info->start_brk));
+  DECAF_span_add(&span, mm_struct_brk_offset, sizeof(info->brk));
+  DECAF_span_add(&span, mm_struct_start_stack_offset, sizeof(info->start_stack));
+
+  if ( (addr == 0) || (DECAF_read_span(env, addr, &span) != 0) )
+  {
+    return (-1);
+  }
+
+  DECAF_span_get(&span, 0, &info->mmap);
+  DECAF_span_get(&span, mm_struct_pgd_offset, &info->pgd);
+  DECAF_span_get(&span, mm_struct_mm_arg_start_offset, &info->arg_start);
+  DECAF_span_get(&span, mm_struct_start_brk_offset, &info->start_brk);
+  DECAF_span_get(&span, mm_struct_brk_offset, &info->brk);
+  DECAF_span_get(&span, mm_struct_start_stack_offset, &info->start_stack);
+  return (0);
+}
+
+DECAF_errno_t DECAF_get_vma_info(CPUState* env, gva_t addr, DECAF_vma_info* info)
+{
+  DECAF_struct_span span;
+
+  DECAF_span_init(&span);
+  DECAF_span_add(&span, vm_area_struct_vm_start_offset, sizeof(info->vm_start));
+  DECAF_span_add(&span, vm_area_struct_vm_end_offset, sizeof(info->vm_end));
+  DECAF_span_add(&span, vm_area_struct_vm_next_offset, sizeof(info->vm_next));
+  DECAF_span_add(&span, vm_area_struct_vm_file_offset, sizeof(info->vm_file));
+  DECAF_span_add(&span, vm_area_struct_vm_flags_offset, sizeof(info->vm_flags));
+
+  if ( (addr == 0) || (DECAF_read_span(env, addr, &span) != 0) )
+  {
+    return (-1);
+  }
+
+  DECAF_span_get(&span, vm_area_struct_vm_start_offset, &info->vm_start);
+  DECAF_span_get(&span, vm_area_struct_vm_end_offset, &info->vm_end);
+  DECAF_span_get(&span, vm_area_struct_vm_next_offset, &info->vm_next);
+  DECAF_span_get(&span, vm_area_struct_vm_file_offset, &info->vm_file);
+  DECAF_span_get(&span, vm_area_struct_vm_flags_offset, &info->vm_flags);
+  return (0);
+}
+
 gpa_t DECAF_get_pgd(CPUState* env, gva_t addr)
 {
-  gva_t mmaddr;
+  gva_t mmaddr[2] = {0, 0};
   gpa_t pgd;
-  DECAF_read_mem(env, addr + task_struct_mm_offset, &mmaddr, sizeof(mmaddr));
-  if (0 == mmaddr)
-    DECAF_read_mem(env, addr + task_struct_mm_offset + sizeof(mmaddr),
-                &mmaddr, sizeof(mmaddr));
+  //mm is 0 for kernel threads, which run on the active_mm that follows it
+  DECAF_read_mem(env, addr + task_struct_mm_offset, mmaddr, sizeof(mmaddr));
+  if (0 == mmaddr[0])
+    mmaddr[0] = mmaddr[1];
 
-  if (0 != mmaddr)
-    DECAF_read_mem(env, mmaddr + mm_struct_pgd_offset, &pgd, sizeof(pgd));
+  if (0 != mmaddr[0])
+    DECAF_read_mem(env, mmaddr[0] + mm_struct_pgd_offset, &pgd, sizeof(pgd));
   else
     memset(&pgd, 0, sizeof(pgd));
 
@@ -189,33 +314,37 @@ gpa_t DECAF_get_pgd(CPUState* env, gva_t addr)
 
 int DECAF_get_name(CPUState* env, gva_t addr, char *buf, int size)
 {
-  return (DECAF_read_mem(env, addr + task_struct_comm_offset,
-                buf, (size < size_of_task_struct_comm) ? size : size_of_task_struct_comm));
+  //comm is always terminated within size_of_task_struct_comm
+  if (DECAF_read_string(env, addr + task_struct_comm_offset,
+                buf, (size < size_of_task_struct_comm) ? size : size_of_task_struct_comm) < 0)
+  {
+    return (-1);
+  }
+  return (0);
+}
+
+DECAF_errno_t DECAF_get_mm_arg_name(CPUState* env, const DECAF_mm_info* mm, char* buf, int size)
+{
+  if (mm->arg_start != 0 && mm->pgd != 0)
+  {
+    return (DECAF_read_mem_with_pgd(env, mm->pgd & ~0xC0000000, mm->arg_start, buf, size));
+  }
+  else
+  {
+    return (-1);
+  }
 }
 
 int DECAF_get_arg_name(CPUState* env, gva_t addr, char* buf, int size)
 {
   gva_t mmaddr = 0;
-  gva_t argstart = 0;
-  gpa_t pgd = 0;
+  DECAF_mm_info mm;
   DECAF_read_mem(env, addr + task_struct_mm_offset, &mmaddr, sizeof(mmaddr));
-  if (mmaddr == 0)
+  if ( (mmaddr == 0) || (DECAF_get_mm_info(env, mmaddr, &mm) != 0) )
   {
     return (-1);
   }
-  else
-  {
-    DECAF_read_mem(env, mmaddr + mm_struct_pgd_offset, &pgd, sizeof(pgd));
-    DECAF_read_mem(env, mmaddr + mm_struct_mm_arg_start_offset, &argstart, sizeof(argstart));
-    if (argstart != 0 && pgd != 0)
-    {
-      return (DECAF_read_mem_with_pgd(env, pgd & ~0xC0000000, argstart, buf, size));
-    }
-    else
-    {
-      return (-1);
-    }
-  }
+  return (DECAF_get_mm_arg_name(env, &mm, buf, size));
 }
 
 gva_t DECAF_get_first_mmap(CPUState* env, gva_t task_addr)
@@ -243,14 +372,7 @@ void DECAF_get_dentry_iname(CPUState* env, gva_t dentry_addr, char* name, int si
   // looks like max size is 40, so we should use that
   uint32_t DNAME_INLINE_LEN = 40;
 
-  if (DECAF_memory_rw(env, dentry_addr + dentry_d_iname_offset, name, (size < DNAME_INLINE_LEN) ? size : DNAME_INLINE_LEN, 0) == 0)
-  {
-    name[(size < DNAME_INLINE_LEN) ? size - 1 : DNAME_INLINE_LEN - 1] = '\0';
-  }
-  else
-  {
-    name[0] = '\0';
-  }
+  DECAF_read_string(env, dentry_addr + dentry_d_iname_offset, name, (size < DNAME_INLINE_LEN) ? size : DNAME_INLINE_LEN);
 }
 
 void DECAF_get_dentry_dname(CPUState* env, gva_t dentry_addr, char *name, int size)
@@ -264,24 +386,24 @@ void DECAF_get_dentry_dname(CPUState* env, gva_t dentry_addr, char *name, int si
   //long len
   //char* name
 
+  gva_t qstr[2] = {0, 0}; //len and name
   gva_t len = 0;
-  gva_t qstr_name = 0;
 
   name[0] = '\0';
 
-  if ( (DECAF_memory_rw(env, dentry_addr + dentry_d_name_offset + sizeof(gva_t), &len,  sizeof(gva_t), 0) == -1)
-      || (DECAF_memory_rw(env, dentry_addr + dentry_d_name_offset + sizeof(gva_t) + sizeof(gva_t), &qstr_name,  sizeof(gva_t), 0) == -1)
-      )
+  if (DECAF_read_mem(env, dentry_addr + dentry_d_name_offset + sizeof(gva_t), qstr, sizeof(qstr)) != 0)
   {
     return;
   }
 
-  if (DECAF_memory_rw(env, qstr_name, name, (size < len) ? size : len, 0) == -1)
+  //the qstr has the length, so there is no need to look for the terminator
+  len = (qstr[0] < (gva_t)size) ? qstr[0] : size - 1;
+  if (DECAF_read_mem(env, qstr[1], name, len) != 0)
   {
     return;
   }
   //printf("found %uX bytes at 0x%X in dentry at 0x%X of name %s\n", len, dentry_addr + dentry_d_name_offset, dentry_addr, name);
-  name[(size < len) ? size - 1 : len] = '\0';
+  name[len] = '\0';
 }
 
 static gva_t PANDA_get_dentry(CPUState* env, gva_t addr){
@@ -399,6 +521,65 @@ inline size_t my_pathcat(char* dest, size_t destsize, const char* src)
   return (j);
 }
 
+/**
+ * Reads the parent of a dentry and its name - d_name if bDName is set, or the
+ * inline d_iname otherwise - with a single guest read of the dentry (plus one
+ * for the d_name string).
+ * Returns the parent, or 0 if the dentry couldn't be read
+ */
+static gva_t get_dentry_name_and_parent(CPUState* env, gva_t dentry_addr, int bDName, char* name, int size)
+{
+  //see DECAF_get_dentry_iname and DECAF_get_dentry_dname
+  const int DNAME_INLINE_LEN = 40;
+  DECAF_struct_span span;
+  gva_t parent = 0;
+  gva_t qstr[2] = {0, 0}; //len and name
+  int len = 0;
+  char* nul = NULL;
+
+  name[0] = '\0';
+
+  DECAF_span_init(&span);
+  DECAF_span_add(&span, dentry_d_parent_offset, sizeof(parent));
+  if (bDName)
+  {
+    DECAF_span_add(&span, dentry_d_name_offset + sizeof(gva_t), sizeof(qstr));
+  }
+  else
+  {
+    DECAF_span_add(&span, dentry_d_iname_offset, DNAME_INLINE_LEN);
+  }
+
+  if (DECAF_read_span(env, dentry_addr, &span) != 0)
+  {
+    return (0);
+  }
+  DECAF_span_get(&span, dentry_d_parent_offset, &parent);
+
+  if (bDName)
+  {
+    DECAF_span_get(&span, dentry_d_name_offset + sizeof(gva_t), &qstr);
+    len = (qstr[0] < (gva_t)size) ? qstr[0] : size - 1;
+    if (DECAF_read_mem(env, qstr[1], name, len) != 0)
+    {
+      len = 0;
+    }
+  }
+  else
+  {
+    len = (size - 1 < DNAME_INLINE_LEN) ? size - 1 : DNAME_INLINE_LEN - 1;
+    memcpy(name, span.buf + dentry_d_iname_offset - span.lo, len);
+    nul = memchr(name, '\0', len);
+    if (nul != NULL)
+    {
+      len = nul - name;
+    }
+  }
+  name[len] = '\0';
+
+  return (parent);
+}
+
 void DECAF_get_dentry_full_iname_path(CPUState* env, gva_t dentry_addr, char* name, int size)
 {
   //do post order recursion?
@@ -410,14 +591,13 @@ void DECAF_get_dentry_full_iname_path(CPUState* env, gva_t dentry_addr, char* na
 
   name[0] = '\0';
 
-  DECAF_get_dentry_iname(env, dentry_addr, temp, 128);
+  gva_t parent = get_dentry_name_and_parent(env, dentry_addr, 0, temp, 128);
 
   if ( (temp[0] == '\0') || ((temp[0] == '/') && (temp[1] == '\0')) )
   {
     return;
   }
 
-  gva_t parent = DECAF_get_dentry_d_parent(env, dentry_addr);
   if (parent == 0)
   {
     return;
@@ -430,18 +610,14 @@ void DECAF_get_dentry_full_iname_path(CPUState* env, gva_t dentry_addr, char* na
   my_pathcat(name, size, temp);
 }
 
-void DECAF_get_dentry_full_dname_path(CPUState* env, gva_t dentry_addr, char* name, int size, gva_t vfs_addr)
+static void get_dentry_full_dname_path(CPUState* env, gva_t dentry_addr, char* name, int size, gva_t mnt_root)
 {
   //do post order recursion?
   char temp[128] = "";
-  if (name == NULL)
-  {
-    return;
-  }
 
   name[0] = '\0';
 
-  DECAF_get_dentry_dname(env, dentry_addr, temp, 128);
+  gva_t parent = get_dentry_name_and_parent(env, dentry_addr, 1, temp, 128);
 
   if ( (temp[0] == '\0') || ((temp[0] == '/') && (temp[1] == '\0')) )
   {
@@ -449,26 +625,37 @@ void DECAF_get_dentry_full_dname_path(CPUState* env, gva_t dentry_addr, char* na
   }
   //printf("found initial dentry name %s\n", temp);
 
-  gva_t parent = DECAF_get_dentry_d_parent(env, dentry_addr);
   if (parent == 0)
   {
     return;
   }
-  // check if dentry_addr == vfsmnt.mnt_root
-  //vfsmnt = file.f_path.vfsmnt
-  gva_t mnt_root;
-  DECAF_memory_rw(env, vfs_addr + vfsmount_mnt_root_offset, &mnt_root, sizeof(mnt_root), 0);
   if (dentry_addr == mnt_root){
      printf("MATCHING DENTRY AND ROOT\n"); 
   }
 
   //get parent's name here
-  DECAF_get_dentry_full_dname_path(env, parent, name, size, vfs_addr);
+  get_dentry_full_dname_path(env, parent, name, size, mnt_root);
 
   //now append the current name
   my_pathcat(name, size, temp);
 }
 
+void DECAF_get_dentry_full_dname_path(CPUState* env, gva_t dentry_addr, char* name, int size, gva_t vfs_addr)
+{
+  if (name == NULL)
+  {
+    return;
+  }
+
+  // check if dentry_addr == vfsmnt.mnt_root
+  //vfsmnt = file.f_path.vfsmnt
+  //it is the same for the whole path, so it is only read once
+  gva_t mnt_root = 0;
+  DECAF_read_mem(env, vfs_addr + vfsmount_mnt_root_offset, &mnt_root, sizeof(mnt_root));
+
+  get_dentry_full_dname_path(env, dentry_addr, name, size, mnt_root);
+}
+
 void DECAF_get_mod_full_iname(CPUState* env, gva_t addr, char* name, int size)
 {
   gva_t dentry = PANDA_get_dentry(env, addr);
@@ -25,6 +25,7 @@
 #define DECAF_LINUX_VMI_H
 
 //#include "DECAF_main.h"
+#include <limits.h>
 #include "qemu-common.h"
 #include "DECAF_types.h"
 #include "panda_wrapper.h"
@@ -286,6 +287,144 @@ IMPLEMENT_2LEVEL_GETTER(target_long, DECAF_get_group_leader_pid, task_struct_add
 IMPLEMENT_2LEVEL_GETTER(target_long, DECAF_get_parent_pid, task_struct_addr, gva_t, DECAF_get_real_parent, 0, DECAF_get_pid, -1)
 
 
+/**
+ * The getters above read one field per guest read, and each read translates
+ * the address again. The functions below read all of the fields we use from
+ * a struct in one go instead, by copying the span of the struct that covers
+ * them. A span is described by the lowest and highest offsets it must cover.
+ * The largest struct we read this way is the task_struct (~1000 bytes on the
+ * kernels we support), so a page is plenty.
+**/
+#define DECAF_STRUCT_SPAN_MAX 4096
+
+typedef struct _DECAF_struct_span
+{
+  int lo;
+  int hi;
+  uint8_t buf[DECAF_STRUCT_SPAN_MAX];
+} DECAF_struct_span;
+
+/**
+ * Empties the span, so that DECAF_span_add can be used to grow it
+**/
+static inline void DECAF_span_init(DECAF_struct_span* span)
+{
+  span->lo = INT_MAX;
+  span->hi = INT_MIN;
+}
+
+/**
+ * Makes sure the span covers size bytes at offset
+**/
+static inline void DECAF_span_add(DECAF_struct_span* span, int offset, int size)
+{
+  if (offset < span->lo)
+  {
+    span->lo = offset;
+  }
+  if (offset + size > span->hi)
+  {
+    span->hi = offset + size;
+  }
+}
+
+/**
+ * Copies the span of the struct at struct_addr
+ * Returns 0 if successful, -1 if it couldn't be read or is too large
+**/
+int DECAF_read_span(CPUState* env, gva_t struct_addr, DECAF_struct_span* span);
+
+/**
+ * Copies the field at _offset out of a span that has been read, into *(_ptr)
+**/
+#define DECAF_span_get(_span, _offset, _ptr) \
+  memcpy((_ptr), (_span)->buf + (_offset) - (_span)->lo, sizeof(*(_ptr)))
+
+#define DECAF_TASK_COMM_LEN 32
+
+/**
+ * The fields of a task_struct that the process list is built from
+**/
+typedef struct _DECAF_task_info
+{
+  gpid_t pid;
+  target_long tgid;
+  gva_t group_leader;
+  gva_t real_parent;
+  gva_t thread_group; //the next pointer of the thread_group list
+  gva_t stack;
+  gva_t mm;
+  gva_t active_mm;
+  gva_t cred;
+  gva_t next; //the next task_struct in the task list
+  char comm[DECAF_TASK_COMM_LEN];
+} DECAF_task_info;
+
+/**
+ * The fields of a cred struct
+**/
+typedef struct _DECAF_cred_info
+{
+  target_long uid;
+  target_long gid;
+  target_long euid;
+  target_long egid;
+} DECAF_cred_info;
+
+/**
+ * The fields of a mm_struct
+**/
+typedef struct _DECAF_mm_info
+{
+  gva_t mmap; //the first vm_area_struct
+  gpa_t pgd;
+  gva_t arg_start;
+  gva_t start_brk;
+  gva_t brk;
+  gva_t start_stack;
+} DECAF_mm_info;
+
+/**
+ * The fields of a vm_area_struct
+**/
+typedef struct _DECAF_vma_info
+{
+  gva_t vm_start;
+  gva_t vm_end;
+  gva_t vm_next;
+  gva_t vm_file;
+  target_ulong vm_flags;
+} DECAF_vma_info;
+
+/**
+ * Reads the fields of the task_struct at task_struct_addr with a single guest read
+ * Returns 0 if successful, -1 otherwise
+**/
+DECAF_errno_t DECAF_get_task_info(CPUState* env, gva_t task_struct_addr, DECAF_task_info* info);
+
+/**
+ * Reads the fields of the cred struct at cred_addr with a single guest read
+ * Returns 0 if successful, -1 otherwise
+**/
+DECAF_errno_t DECAF_get_cred_info(CPUState* env, gva_t cred_addr, DECAF_cred_info* info);
+
+/**
+ * Reads the fields of the mm_struct at mm_struct_addr with a single guest read
+ * Returns 0 if successful, -1 otherwise
+**/
+DECAF_errno_t DECAF_get_mm_info(CPUState* env, gva_t mm_struct_addr, DECAF_mm_info* info);
+
+/**
+ * Reads the fields of the vm_area_struct at vma_addr with a single guest read
+ * Returns 0 if successful, -1 otherwise
+**/
+DECAF_errno_t DECAF_get_vma_info(CPUState* env, gva_t vma_addr, DECAF_vma_info* info);
+
+/**
+ * Same as DECAF_get_arg_name, for a mm_struct that has already been read
+**/
+DECAF_errno_t DECAF_get_mm_arg_name(CPUState* env, const DECAF_mm_info* mm, char* buf, int size);
+
 /**
  * Looks for the current task_struct (the one associated with the current ThreadInfo)
  * in the current kernel stack. Keep in mind that the task_struct is a THREAD task_struct
@@ -368,6 +368,25 @@ void DECAF_flushTranslationPage_env(CPUState* env, gva_t addr)
 #endif
 }
 
+void DECAF_flushTranslationBlocksInRange(gva_t start, gva_t end)
+{
+  TranslationBlock *tb, *next;
+  unsigned int h;
+
+  //Every TB is in exactly one phys hash chain, so this visits each of them
+  // once no matter how many are invalidated. tb_phys_invalidate only unlinks
+  // the TB from its chain, so next is still good afterwards.
+  for (h = 0; h < CODE_GEN_PHYS_HASH_SIZE; h++) {
+    for (tb = tb_phys_hash[h]; tb != NULL; tb = next) {
+      next = tb->phys_hash_next;
+      //tb->pc already includes the CS base on x86
+      if ((tb->pc >= start) && (tb->pc < end)) {
+        tb_phys_invalidate(tb, -1);
+      }
+    }
+  }
+}
+
 int do_load_plugin(Monitor *mon, const QDict *qdict, QObject **ret_data)
 {
     DECAF_do_load_plugin_internal(mon, qdict_get_str(qdict, "filename"));
@@ -781,23 +800,89 @@ int DECAF_bdrv_pread(void *bs, int64_t offset, void *buf, int count)
 
 #else // DECAF or PANDA backend: PANDA
 #include "panda_wrapper.h"
+
+uint64_t DECAF_mem_reads = 0;
+
+/**
+ * Returns how many bytes from vaddr can be read before the end of its page,
+ * capped at len
+ */
+static inline size_t DECAF_page_chunk(gva_t vaddr, size_t len)
+{
+  size_t l = TARGET_PAGE_SIZE - (vaddr & ~TARGET_PAGE_MASK);
+  return ((l < len) ? l : len);
+}
+
 int DECAF_read_mem_until(CPUState* env, gva_t vaddr, void* buf, size_t len)
 {
-  int i = 0;
-  int ret = 0;
+  size_t i = 0;
+  size_t l = 0;
 
   if (buf == NULL)
   {
     return (NULL_POINTER_ERROR);
   }
 
-  for (i = 0; i < len; i++)
+  //a page is either mapped or not, so there is no need to go byte by byte
+  while (i < len)
   {
-    ret = DECAF_read_mem(env, vaddr + i, buf + i, 1);
-    if (ret != 0)
+    l = DECAF_page_chunk(vaddr + i, len - i);
+    if (DECAF_read_mem(env, vaddr + i, (uint8_t*)buf + i, l) != 0)
+    {
+      break;
+    }
+    i += l;
+  }
+  return (i);
+}
+
+int DECAF_read_string(CPUState* env, gva_t vaddr, char* buf, size_t size)
+{
+  size_t i = 0;
+  size_t l = 0;
+  uint8_t* host = NULL;
+  uint8_t* nul = NULL;
+
+  if ( (buf == NULL) || (size == 0) )
+  {
+    return (NULL_POINTER_ERROR);
+  }
+
+  while ( (i < size - 1) && (nul == NULL) )
+  {
+    l = DECAF_page_chunk(vaddr + i, size - 1 - i);
+    //look for the terminator in guest RAM itself when we can, so only the
+    // string is copied out; otherwise copy the rest of the page and look there
+    host = panda_virt_to_host(env, vaddr + i, l);
+    if (host != NULL)
+    {
+      DECAF_mem_reads++;
+    }
+    else if (DECAF_read_mem(env, vaddr + i, buf + i, l) == 0)
+    {
+      host = (uint8_t*)buf + i;
+    }
+    else
     {
       break;
     }
+
+    nul = memchr(host, '\0', l);
+    if (nul != NULL)
+    {
+      l = nul - host;
+    }
+    if (host != (uint8_t*)buf + i)
+    {
+      memcpy(buf + i, host, l);
+    }
+    i += l;
+  }
+
+  buf[i] = '\0';
+  if ( (i == 0) && (nul == NULL) )
+  {
+    return (-1);
   }
   return (i);
 }
@@ -394,6 +394,17 @@ void DECAF_flushTranslationBlock_env(CPUState* env, gva_t addr);
  */
 void DECAF_flushTranslationPage_env(CPUState* env, gva_t addr);
 
+/**
+ * Flush - or invalidate - every translation block that starts in [start, end),
+ * whatever its flags or physical page, and nothing else. Unlike the two above
+ * this doesn't need a block to exist at a given address, and it walks the
+ * translation blocks once for the whole range.
+ *
+ * @param start The first virtual address
+ * @param end One past the last virtual address
+ */
+void DECAF_flushTranslationBlocksInRange(gva_t start, gva_t end);
+
 //These are DECAF wrappers that does flushing for all VCPUs
 
 //Iterates through all virtual cpus and flushes the blocks
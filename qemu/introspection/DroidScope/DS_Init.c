@@ -23,6 +23,7 @@
 
 #include "DroidScope/DS_Init.h"
 #include "DroidScope/DS_Common.h"
+#include "DroidScope/LinuxAPI.h"
 #include <stdlib.h>
 
 void DS_init(void)
@@ -37,7 +38,9 @@ void DS_init(void)
 }
 
 void DS_close(void)
-{/*
+{
+  context_close();
+  /*
   DalvikMterpOpcodes_close();
   DalvikDisableJit_close();*/
 }
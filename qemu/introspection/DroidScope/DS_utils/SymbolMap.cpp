@@ -24,6 +24,12 @@
 
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include "DS_Common.h"
 #include "DS_utils/SymbolMap.h"
 #include "introspection/utils/HelperFunctions.h"
@@ -31,6 +37,15 @@
 
 using namespace std;
 
+SymbolMap::SymbolMap() : pEntries(NULL), numEntries(0), pArena(NULL), arenaSize(0), indexVersion(0), pMapping(NULL), mappingSize(0)
+{
+}
+
+SymbolMap::~SymbolMap()
+{
+  unmapIndex();
+}
+
 bool SymbolMap::isObjdumpTextLine(const string& str)
 {
   //return (str.find(".text") != string::npos);
@@ -137,7 +152,7 @@ int SymbolMap::processObjdumpFile(const std::string& filename)
     {
       continue;
     }
-    symbols[add] = sym;
+    addSymbol(add, sym);
   }
 
   tempFile.close();
@@ -253,7 +268,7 @@ int SymbolMap::processDexdumpFile(const std::string& filename)
       sym += phis.at(7).substr(loc + 2);
     }
     //cout << phis.at(6) << " == " << phis.at(7) << " == " << sym << endl;
-    symbols[add] = sym;
+    addSymbol(add, sym);
   }
 
   tempFile.close();
@@ -261,48 +276,270 @@ int SymbolMap::processDexdumpFile(const std::string& filename)
 }
 
 
-gva_t SymbolMap::getSymbolAddress(const char* str)
+void SymbolMap::unmapIndex()
 {
-  gva_t ret = INV_ADDR;
-  if (str == NULL)
+  if (pMapping != NULL)
   {
-    return (ret);
+    munmap(pMapping, mappingSize);
+    pMapping = NULL;
+    mappingSize = 0;
+    pEntries = NULL;
+    numEntries = 0;
+    pArena = NULL;
+    arenaSize = 0;
   }
+}
 
-  _map::const_iterator it;
+static bool entryLess(const SymbolEntry& a, const SymbolEntry& b)
+{
+  return (a.offset < b.offset);
+}
 
-  for (it = symbols.begin(); it != symbols.end(); it++)
+void SymbolMap::buildIndex()
+{
+  //if we are using a mapped index then fold it into the map first
+  // so the new symbols are added to it instead of replacing it
+  if (pMapping != NULL)
   {
-    if (it->second.compare(str) == 0)
+    for (size_t i = 0; i < numEntries; i++)
     {
-      ret = it->first;
-      break;
+      if (symbols.find(pEntries[i].offset) == symbols.end())
+      {
+        symbols[pEntries[i].offset] = getName(&pEntries[i]);
+      }
     }
+    unmapIndex();
+  }
+
+  entries.clear();
+  arena.clear();
+  byName.clear();
+  entries.reserve(symbols.size());
+
+  _map::const_iterator it;
+  for (it = symbols.begin(); it != symbols.end(); it++)
+  {
+    SymbolEntry e;
+    e.offset = it->first;
+    e.nameOffset = arena.size();
+    arena.insert(arena.end(), it->second.begin(), it->second.end());
+    arena.push_back('\0');
+    entries.push_back(e);
+  }
+  std::sort(entries.begin(), entries.end(), entryLess);
+
+  pEntries = entries.empty() ? NULL : &entries[0];
+  numEntries = entries.size();
+  pArena = arena.empty() ? NULL : &arena[0];
+  arenaSize = arena.size();
+  indexVersion = symbolsVersion;
+}
+
+/**
+ * Returns the entry with the largest offset that is <= address, or NULL.
+ * The loop has no data dependent branches so the only cost is the
+ * log2(n) loads.
+ */
+const SymbolEntry* SymbolMap::findEntry(gva_t address)
+{
+  const SymbolEntry* pBase = getIndex();
+  size_t n = numEntries;
+
+  if ( (n == 0) || (address < pBase->offset) )
+  {
+    return (NULL);
+  }
+
+  while (n > 1)
+  {
+    size_t half = n / 2;
+    pBase = (pBase[half].offset <= address) ? pBase + half : pBase;
+    n -= half;
   }
 
+  return (pBase);
+}
+
+bool SymbolMap::symbolExists(gva_t address)
+{
+  const SymbolEntry* pEntry = findEntry(address);
+  return ( (pEntry != NULL) && (pEntry->offset == address) );
+}
+
+int SymbolMap::getSymbol(std::string& str, gva_t address)
+{
+  const SymbolEntry* pEntry = findEntry(address);
+  if ( (pEntry == NULL) || (pEntry->offset != address) )
+  {
+    return (ITEM_NOT_FOUND_ERROR);
+  }
+  str = getName(pEntry);
+  return (0);
+}
+
+int SymbolMap::saveSymbolIndex(const std::string& filename)
+{
+  const SymbolEntry* pIndex = getIndex();
+
+  FILE* fp = fopen(filename.c_str(), "wb");
+  if (fp == NULL)
+  {
+    return (FILE_OPEN_ERROR);
+  }
+
+  SymbolIndexHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, SYMBOL_INDEX_MAGIC, sizeof(header.magic));
+  header.version = SYMBOL_INDEX_VERSION;
+  header.numEntries = numEntries;
+  header.arenaSize = arenaSize;
+
+  int ret = 0;
+  if ( (fwrite(&header, sizeof(header), 1, fp) != 1)
+       || ( (numEntries != 0) && (fwrite(pIndex, sizeof(SymbolEntry), numEntries, fp) != numEntries) )
+       || ( (header.arenaSize != 0) && (fwrite(pArena, 1, header.arenaSize, fp) != header.arenaSize) )
+     )
+  {
+    ret = -1;
+  }
+
+  if (fclose(fp) != 0)
+  {
+    ret = -1;
+  }
   return (ret);
 }
 
-int SymbolMap::getNearestSymbol(std::string& str, gva_t address)
+int SymbolMap::mapSymbolIndex(const std::string& filename)
 {
-  _map::const_iterator it;
-  _map::const_iterator it2 = symbols.end();
-  gva_t curNearest = 0;
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    return (FILE_OPEN_ERROR);
+  }
 
-  for (it = symbols.begin(); it != symbols.end(); it++)
+  struct stat st;
+  if ( (fstat(fd, &st) != 0) || ((size_t)st.st_size < sizeof(SymbolIndexHeader)) )
+  {
+    close(fd);
+    return (-1);
+  }
+
+  void* p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (p == MAP_FAILED)
+  {
+    return (-1);
+  }
+
+  //make sure the file is what we expect before using it
+  const SymbolIndexHeader* pHeader = (const SymbolIndexHeader*)p;
+  size_t expected = sizeof(SymbolIndexHeader) + (size_t)pHeader->numEntries * sizeof(SymbolEntry) + pHeader->arenaSize;
+  const char* pNames = (const char*)p + sizeof(SymbolIndexHeader) + (size_t)pHeader->numEntries * sizeof(SymbolEntry);
+  if ( (memcmp(pHeader->magic, SYMBOL_INDEX_MAGIC, sizeof(pHeader->magic)) != 0)
+       || (pHeader->version != SYMBOL_INDEX_VERSION)
+       || ((size_t)st.st_size != expected)
+       || ( (pHeader->arenaSize != 0) && (pNames[pHeader->arenaSize - 1] != '\0') )
+     )
+  {
+    munmap(p, st.st_size);
+    return (-1);
+  }
+
+  const SymbolEntry* pIndex = (const SymbolEntry*)(pHeader + 1);
+  for (uint32_t i = 0; i < pHeader->numEntries; i++)
+  {
+    if ( (pIndex[i].nameOffset >= pHeader->arenaSize)
+         || ( (i != 0) && (pIndex[i].offset < pIndex[i-1].offset) )
+       )
+    {
+      munmap(p, st.st_size);
+      return (-1);
+    }
+  }
+
+  unmapIndex();
+  symbols.clear();
+  entries.clear();
+  arena.clear();
+  byName.clear();
+
+  pMapping = p;
+  mappingSize = st.st_size;
+  pEntries = (pHeader->numEntries == 0) ? NULL : pIndex;
+  numEntries = pHeader->numEntries;
+  pArena = pNames;
+  arenaSize = pHeader->arenaSize;
+  indexVersion = symbolsVersion;
+  return (0);
+}
+
+//Sorts entry indices by name, ties stay in offset order
+struct SymbolNameLess
+{
+  const SymbolEntry* pEntries;
+  const char* pArena;
+  bool operator()(uint32_t a, uint32_t b) const
   {
-    if ( (address >= it->first) && (it->first > curNearest) )
+    return (strcmp(pArena + pEntries[a].nameOffset, pArena + pEntries[b].nameOffset) < 0);
+  }
+};
+
+//Compares an entry index to a name for the binary search
+struct SymbolNameKeyLess
+{
+  const SymbolEntry* pEntries;
+  const char* pArena;
+  bool operator()(uint32_t a, const char* str) const
+  {
+    return (strcmp(pArena + pEntries[a].nameOffset, str) < 0);
+  }
+};
+
+gva_t SymbolMap::getSymbolAddress(const char* str)
+{
+  gva_t ret = INV_ADDR;
+  if (str == NULL)
+  {
+    return (ret);
+  }
+
+  const SymbolEntry* pIndex = getIndex();
+  if (numEntries == 0)
+  {
+    return (ret);
+  }
+
+  //lookups by name are rare so the name order is only built on demand
+  if (byName.size() != numEntries)
+  {
+    byName.resize(numEntries);
+    for (size_t i = 0; i < numEntries; i++)
     {
-      it2 = it;
-      curNearest = it->first;
+      byName[i] = i;
     }
+    SymbolNameLess less = { pIndex, pArena };
+    std::stable_sort(byName.begin(), byName.end(), less);
   }
 
-  if (it2 == symbols.end()) //this should never happen
+  SymbolNameKeyLess keyLess = { pIndex, pArena };
+  std::vector<uint32_t>::const_iterator it = std::lower_bound(byName.begin(), byName.end(), str, keyLess);
+  if ( (it != byName.end()) && (strcmp(getName(pIndex + *it), str) == 0) )
+  {
+    ret = pIndex[*it].offset;
+  }
+
+  return (ret);
+}
+
+int SymbolMap::getNearestSymbol(std::string& str, gva_t address)
+{
+  const SymbolEntry* pEntry = findEntry(address);
+  if (pEntry == NULL)
   {
     return (-1);
   }
 
-  str = it2->second;
+  str = getName(pEntry);
   return (0);
 }
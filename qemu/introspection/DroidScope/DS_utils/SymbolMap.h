@@ -25,12 +25,49 @@
 #ifndef SYMBOLMAP_H_
 #define SYMBOLMAP_H_
 
+#include <vector>
 #include "utils/TULStringMapWrapper.h"
 
+/**
+ * Header of a precomputed symbol index file (see saveSymbolIndex).
+ * It is followed by numEntries SymbolEntry's sorted by offset and then
+ * arenaSize bytes of NUL terminated names. Integers are in host byte order.
+ */
+#define SYMBOL_INDEX_MAGIC "DSSYMIDX"
+#define SYMBOL_INDEX_VERSION 1
+
+typedef struct _SymbolIndexHeader
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t numEntries;
+  uint32_t arenaSize;
+  uint32_t reserved;
+} SymbolIndexHeader;
+
+/**
+ * One symbol in the flat index. Offsets are module relative so
+ * 32 bits are enough (ModuleInfo only looks up uint32_t offsets anyways).
+ * The name is at nameOffset in the string arena.
+ */
+typedef struct _SymbolEntry
+{
+  uint32_t offset;
+  uint32_t nameOffset;
+} SymbolEntry;
+
+/**
+ * The symbols map inherited from TULStringMap is only used for building up
+ * the symbols, lookups all go through a flat array of SymbolEntry's sorted by
+ * offset and a single string arena. The array is rebuilt the first time it is
+ * needed after the symbols change. It can also be mapped straight from a
+ * precomputed index file, in which case the symbols map stays empty.
+ */
 class SymbolMap : public TULStringMap
 {
 public:
-  SymbolMap() {}
+  SymbolMap();
+  ~SymbolMap();
   bool isObjdumpTextLine(const std::string& str);
   int getInfoFromObjdumpLine(const std::string& str, gva_t& add, std::string& sym);
   int processObjdumpFile(const std::string& filename);
@@ -39,6 +76,57 @@ public:
   int processDexdumpFile(const std::string& filename);
   gva_t getSymbolAddress(const char* str);
   int getNearestSymbol(std::string& str, gva_t address);
+  //These hide the TULStringMap versions so they use the index as well
+  bool symbolExists(gva_t address);
+  int getSymbol(std::string& str, gva_t address);
+
+  /**
+   * Writes the index out so it can be mapped with mapSymbolIndex later.
+   */
+  int saveSymbolIndex(const std::string& filename);
+  /**
+   * mmaps a file written by saveSymbolIndex and uses it as the index,
+   * replacing all current symbols.
+   */
+  int mapSymbolIndex(const std::string& filename);
+
+protected:
+  void buildIndex();
+  void unmapIndex();
+  const SymbolEntry* findEntry(gva_t address);
+
+  const SymbolEntry* getIndex()
+  {
+    if (indexVersion != symbolsVersion)
+    {
+      buildIndex();
+    }
+    return (pEntries);
+  }
+
+  const char* getName(const SymbolEntry* pEntry)
+  {
+    return (pArena + pEntry->nameOffset);
+  }
+
+  //pEntries and pArena point either into the vectors or into the mapping
+  const SymbolEntry* pEntries;
+  size_t numEntries;
+  const char* pArena;
+  size_t arenaSize;
+  std::vector<SymbolEntry> entries;
+  std::vector<char> arena;
+  //the indices of the entries sorted by name, only built for getSymbolAddress
+  std::vector<uint32_t> byName;
+  unsigned long indexVersion;
+
+  void* pMapping;
+  size_t mappingSize;
+
+private:
+  //the pointers above would be shared
+  SymbolMap(const SymbolMap&);
+  SymbolMap& operator=(const SymbolMap&);
 };
 
 #endif /* SYMBOLMAP_H_ */
@@ -86,6 +86,7 @@ typedef struct _ProcessInfo
   char strName[MAX_PROCESS_INFO_NAME_LEN];
   char strComm[MAX_TASK_COMM_LEN];
   ModuleNode* modules;
+  void* moduleTable; //sorted array of the module ranges for lookups by address, rebuilt from modules on demand
   ThreadNode* threads;
 } ProcessInfo;
 
@@ -120,6 +121,16 @@ gva_t updateProcessListByTask(CPUState* env, gva_t task, int updateMask, int bNe
  */
 void updateProcessList(CPUState* env, gva_t pgd, int updateMask);
 
+/**
+ * Sets up the shadow process list and the callbacks that keep it up to date
+ */
+void context_init(void);
+
+/**
+ * Clears the callbacks and prints statistics on how the process list was updated
+ */
+void context_close(void);
+
 /**
  * Returns the PID of the currently executing task
  * @return PID of the currently executing task - according to the shadow list
@@ -28,6 +28,12 @@
  *       - Anything NOT in the NEW one but in the old one has ended
  * 3. The same procedure is used to udpate the modules. The only difference is 
  *      that modules are updated on demand.
+ * 4. Walking the whole task list reads a lot of guest memory, so it is no longer
+ *      done on every PGD write. Fork, clone, exec and mmap returns update just the
+ *      tasks and modules they affect, and a PGD write only looks up the new PGD in
+ *      the shadow list. The full walk is done when the PGD isn't in the list, and
+ *      every CONTEXT_RESYNC_INTERVAL PGD writes as a consistency check - which is
+ *      also what notices processes that have exited.
  * NOTE: We assume a small number of processes and thus assume that linear
  *   search is perfectly fine. This is different from the PROCMOD approach
  *   that uses multiple hashtables. Hashtables can also be implemented here
@@ -48,6 +54,7 @@
 #include "introspection/DECAF_callback.h"
 #include "introspection/utils/SimpleCallback.h"
 #include "introspection/utils/OutputWrapper.h"
+#include "qemu-timer.h"
 
 gpid_t curProcessPID = (-1);
 static gpa_t curProcessPGD = 0;
@@ -66,6 +73,25 @@ int bSkipNextPGDUpdate = 0;
 static DECAF_Handle contextBBHandle;
 static DECAF_Handle contextCSHandle;
 
+//Set to 0 to walk the whole task list on every PGD write, like we used to.
+// -panda-arg droidscope:context=full does that, for comparing the stats.
+int bContextIncremental = 1;
+#define CONTEXT_RESYNC_INTERVAL 1000
+static unsigned int pgdWritesSinceWalk = 0;
+
+typedef struct _ContextStats
+{
+  uint64_t pgdWrites; //PGD write callbacks
+  uint64_t pgdWriteReads; //guest memory reads made while handling them
+  uint64_t pgdHits; //the new PGD was already in the shadow list
+  uint64_t fullWalks; //walks of the whole task list
+  uint64_t resyncs; //of those, periodic consistency checks
+  uint64_t events; //fork, clone, exec and mmap returns
+  uint64_t eventReads; //guest memory reads made while handling them
+} ContextStats;
+
+static ContextStats contextStats;
+
 /************************************************************************
  * Start of implementation section for "Callbacks"
  ************************************************************************/
@@ -95,113 +121,175 @@ DECAF_errno_t DECAF_Processes_unregister_callback(DECAF_Processes_callback_type_
  * Start of implementation section for updating process and module structures
  ************************************************************************/
 
-void updateProcessModuleList(CPUState* env, gpid_t pid)
+/**
+ * Updates the module for one vm_area_struct in the shadow list.
+ * @param vma The vm_area_struct at mmap_i, already read
+ * @param mm The owning mm_struct - its brk and stack are used to name
+ *   anonymous regions [heap] and [stack]
+ */
+static void updateModuleByVMA(CPUState* env, gpid_t pid, gva_t mmap_i, const DECAF_vma_info* vma, const DECAF_mm_info* mm)
 {
   DECAF_Processes_Callback_Params params;
-  target_ulong task = 0;
-  target_ulong i = 0;
   char name[MAX_PROCESS_INFO_NAME_LEN];
+  target_ulong vmfile = 0;
+  target_ulong flags = 0;
+  target_ulong vmstart = 0;
+  target_ulong vmend = 0;
 
-  if (pid == 0)
+  vmstart = vma->vm_start;
+  vmend = vma->vm_end;
+  flags = vma->vm_flags;
+
+  //from mm.h
+  //#define VM_READ         0x00000001      /* currently active flags */
+  //#define VM_WRITE        0x00000002
+  //#define VM_EXEC         0x00000004
+  //#define VM_SHARED       0x00000008
+
+  vmfile = vma->vm_file;
+  //printf("looking at vmfile at 0x%X\n", vmfile);
+  if (vmfile != 0)
+  {
+    //get_mod_dname(mmap_i, name, 128);
+    DECAF_get_mod_full_dname(env, mmap_i, name, 128);
+    //printf("found dname %s\n", name);
+  }
+  else
+  {
+    name[0] = '\0';
+    //get_mod_iname(mmap_i, name, 128);
+    DECAF_get_mod_full_iname(env, mmap_i, name, 128);
+    if (strlen(name) <= 0)
+    {
+      if (vmstart <= mm->start_brk && vmend >= mm->brk)
+      {
+        sprintf(name, "[heap]");
+      }
+      else if (vmstart <= mm->start_stack && vmend >= mm->start_stack)
+      {
+        sprintf(name, "[stack]");
+      }
+    } else {
+     //printf("found iname %s\n", name);   
+    }
+  }
+
+  int ret = updateModule(pid, vmstart, vmend, flags, name);
+  if (ret == 0xF) //if this is a new module
+  {
+    params.lm.pid = pid;
+    params.lm.pgd = getCurrentPGD();
+    params.lm.name = name; //TODO: THIS IS NOT THREAD SAFE!!!
+    params.lm.full_name = name;
+    params.lm.base = vmstart;
+    params.lm.size = vmend-vmstart;
+    SimpleCallback_dispatch(&DroidScope_callbacks[DECAF_PROCESSES_LOAD_MODULE_CB], &params);
+  }
+  else if (ret > 0)
+  {
+    params.mu.pid = pid;
+    params.mu.startAddr = vmstart;
+    params.mu.mask = ret;
+    SimpleCallback_dispatch(&DroidScope_callbacks[DECAF_PROCESSES_MODULES_UPDATED_CB], &params);
+  }
+}
+
+/**
+ * Walks all of the task's vm_area_structs and updates its modules
+ */
+static void updateModulesByTask(CPUState* env, gpid_t pid, gva_t task)
+{
+  DECAF_mm_info mm;
+  DECAF_vma_info vma;
+
+  //the brk and stack are per mm_struct, so only read them once
+  if (DECAF_get_mm_info(env, DECAF_get_mm(env, task), &mm) != 0)
   {
     return;
   }
 
-  task = DECAF_get_current_process(env);
-  i = task;
+  target_ulong mmap_first = mm.mmap;
+  target_ulong mmap_i = mmap_first;
+  //printf("looking at the mmap at 0x%X\n", mmap_first);
   do
   {
-    if (pid == DECAF_get_pid(env, i))
+    if (DECAF_get_vma_info(env, mmap_i, &vma) != 0)
     {
       break;
     }
-    i = DECAF_get_next_task_struct(env, i);
-  } while ( (i != 0) && (i != task) );
+    updateModuleByVMA(env, pid, mmap_i, &vma, &mm);
+    mmap_i = vma.vm_next;
+  } while ((mmap_i != 0) && (mmap_i != mmap_first));
+}
+
+/**
+ * Updates only the module containing addr, e.g. a region that was just mapped.
+ * The vm_area_structs are sorted by address, so this stops at the first one
+ * that ends after it.
+ */
+static void updateModuleByAddress(CPUState* env, gpid_t pid, gva_t task, gva_t addr)
+{
+  DECAF_mm_info mm;
+  DECAF_vma_info vma;
 
-  if ((i == 0) || (i == task))
+  if (DECAF_get_mm_info(env, DECAF_get_mm(env, task), &mm) != 0)
   {
     return;
   }
-  /*if(pid == 31){
-      //printf("finding strings for task at 0x%X\n", i);
-  } else return;*/
 
-  target_ulong mmap_first = DECAF_get_first_mmap(env, i);
+  target_ulong mmap_first = mm.mmap;
   target_ulong mmap_i = mmap_first;
-  target_ulong vmfile = 0;
-  target_ulong flags = 0;
-  target_ulong vmstart = 0;
-  target_ulong vmend = 0;
-  target_ulong startbrk = 0;
-  target_ulong brk = 0;
-  target_ulong startstack = 0;
-  target_ulong mm = 0;
-  //printf("looking at the mmap at 0x%X\n", mmap_first);
+
   do
   {
-    vmstart = DECAF_get_vm_start(env, mmap_i);
-    vmend = DECAF_get_vm_end(env, mmap_i);
-    flags = DECAF_get_vm_flags(env, mmap_i);
-    mm = DECAF_get_mm(env, i);
-    startbrk = DECAF_get_start_brk(env, mm);
-    brk = DECAF_get_brk(env, mm);
-    startstack = DECAF_get_start_stack(env, mm);
-
-    //from mm.h
-    //#define VM_READ         0x00000001      /* currently active flags */
-    //#define VM_WRITE        0x00000002
-    //#define VM_EXEC         0x00000004
-    //#define VM_SHARED       0x00000008
-
-    vmfile = DECAF_get_vm_file(env, mmap_i);
-    //printf("looking at vmfile at 0x%X\n", vmfile);
-    if (vmfile != 0)
+    if (DECAF_get_vma_info(env, mmap_i, &vma) != 0)
     {
-      //get_mod_dname(mmap_i, name, 128);
-      DECAF_get_mod_full_dname(env, mmap_i, name, 128);
-      //printf("found dname %s\n", name);
+      return;
     }
-    else
+    if (vma.vm_end > addr)
     {
-      name[0] = '\0';
-      //get_mod_iname(mmap_i, name, 128);
-      DECAF_get_mod_full_iname(env, mmap_i, name, 128);
-      if (strlen(name) <= 0)
+      if (vma.vm_start <= addr)
       {
-        if (vmstart <= startbrk && vmend >= brk)
-        {
-          sprintf(name, "[heap]");
-        }
-        else if (vmstart <= startstack && vmend >= startstack)
-        {
-          sprintf(name, "[stack]");
-        }
-      } else {
-       //printf("found iname %s\n", name);   
+        updateModuleByVMA(env, pid, mmap_i, &vma, &mm);
       }
+      return;
     }
+    mmap_i = vma.vm_next;
+  } while ((mmap_i != 0) && (mmap_i != mmap_first));
+}
 
-    int ret = updateModule(pid, vmstart, vmend, flags, name);
-    if (ret == 0xF) //if this is a new module
-    {
-      params.lm.pid = pid;
-      params.lm.pgd = getCurrentPGD();
-      params.lm.name = name; //TODO: THIS IS NOT THREAD SAFE!!!
-      params.lm.full_name = name;
-      params.lm.base = vmstart;
-      params.lm.size = vmend-vmstart;
-      SimpleCallback_dispatch(&DroidScope_callbacks[DECAF_PROCESSES_LOAD_MODULE_CB], &params);
-    }
-    else if (ret > 0)
+void updateProcessModuleList(CPUState* env, gpid_t pid)
+{
+  target_ulong task = 0;
+  target_ulong i = 0;
+  int bFound = 0;
+
+  if (pid == 0)
+  {
+    return;
+  }
+
+  task = DECAF_get_current_process(env);
+  i = task;
+  do
+  {
+    if (pid == DECAF_get_pid(env, i))
     {
-      params.mu.pid = pid;
-      params.mu.startAddr = vmstart;
-      params.mu.mask = ret;
-      SimpleCallback_dispatch(&DroidScope_callbacks[DECAF_PROCESSES_MODULES_UPDATED_CB], &params);
+      bFound = 1;
+      break;
     }
-    mmap_i = DECAF_get_next_mmap(env, mmap_i);
-  } while ((mmap_i != 0) && (mmap_i != mmap_first));
+    i = DECAF_get_next_task_struct(env, i);
+  } while ( (i != 0) && (i != task) );
+
+  if (!bFound)
+  {
+    return;
+  }
+  /*if(pid == 31){
+      //printf("finding strings for task at 0x%X\n", i);
+  } else return;*/
 
+  updateModulesByTask(env, pid, i);
 }
 
 inline void update_mod(CPUState* env, gpid_t pid)
@@ -216,6 +304,104 @@ inline void linux_print_mod(Monitor* mon, gpid_t pid)
 }
 
 
+/**
+ * The fields of a task that go into the shadow process list
+ */
+typedef struct _TaskFields
+{
+  gpid_t pid;
+  gpid_t parentPid;
+  gpid_t tgid;
+  gpid_t glpid;
+  target_ulong uid;
+  target_ulong gid;
+  target_ulong euid;
+  target_ulong egid;
+  gpa_t pgd;
+  char name[MAX_PROCESS_INFO_NAME_LEN];
+  char argName[MAX_PROCESS_INFO_NAME_LEN];
+} TaskFields;
+
+/**
+ * Reads the fields of a task with one guest read per struct - the task_struct,
+ * its cred and its mm_struct - plus the parent's and group leader's pids and
+ * the argument string
+ * @param info Gets the task_struct itself
+ * @return 0 if successful, -1 otherwise
+ */
+static int readTaskFields(CPUState* env, gva_t task, TaskFields* fields, DECAF_task_info* info)
+{
+  DECAF_cred_info cred;
+  DECAF_mm_info mm;
+
+  fields->argName[0] = '\0';
+  fields->name[0] = '\0';
+
+  if (DECAF_get_task_info(env, task, info) != 0)
+  {
+    return (-1);
+  }
+
+  fields->pid = info->pid;
+  fields->tgid = info->tgid;
+  fields->glpid = (info->group_leader == 0) ? -1 : DECAF_get_pid(env, info->group_leader);
+  fields->parentPid = (info->real_parent == 0) ? -1 : DECAF_get_pid(env, info->real_parent);
+
+  if (DECAF_get_cred_info(env, info->cred, &cred) != 0)
+  {
+    cred.uid = cred.gid = cred.euid = cred.egid = -1;
+  }
+  fields->uid = cred.uid;
+  fields->gid = cred.gid;
+  fields->euid = cred.euid;
+  fields->egid = cred.egid;
+
+  //like DECAF_get_pgd, kernel threads use the active_mm
+  fields->pgd = 0;
+  if (DECAF_get_mm_info(env, (info->mm != 0) ? info->mm : info->active_mm, &mm) == 0)
+  {
+    fields->pgd = pgd_strip(mm.pgd);
+    if ( (info->mm == 0) || (DECAF_get_mm_arg_name(env, &mm, fields->argName, MAX_PROCESS_INFO_NAME_LEN) < 0) )
+    {
+      fields->argName[0] = '\0';
+    }
+  }
+
+  strncpy(fields->name, info->comm, MAX_PROCESS_INFO_NAME_LEN - 1);
+  fields->name[MAX_PROCESS_INFO_NAME_LEN - 1] = '\0';
+  return (0);
+}
+
+/**
+ * Same as readTaskFields, but with the per field getters - i.e. how the list
+ * used to be read. Only used to benchmark the two against each other.
+ * @return The next task
+ */
+static gva_t readTaskFieldsOneByOne(CPUState* env, gva_t task, TaskFields* fields)
+{
+  fields->argName[0] = '\0';
+  fields->name[0] = '\0';
+
+  fields->pid = DECAF_get_pid(env, task);
+  fields->tgid = DECAF_get_tgid(env, task);
+  fields->glpid = DECAF_get_group_leader_pid(env, task);
+  fields->uid = DECAF_get_uid(env, task);
+  fields->gid = DECAF_get_gid(env, task);
+  fields->euid = DECAF_get_euid(env, task);
+  fields->egid = DECAF_get_egid(env, task);
+  fields->parentPid = DECAF_get_parent_pid(env, task);
+  fields->pgd = pgd_strip(DECAF_get_pgd(env, task));
+  if (DECAF_get_arg_name(env, task, fields->argName, MAX_PROCESS_INFO_NAME_LEN) < 0)
+  {
+    fields->argName[0] = '\0';
+  }
+  if (DECAF_get_name(env, task, fields->name, MAX_PROCESS_INFO_NAME_LEN) < 0)
+  {
+    fields->name[0] = '\0';
+  }
+  return (DECAF_get_next_task_struct(env, task));
+}
+
 /**
  * @param val the current pgd-cr3 value
  *
@@ -279,72 +465,46 @@ inline void linux_print_mod(Monitor* mon, gpid_t pid)
  *   task_struct. To DECAF_get the stack address of the task - we will have to go into the thread info structure
  *   and look at the cpu_context field to grab the stack pointer. More info on the cpu_context and copy_thread
  *   (called from copy_process called from do_fork) can be found in arch/ARCH/kernel/process.c
+ *
+ * @param pFields If not NULL, gets the fields of the task
+ * @return The next task, or 0 if the task couldn't be read
  */
-gva_t updateProcessListByTask(CPUState* env, gva_t task, int updateMask, int bNeedMark)
+static gva_t updateProcessListByTaskEx(CPUState* env, gva_t task, int updateMask, int bNeedMark, TaskFields* pFields)
 {
   DECAF_Processes_Callback_Params params;
-
-  gpid_t pid;
-  gpid_t parentPid;
-  gpid_t tgid;
-  gpid_t glpid;
-  target_ulong uid;
-  target_ulong gid;
-  target_ulong euid;
-  target_ulong egid;
-
-  gpid_t t_pid;
-  gpid_t t_tgid;
-
-  gpa_t pgd;
-  char name[MAX_PROCESS_INFO_NAME_LEN];
-  char argName[MAX_PROCESS_INFO_NAME_LEN];
+  TaskFields localFields;
+  TaskFields* f = (pFields == NULL) ? &localFields : pFields;
+  DECAF_task_info info;
+  DECAF_task_info threadInfo;
   gva_t i = task;
 
-  argName[0] = '\0';
-  name[0] = '\0';
+  if (readTaskFields(env, i, f, &info) != 0)
+  {
+    return (0);
+  }
 
-  pid = DECAF_get_pid(env, i);
-  tgid = DECAF_get_tgid(env, i);
-  glpid = DECAF_get_group_leader_pid(env, i);
-  uid = DECAF_get_uid(env, i);
-  gid = DECAF_get_gid(env, i);
-  euid = DECAF_get_euid(env, i);
-  egid = DECAF_get_egid(env, i);
-  parentPid = DECAF_get_parent_pid(env, i);
-  pgd = pgd_strip(DECAF_get_pgd(env, i));
+  gpid_t pid = f->pid;
+  char* argName = (f->argName[0] == '\0') ? NULL : f->argName;
+  char* name = (f->name[0] == '\0') ? NULL : f->name;
 
   int ret = 0;
 
-  //if (curProcessPGD == pgd)
-  {
-    if (DECAF_get_arg_name(env, i, argName, MAX_PROCESS_INFO_NAME_LEN) < 0)
-    {
-      argName[0] = '\0';
-      //printf("failed to get argname\n");
-    }
-  }
-  if (DECAF_get_name(env, i, name, MAX_PROCESS_INFO_NAME_LEN) < 0) //get the name
-  {
-    name[0] = '\0';
-  }
-
   //update the info if needed
   if ( ((bNeedMark) && (processMark(pid) == 1))
        || ((!bNeedMark) && (findProcessByPID(pid) == NULL)) 
      ) // i.e. it doesn't exist
   {
-    addProcess(i, pid, parentPid, tgid, glpid, uid, gid, euid, egid, pgd, (argName[0] == '\0') ? NULL : argName, (name[0] == '\0') ? NULL : name);
+    addProcess(i, pid, f->parentPid, f->tgid, f->glpid, f->uid, f->gid, f->euid, f->egid, f->pgd, argName, name);
     processMark(pid);
     params.cp.pid = pid;
-    params.cp.pgd = pgd;
+    params.cp.pgd = f->pgd;
     SimpleCallback_dispatch(&DroidScope_callbacks[DECAF_PROCESSES_CREATE_PROCESS_CB], &params);
     //force a module and thread update
     updateMask |= UPDATE_THREADS | UPDATE_MODULES;
   }
   else
   {
-    ret = updateProcess(i, pid, parentPid, tgid, glpid, uid, gid, euid, egid, pgd, (argName[0] == '\0') ? NULL : argName, (name[0] == '\0') ? NULL : name);
+    ret = updateProcess(i, pid, f->parentPid, f->tgid, f->glpid, f->uid, f->gid, f->euid, f->egid, f->pgd, argName, name);
     if (ret > 0)
     {
       params.pu.pid = pid;
@@ -355,38 +515,77 @@ gva_t updateProcessListByTask(CPUState* env, gva_t task, int updateMask, int bNe
 
   if (updateMask & UPDATE_THREADS)
   {
-    //update (repopulate) the threads
+    //update (repopulate) the threads - one read per thread for its pid, tgid,
+    // stack and the next thread, starting with the task we already have
     gva_t j = i;
+    threadInfo = info;
     clearThreads(pid);
     do
     {
-      if ((j != 0) && (j != -1))
-      {
-        t_pid = DECAF_get_pid(env, j);
-        t_tgid = DECAF_get_tgid(env, j);
-
-        //run through the thread group
-        gva_t parentTI = DECAF_get_stack(env, j);
-        addThread(t_tgid, t_pid, parentTI);
-      }
+      //run through the thread group
+      addThread(threadInfo.tgid, threadInfo.pid, threadInfo.stack);
 
-      j = DECAF_get_thread_group(env, j);
+      j = threadInfo.thread_group;
       if ( (j == -1) || (j == 0) )
       {
         break;
       }
       j -= task_struct_thread_group_offset;//this gives you the next one immediately
-    } while ( i != j );
+    } while ( (i != j) && (DECAF_get_task_info(env, j, &threadInfo) == 0) );
   } //end bUpdateThreads
 
   //update (repopulate) the module list
   if (updateMask & UPDATE_MODULES)
   {
-    updateProcessModuleList(env, pid);
+    updateModulesByTask(env, pid, i);
+  }
+
+  return (info.next);
+}
+
+gva_t updateProcessListByTask(CPUState* env, gva_t task, int updateMask, int bNeedMark)
+{
+  return (updateProcessListByTaskEx(env, task, updateMask, bNeedMark, NULL));
+}
+
+//-panda-arg droidscope:vmi_bench=N times N walks of the whole process list the
+// first time it is walked, reading the fields one by one and then in bulk
+static int vmiBenchIterations = 0;
+
+/**
+ * Times walks of the process list, without updating the shadow list
+ * @param bBulk Read the fields with readTaskFields instead of the per field getters
+ */
+static void benchmarkProcessListWalk(CPUState* env, gva_t task, int bBulk)
+{
+  TaskFields fields;
+  DECAF_task_info info;
+  uint64_t reads = DECAF_mem_reads;
+  int64_t start = get_clock();
+  int n = 0;
+  int count = 0;
+  gva_t i;
+
+  for (n = 0; n < vmiBenchIterations; n++)
+  {
+    i = task;
+    count = 0;
+    do
+    {
+      if (bBulk)
+      {
+        i = (readTaskFields(env, i, &fields, &info) == 0) ? info.next : 0;
+      }
+      else
+      {
+        i = readTaskFieldsOneByOne(env, i, &fields);
+      }
+      count++;
+    } while ( (i != task) && (i != 0) );
   }
 
-  i = DECAF_get_next_task_struct(env, i);
-  return (i);
+  DECAF_printf("  %-12s %d tasks: %.1f us and %.1f guest reads per walk\n", bBulk ? "bulk:" : "one by one:", count,
+    (double)(get_clock() - start) / 1000.0 / vmiBenchIterations, (double)(DECAF_mem_reads - reads) / vmiBenchIterations);
 }
 
 void updateProcessList(CPUState* env, gpa_t newpgd, int updateMask)
@@ -410,25 +609,31 @@ void updateProcessList(CPUState* env, gpa_t newpgd, int updateMask)
     return;
   }
 
-  gpa_t pgd;
-  gpid_t pid;
+  TaskFields fields;
+
+  if (vmiBenchIterations > 0)
+  {
+    DECAF_printf("Process list walk, %d iterations:\n", vmiBenchIterations);
+    benchmarkProcessListWalk(env, task, 0);
+    benchmarkProcessListWalk(env, task, 1);
+    vmiBenchIterations = 0;
+  }
 
   gva_t i = task;
+  contextStats.fullWalks++;
+  pgdWritesSinceWalk = 0;
   //begin the marking process
   //TODO: This is not thread safe - might lose some information
   processMarkBegin();
   do
   {
-    pgd = pgd_strip(DECAF_get_pgd(env, i));
-    pid = DECAF_get_pid(env,i);
+    i = updateProcessListByTaskEx(env, i, updateMask, 1, &fields);
     //see if this is the new process, if it is, then update the current PID
-    if (pgd == pgd_strip(newpgd))
+    if ((i != 0) && (fields.pgd == pgd_strip(newpgd)))
     {
-      curProcessPID = pid;
-      curProcessPGD = pgd;
+      curProcessPID = fields.pid;
+      curProcessPGD = fields.pgd;
     }
- 
-    i = updateProcessListByTask(env, i, updateMask, 1);
   } while ( (i != task) && ( i != 0) );
 
   gpid_t* pids = NULL;
@@ -476,6 +681,70 @@ inline void linux_pt(Monitor* mon)
   printThreadsList(NULL);
 }
 
+static void context_print_stats(void)
+{
+  DECAF_printf("Process list updates: %s\n", bContextIncremental ? "incremental" : "full walk on every PGD write");
+  DECAF_printf("  PGD writes:       %" PRIu64 " (%" PRIu64 " found in the shadow list)\n", contextStats.pgdWrites, contextStats.pgdHits);
+  DECAF_printf("  Guest reads:      %" PRIu64 " (%.1f per PGD write)\n", contextStats.pgdWriteReads,
+    contextStats.pgdWrites ? (double)contextStats.pgdWriteReads / contextStats.pgdWrites : 0.0);
+  DECAF_printf("  Full walks:       %" PRIu64 " (%" PRIu64 " periodic resyncs)\n", contextStats.fullWalks, contextStats.resyncs);
+  DECAF_printf("  Events:           %" PRIu64 " (%.1f guest reads each)\n", contextStats.events,
+    contextStats.events ? (double)contextStats.eventReads / contextStats.events : 0.0);
+}
+
+/**
+ * Makes the process with this PGD in the shadow list the current one, without reading guest memory
+ * @return 1 if it was found, 0 otherwise
+ */
+static int setCurrentProcessByPGD(gpa_t pgd)
+{
+  ProcessInfo* pInfo = findProcessByPGD(pgd_strip(pgd));
+  if (pInfo == NULL)
+  {
+    return (0);
+  }
+  curProcessPID = pInfo->pid;
+  curProcessPGD = pInfo->pgd;
+  return (1);
+}
+
+/**
+ * Adds the task just created by fork or clone to the shadow list. New processes
+ * are linked in at the tail of the task list, just before init_task, so that is
+ * where we look. A new thread isn't on the task list - it is picked up by
+ * refreshing the threads of the current process, which is its group leader.
+ * @param pid The child's pid, i.e. the return value in the parent
+ * @return 1 if the shadow list was updated, 0 if a full walk is needed
+ */
+static int addNewTask(CPUState* env, gpid_t pid, int bMaybeThread)
+{
+  if (pid <= 0)
+  {
+    //we are in the child, or the call failed
+    return (1);
+  }
+
+  gva_t task = DECAF_get_prev_task_struct(env, DECAF_get_next_task_struct(env, 0));
+  if ((task != 0) && (DECAF_get_pid(env, task) == pid))
+  {
+    updateProcessListByTask(env, task, UPDATE_PROCESSES | UPDATE_THREADS, 0);
+    return (1);
+  }
+
+  if (!bMaybeThread)
+  {
+    return (0);
+  }
+
+  task = DECAF_get_current_process(env);
+  if ((task == 0) || (findProcessByPID(DECAF_get_pid(env, task)) == NULL))
+  {
+    return (0);
+  }
+  updateProcessListByTask(env, task, UPDATE_THREADS, 0);
+  return (1);
+}
+
 #if (1)
 //reg 0 is c2_base0 and 1 is c2_base1
 void Context_PGDWriteCallback(CPUState *env, target_ulong oldval, target_ulong newval)
@@ -484,17 +753,32 @@ void Context_PGDWriteCallback(CPUState *env, target_ulong oldval, target_ulong n
   //gettimeofday(&t, NULL);
 
 
+  uint64_t reads = DECAF_mem_reads;
+  contextStats.pgdWrites++;
+
   //TODO: Keep a record of what the current PGD is and the new PGD is
   // so that we don't do unnecessary updates - this applies to the
   // skipupdates flag that is set when system calls are made as well
   if (!bSkipNextPGDUpdate)
   {
-    updateProcessList(env, newval, UPDATE_PROCESSES | UPDATE_THREADS);
+    if (bContextIncremental && (++pgdWritesSinceWalk < CONTEXT_RESYNC_INTERVAL) && setCurrentProcessByPGD(newval))
+    {
+      contextStats.pgdHits++;
+    }
+    else
+    {
+      if (bContextIncremental && (pgdWritesSinceWalk >= CONTEXT_RESYNC_INTERVAL))
+      {
+        contextStats.resyncs++;
+      }
+      updateProcessList(env, newval, UPDATE_PROCESSES | UPDATE_THREADS);
+    }
         //printf("%s is at [%x]\n", "fputs", getSymbolAddress(1, "/init", "free"));
   }
 
   //reset this flag
   bSkipNextPGDUpdate = 0;
+  contextStats.pgdWriteReads += DECAF_mem_reads - reads;
 }
 
 static gva_t Context_retAddr = 0;
@@ -615,18 +899,67 @@ int contextCondFunc (DECAF_callback_type_t cbType, gva_t curPC, gva_t nextPC)
 #endif
 
 #define CURRENT_PGD(x) (x->cp15.c2_base0 & x->cp15.c2_base_mask)
+//the system call's return value
+#define RETURN_VALUE(x) (x->regs[0])
 
 static int return_from_exec(CPUState *env){
-    updateProcessList(env, CURRENT_PGD(env), UPDATE_MODULES | UPDATE_PROCESSES | UPDATE_THREADS);
+    uint64_t reads = DECAF_mem_reads;
+    gva_t task = bContextIncremental ? DECAF_get_current_process(env) : 0;
+    if (task != 0)
+    {
+        //only the current process has a new image
+        updateProcessListByTask(env, task, UPDATE_MODULES | UPDATE_PROCESSES | UPDATE_THREADS, 0);
+    }
+    if ((task == 0) || !setCurrentProcessByPGD(CURRENT_PGD(env)))
+    {
+        updateProcessList(env, CURRENT_PGD(env), UPDATE_MODULES | UPDATE_PROCESSES | UPDATE_THREADS);
+    }
+    contextStats.events++;
+    contextStats.eventReads += DECAF_mem_reads - reads;
     return 0;
 }
 
 static int return_from_fork(CPUState *env){
-    updateProcessList(env, CURRENT_PGD(env), UPDATE_PROCESSES | UPDATE_THREADS);
+    uint64_t reads = DECAF_mem_reads;
+    if (!bContextIncremental || !addNewTask(env, RETURN_VALUE(env), 0))
+    {
+        updateProcessList(env, CURRENT_PGD(env), UPDATE_PROCESSES | UPDATE_THREADS);
+    }
+    contextStats.events++;
+    contextStats.eventReads += DECAF_mem_reads - reads;
     return 0;
 }
 static int return_from_clone(CPUState *env){
-    updateProcessList(env, CURRENT_PGD(env), UPDATE_PROCESSES | UPDATE_THREADS);
+    uint64_t reads = DECAF_mem_reads;
+    if (!bContextIncremental || !addNewTask(env, RETURN_VALUE(env), 1))
+    {
+        updateProcessList(env, CURRENT_PGD(env), UPDATE_PROCESSES | UPDATE_THREADS);
+    }
+    contextStats.events++;
+    contextStats.eventReads += DECAF_mem_reads - reads;
+    return 0;
+}
+
+static int return_from_mmap(CPUState *env){
+    //the full walk never looked at new mappings, so there is nothing to fall back to
+    gva_t addr = RETURN_VALUE(env);
+    if (!bContextIncremental || (addr >= (gva_t)-4096))
+    {
+        //failed with -errno
+        return 0;
+    }
+    uint64_t reads = DECAF_mem_reads;
+    gva_t task = DECAF_get_current_process(env);
+    if (task != 0)
+    {
+        gpid_t pid = DECAF_get_pid(env, task);
+        if (findProcessByPID(pid) != NULL)
+        {
+            updateModuleByAddress(env, pid, task, addr);
+        }
+    }
+    contextStats.events++;
+    contextStats.eventReads += DECAF_mem_reads - reads;
     return 0;
 }
 #if (1)
@@ -638,6 +971,18 @@ void context_init(void)
     //SimpleCallback_init(&DroidScope_callbacks[i]);
   }
 
+  for (i = 0; i < panda_argc; i++)
+  {
+    if (strcmp(panda_argv[i], "droidscope:context=full") == 0)
+    {
+      bContextIncremental = 0;
+    }
+    else if (strncmp(panda_argv[i], "droidscope:vmi_bench=", 21) == 0)
+    {
+      vmiBenchIterations = atoi(panda_argv[i] + 21);
+    }
+  }
+
   //contextCSHandle = panda_register_callback(NULL, DECAF_PGD_WRITE_CB, &Context_PGDWriteCallback, NULL);
   panda_cb callback;
   //callback.before_block_exec = contextBBCallback;
@@ -648,6 +993,8 @@ void context_init(void)
   panda_register_callback(NULL, PANDA_CB_VMI_AFTER_EXEC, callback);
   callback.return_from_clone = return_from_clone;
   panda_register_callback(NULL, PANDA_CB_VMI_AFTER_CLONE, callback);
+  callback.return_from_mmap = return_from_mmap;
+  panda_register_callback(NULL, PANDA_CB_VMI_AFTER_MMAP, callback);
   callback.after_PGD_write = Context_PGDWriteCallback;
   panda_register_callback(NULL, PANDA_CB_VMI_PGD_CHANGED, callback);
 }
@@ -656,6 +1003,11 @@ void context_close(void)
 {
   int i = 0; 
 
+  if (contextStats.pgdWrites != 0)
+  {
+    context_print_stats();
+  }
+
   for (i = 0; i < DECAF_PROCESSES_LAST_CB; i++)
   {
     SimpleCallback_clear(&DroidScope_callbacks[i]);
@@ -22,10 +22,43 @@
  *      Author: lok
  */
 
+#include <sys/stat.h>
 #include "ModuleServer.h"
 //#include <iostream>
 using namespace std;
 
+/**
+ * Loads the symbols in symName (a .sym file) into pInfo. A precomputed
+ * index (symName + "idx") that is at least as new as the .sym file is just
+ * mmapped instead. If there isn't one then we parse the .sym file and try
+ * to write the index out for the next time - it doesn't matter if that fails.
+ */
+static void loadSymbols(ModuleInfo* pInfo, const string& symName)
+{
+  string idxName = symName + "idx";
+  struct stat symStat;
+  struct stat idxStat;
+  bool bHaveSym = (stat(symName.c_str(), &symStat) == 0);
+
+  if ( (stat(idxName.c_str(), &idxStat) == 0)
+       && (!bHaveSym || (idxStat.st_mtime >= symStat.st_mtime))
+       && (pInfo->mapSymbolIndex(idxName) == 0)
+     )
+  {
+    return;
+  }
+
+  if (!bHaveSym)
+  {
+    return;
+  }
+
+  if (pInfo->readSymbolsFromFile(symName) == 0)
+  {
+    pInfo->saveSymbolIndex(idxName);
+  }
+}
+
 ModuleInfo* ModuleServer::getModulePointer(const string& name)
 {
   std::list<ModuleInfo*>::iterator it;
@@ -90,7 +123,7 @@ ModuleInfo* ModuleServer::getModulePointer(const string& name)
   dumpName.append(name);
   //now we will try to see if we can load the symbols first
   dumpName.append(".sym");
-  pInfo->readSymbolsFromFile(dumpName);
+  loadSymbols(pInfo, dumpName);
 
 push_and_end:
   modules.push_back(pInfo);
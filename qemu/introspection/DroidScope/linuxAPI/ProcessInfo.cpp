@@ -25,11 +25,70 @@
 
 #include <cstring>
 #include <assert.h>
+#include <vector>
 #include "DS_Common.h"
 #include "linuxAPI/ProcessInfo.h"
 #include "linuxAPI/ModuleInfo.h"
 #include "introspection/utils/OutputWrapper.h"
 
+/**
+ * The module list is kept sorted by start address, so looking up the module
+ * for an address only needs a binary search over a flat copy of the ranges
+ * instead of walking the list. The copy is dropped whenever the list changes
+ * and rebuilt the next time it is needed.
+ */
+typedef struct _ModuleRange
+{
+  gva_t startAddr;
+  gva_t endAddr;
+  ModuleNode* pNode;
+} ModuleRange;
+
+typedef std::vector<ModuleRange> ModuleTable;
+
+static void invalidateModuleTable(ProcessInfo* pInfo)
+{
+  delete((ModuleTable*)pInfo->moduleTable);
+  pInfo->moduleTable = NULL;
+}
+
+static ModuleNode* findModuleNode(ProcessInfo* pInfo, gva_t addr)
+{
+  ModuleTable* pTable = (ModuleTable*)pInfo->moduleTable;
+  if (pTable == NULL)
+  {
+    pTable = new ModuleTable;
+    for (ModuleNode* i = pInfo->modules; i != NULL; i = i->next)
+    {
+      ModuleRange r = { i->startAddr, i->endAddr, i };
+      pTable->push_back(r);
+    }
+    pInfo->moduleTable = pTable;
+  }
+
+  //find the last range that starts at or before addr
+  size_t lo = 0;
+  size_t hi = pTable->size();
+  while (lo < hi)
+  {
+    size_t mid = lo + (hi - lo) / 2;
+    if ((*pTable)[mid].startAddr <= addr)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+
+  if ( (lo == 0) || (addr > (*pTable)[lo - 1].endAddr) )
+  {
+    return (NULL);
+  }
+  return ((*pTable)[lo - 1].pNode);
+}
+
 //Implementation for the class
 ProcessInfo* ProcessInfoMap::findProcessByPID(gpid_t pid)
 {
@@ -137,6 +196,7 @@ DECAF_errno_t ProcessInfoMap::addProcess(gva_t task, gpid_t pid, gpid_t parentPi
     strncpy(pInfo->strComm, strComm, MAX_TASK_COMM_LEN);
   }
   pInfo->modules = NULL;
+  pInfo->moduleTable = NULL;
   pInfo->threads = NULL;
 
   processInfoMap[pid] = pInfo;
@@ -276,6 +336,7 @@ DECAF_errno_t ProcessInfoMap::removeProcess(gpid_t pid)
     pNext = pInfo->modules;
     //set the NULL value now - so worst that can happen is wasted memory
     pInfo->modules = NULL;
+    invalidateModuleTable(pInfo);
 
     for (pNode = pNext; pNode != NULL; pNode = pNext)
     {
@@ -572,6 +633,7 @@ void ProcessInfoMap::destroy()
         pNext = pNode->next;
         delete(pNode);
       }
+      invalidateModuleTable(pTemp);
       delete(pTemp);
       pTemp = NULL;
     }
@@ -622,6 +684,7 @@ int ProcessInfoMap::updateModule(gpid_t pid, gva_t  startAddr, gva_t  endAddr, t
     pNode->next = pInfo->modules;
     pNode->moduleInfo = modServer.getModulePointer(strName);
     pInfo->modules = pNode;
+    invalidateModuleTable(pInfo);
     //we are done return 4 1's - the number of fields changed
     return (0xF);
   }
@@ -646,6 +709,7 @@ int ProcessInfoMap::updateModule(gpid_t pid, gva_t  startAddr, gva_t  endAddr, t
         //the new endAddr is valid so we update it
         pi->endAddr = endAddr;
         ret |= 0x2;
+        invalidateModuleTable(pInfo);
       }
       if (flags != pi->flags)
       {
@@ -686,6 +750,7 @@ int ProcessInfoMap::updateModule(gpid_t pid, gva_t  startAddr, gva_t  endAddr, t
       pNode->next = pi->next;
       pNode->moduleInfo = modServer.getModulePointer(strName);
       pi->next = pNode;
+      invalidateModuleTable(pInfo);
       //we are done
       return (0xF);
     }
@@ -723,6 +788,7 @@ int ProcessInfoMap::removeModuleByName(gpid_t pid, const char* strName)
     {
       pInfo->modules = pNode->next;
       delete(pNode);
+      invalidateModuleTable(pInfo);
       return (0);
     }
   }
@@ -734,8 +800,10 @@ int ProcessInfoMap::removeModuleByName(gpid_t pid, const char* strName)
     {
       if (pModInfo->getName().compare(strName) == 0)
       {
-        pNode->next = pNode->next->next;
-        delete(pNode);
+        ModuleNode* pTemp = pNode->next;
+        pNode->next = pTemp->next;
+        delete(pTemp);
+        invalidateModuleTable(pInfo);
         return (0);
       }
     }
@@ -760,14 +828,10 @@ int ProcessInfoMap::getModuleInfo(ProcessInfo* pInfo, char* str, size_t len, gva
 
   //since we have a process, we need to find the right module
   ModuleInfo* pModInfo = NULL;
-  ModuleNode* i = pInfo->modules;
-  for ( ; i != NULL; i = i->next)
+  ModuleNode* i = findModuleNode(pInfo, addr);
+  if (i != NULL)
   {
-    if ( (addr >= i->startAddr) && (addr <= i->endAddr) )
-    {
-      pModInfo = (ModuleInfo*)(i->moduleInfo);
-      break;
-    }
+    pModInfo = (ModuleInfo*)(i->moduleInfo);
   }
 
   if (pModInfo == NULL)
@@ -826,14 +890,10 @@ int ProcessInfoMap::symbolExists(ProcessInfo* pInfo, gva_t address)
 
   //since we have a process, we need to find the right module
   ModuleInfo* pModInfo = NULL;
-  ModuleNode* i = pInfo->modules;
-  for ( ; i != NULL; i = i->next)
+  ModuleNode* i = findModuleNode(pInfo, address);
+  if (i != NULL)
   {
-    if ( (address >= i->startAddr) && (address <= i->endAddr) )
-    {
-      pModInfo = (ModuleInfo*)(i->moduleInfo);
-      break;
-    }
+    pModInfo = (ModuleInfo*)(i->moduleInfo);
   }
 
   if (pModInfo == NULL)
@@ -860,14 +920,10 @@ int ProcessInfoMap::getSymbol(ProcessInfo* pInfo, char* symbol, size_t len, gva_
 
   //since we have a process, we need to find the right module
   ModuleInfo* pModInfo = NULL;
-  ModuleNode* i = pInfo->modules;
-  for ( ; i != NULL; i = i->next)
+  ModuleNode* i = findModuleNode(pInfo, address);
+  if (i != NULL)
   {
-    if ( (address >= i->startAddr) && (address <= i->endAddr) )
-    {
-      pModInfo = (ModuleInfo*)(i->moduleInfo);
-      break;
-    }
+    pModInfo = (ModuleInfo*)(i->moduleInfo);
   }
 
   if (pModInfo == NULL)
@@ -979,14 +1035,10 @@ int ProcessInfoMap::getNearestSymbol(ProcessInfo* pInfo, char* symbol, size_t le
 
   //since we have a process, we need to find the right module
   ModuleInfo* pModInfo = NULL;
-  ModuleNode* i = pInfo->modules;
-  for ( ; i != NULL; i = i->next)
+  ModuleNode* i = findModuleNode(pInfo, address);
+  if (i != NULL)
   {
-    if ( (address >= i->startAddr) && (address <= i->endAddr) )
-    {
-      pModInfo = (ModuleInfo*)(i->moduleInfo);
-      break;
-    }
+    pModInfo = (ModuleInfo*)(i->moduleInfo);
   }
 
   if (pModInfo == NULL)
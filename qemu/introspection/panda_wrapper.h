@@ -20,10 +20,13 @@ PANDAENDCOMMENT */
 #include "panda_plugin.h"
 #include "DECAF_types.h"
 
+// Number of DECAF_read_mem calls, for measuring what introspection costs
+extern uint64_t DECAF_mem_reads;
+
 #define DECAF_memory_rw(_env, _vaddr, _buf, _len, _write) \
         panda_virtual_memory_rw(_env, _vaddr, (uint8_t*) _buf, _len, _write)
 #define DECAF_read_mem(_env, _vaddr, _buf, _len) \
-        panda_virtual_memory_rw(_env, _vaddr, (uint8_t*) _buf, _len, 0)
+        (DECAF_mem_reads++, panda_virtual_memory_rw(_env, _vaddr, (uint8_t*) _buf, _len, 0))
 
 #define DECAF_write_mem(_env, _vaddr, _buf, _len) \
         panda_virtual_memory_rw(_env, _vaddr, (uint8_t*)_buf, _len, 1)
@@ -47,6 +50,13 @@ DECAF_errno_t DECAF_memory_rw_with_pgd(CPUState* env, target_ulong pgd, gva_t ad
 
 
 
+// Reads up to len bytes, a page at a time, stopping at the first page that
+// can't be read. Returns the number of bytes read.
 int DECAF_read_mem_until(CPUState* env, gva_t vaddr, void* buf, size_t len);
 
+// Reads a NUL terminated string of at most size - 1 characters into buf,
+// translating each page once. buf is always terminated. Returns the length
+// of the string, or -1 if nothing could be read.
+int DECAF_read_string(CPUState* env, gva_t vaddr, char* buf, size_t size);
+
 #endif
\ No newline at end of file
@@ -35,6 +35,7 @@ using namespace std;
 int TULStringMap::addSymbol(target_ulong address, const std::string& sym)
 {
   symbols[address] = sym;
+  symbolsVersion++;
   return (0);
 }
 
@@ -110,6 +111,7 @@ int TULStringMap::readSymbolsFromFile(const std::string& filename)
     sym = s.substr(t+1);
     symbols[addr] = sym;
   }
+  symbolsVersion++;
 
   if (symbols.empty())
   {
@@ -58,7 +58,7 @@ extern "C"
 class TULStringMap
 {
 public:
-  TULStringMap() {};
+  TULStringMap() : symbolsVersion(0) {};
   void printMap(std::ostream& outs);
   void printMap(FILE* fp);
   DECAF_errno_t addSymbol(target_ulong address, const std::string& sym);
@@ -77,6 +77,12 @@ protected:
   typedef std::tr1::unordered_map<target_ulong, std::string> _map;
 
   _map symbols;
+
+  /**
+   * Bumped whenever symbols is changed so derived classes
+   * can tell when anything they built from it is stale.
+   */
+  unsigned long symbolsVersion;
 };
 #endif //__cplusplus
 
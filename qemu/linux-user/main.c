@@ -52,6 +52,7 @@
 
 #ifdef CONFIG_LLVM
 #include "tcg-llvm.h"
+#include "panda/panda_helper_call_morph.h"
 #endif
 
 #include "panda_plugin.h"
@@ -3097,6 +3098,16 @@ static void handle_arg_singlestep(const char *arg)
     singlestep = 1;
 }
 
+static void handle_arg_tcg_opt_level(const char *arg)
+{
+    tcg_opt_level = atoi(arg);
+}
+
+static void handle_arg_tb_regions(const char *arg)
+{
+    tb_regions = atoi(arg);
+}
+
 static void handle_arg_strace(const char *arg)
 {
     do_strace = 1;
@@ -3120,6 +3131,31 @@ static void handle_generate_llvm(const char *arg)
 {
     generate_llvm = 1;
 }
+
+static void handle_llvm_opt_threshold(const char *arg)
+{
+    llvm_opt_threshold = strtoull(arg, NULL, 0);
+}
+
+static void handle_llvm_async(const char *arg)
+{
+    llvm_async_compile = 1;
+}
+
+static void handle_llvm_trace_threshold(const char *arg)
+{
+    llvm_trace_threshold = strtoull(arg, NULL, 0);
+}
+
+static void handle_llvm_mem_limit(const char *arg)
+{
+    llvm_mem_limit = strtoull(arg, NULL, 0) << 20;
+}
+
+static void handle_llvm_inline_helpers(const char *arg)
+{
+    llvm_inline_threshold = strtoull(arg, NULL, 0);
+}
 #endif
 
 static void handle_panda_plugin(const char *arg)
@@ -3168,6 +3204,10 @@ struct qemu_argument arg_table[] = {
      "pagesize",   "set the host page size to 'pagesize'"},
     {"singlestep", "QEMU_SINGLESTEP",  false, handle_arg_singlestep,
      "",           "run in singlestep mode"},
+    {"tcg-opt-level", "QEMU_TCG_OPT_LEVEL", true, handle_arg_tcg_opt_level,
+     "n",          "optimize TCG ops at level n (0-2, default 2)"},
+    {"tb-regions", "QEMU_TB_REGIONS",  true,  handle_arg_tb_regions,
+     "n",          "split the translated code buffer into n regions (default 8)"},
     {"strace",     "QEMU_STRACE",      false, handle_arg_strace,
      "",           "log system calls"},
     {"version",    "QEMU_VERSION",     false, handle_arg_version,
@@ -3177,6 +3217,16 @@ struct qemu_argument arg_table[] = {
      "",        "execute code using LLVM JIT"},
     {"generate-llvm", "QEMU_GEN_LLVM",        false, handle_generate_llvm,
      "",        "translate code into LLVM but don't execute it"},
+    {"llvm-opt-threshold", "QEMU_LLVM_OPT_THRESHOLD", true, handle_llvm_opt_threshold,
+     "n",       "optimize LLVM code for blocks that have run n times"},
+    {"llvm-async", "QEMU_LLVM_ASYNC",  false, handle_llvm_async,
+     "",        "compile LLVM code on a background thread"},
+    {"llvm-trace-threshold", "QEMU_LLVM_TRACE_THRESHOLD", true, handle_llvm_trace_threshold,
+     "n",       "run LLVM blocks followed by the same block n times as traces"},
+    {"llvm-mem-limit", "QEMU_LLVM_MEM_LIMIT", true, handle_llvm_mem_limit,
+     "size",    "free LLVM code of blocks not run recently past size MB"},
+    {"llvm-inline-helpers", "QEMU_LLVM_INLINE_HELPERS", true, handle_llvm_inline_helpers,
+     "n",       "run helpers from bitcode, inlining those of size up to n"},
 #endif
     {"panda-plugin", "QEMU_PANDA_PLUGIN", true, handle_panda_plugin,
      "",        "load PANDA plugin from <file>"},
@@ -3570,6 +3620,9 @@ int main(int argc, char **argv, char **envp)
         if (tcg_llvm_ctx == NULL){
             tcg_llvm_ctx = tcg_llvm_initialize();
         }
+        if (llvm_inline_threshold){
+            init_llvm_helpers();
+        }
     }
 #endif
 
@@ -29,7 +29,10 @@ PANDAENDCOMMENT */
 #include "llvm/Analysis/Verifier.h"
 #include "llvm/ExecutionEngine/ExecutionEngine.h"
 #include "llvm/IRReader/IRReader.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/Support/InstIterator.h"
 #include "llvm/Support/raw_ostream.h"
+#include "llvm/Transforms/Utils/Cloning.h"
 
 #include "config.h"
 #include "tcg-llvm.h"
@@ -55,6 +58,9 @@ Y("PandaCallMorph", "Change helper function calls to the the LLVM version");
 
 bool PandaCallMorphFunctionPass::runOnFunction(Function &F){
     functionChanged = false;
+    if (!enabled){
+        return false;
+    }
     PHCV->visit(F);
     return functionChanged;
 }
@@ -121,12 +127,142 @@ void PandaHelperCallVisitor::visitCallInst(CallInst &I){
 
 } // namespace llvm
 
+extern "C" {
+uint64_t llvm_inline_threshold = 0;
+struct LLVMHelperInlineStats llvm_helper_inline_stats;
+}
+
+static unsigned inline_max_size = 0;
+
+namespace llvm {
+
+
+
+/***
+ *** PandaHelperInlineFunctionPass
+ ***/
+
+
+
+char PandaHelperInlineFunctionPass::ID = 0;
+static RegisterPass<PandaHelperInlineFunctionPass>
+Z("PandaHelperInline", "Inline small LLVM helper functions");
+
+/*
+ * The number of local slots the taint analysis gives the function: one per
+ * argument, basic block and instruction.
+ */
+static unsigned functionSize(Function &F){
+    unsigned size = F.arg_size();
+    for (Function::iterator bb = F.begin(); bb != F.end(); bb++){
+        size += 1 + bb->size();
+    }
+    return size;
+}
+
+static bool isMemoryHelper(StringRef name){
+    return (name.startswith("__ld") || name.startswith("__st"))
+        && name.endswith("_mmu_llvm");
+}
+
+PandaHelperInlineFunctionPass::PandaHelperInlineFunctionPass(Module *mod,
+        unsigned threshold) :
+    FunctionPass(ID),
+    enabled(true) {
+    for (Module::iterator i = mod->begin(); i != mod->end(); i++){
+        Function *F = i;
+        if (F->isDeclaration() || F->isVarArg()
+                || !F->getName().endswith("_llvm")){
+            continue;
+        }
+        if (!isMemoryHelper(F->getName()) && functionSize(*F) > threshold){
+            continue;
+        }
+        // The copy isn't added to the module, so it is left alone by passes
+        // run over all of the module's functions
+        ValueToValueMapTy VMap;
+        bodies[F] = CloneFunction(F, VMap, false);
+        llvm_helper_inline_stats.helpers++;
+    }
+}
+
+PandaHelperInlineFunctionPass::~PandaHelperInlineFunctionPass(){
+    std::map<Function*, Function*>::iterator it;
+    for (it = bodies.begin(); it != bodies.end(); it++){
+        delete it->second;
+    }
+}
+
+bool PandaHelperInlineFunctionPass::runOnFunction(Function &F){
+    if (!enabled || bodies.empty()){
+        return false;
+    }
+
+    // Only the calls made by the function itself; calls made by the helpers
+    // that get inlined stay out of line
+    std::vector<CallInst*> calls;
+    for (inst_iterator i = inst_begin(F); i != inst_end(F); i++){
+        CallInst *CI = dyn_cast<CallInst>(&*i);
+        if (CI && bodies.count(CI->getCalledFunction())){
+            calls.push_back(CI);
+        }
+    }
+
+    bool changed = false;
+    unsigned size = functionSize(F);
+    std::vector<CallInst*>::iterator it;
+    for (it = calls.begin(); it != calls.end(); it++){
+        CallInst *CI = *it;
+        Function *helper = CI->getCalledFunction();
+        Function *body = bodies[helper];
+        unsigned bodySize = functionSize(*body);
+        if (inline_max_size && size + bodySize > inline_max_size){
+            llvm_helper_inline_stats.skipped++;
+            continue;
+        }
+        CI->setCalledFunction(body);
+        InlineFunctionInfo IFI;
+        if (!InlineFunction(CI, IFI)){
+            CI->setCalledFunction(helper);
+            llvm_helper_inline_stats.skipped++;
+            continue;
+        }
+        size += bodySize;
+        llvm_helper_inline_stats.inlined++;
+        if (isMemoryHelper(helper->getName())){
+            llvm_helper_inline_stats.memory++;
+        }
+        changed = true;
+    }
+    return changed;
+}
+
+} // namespace llvm
+
+// The context the helper bitcode was linked into, and the call morph and
+// inline passes added to its function pass manager.  All belong to that
+// context.
+static TCGLLVMContext *helpers_ctx = NULL;
+static llvm::PandaCallMorphFunctionPass *morph_pass = NULL;
+static llvm::PandaHelperInlineFunctionPass *inline_pass = NULL;
+
 /*
  * Start the process of including the execution of QEMU helper functions in the
  * LLVM JIT.
  */
 void init_llvm_helpers(){
     assert(tcg_llvm_ctx);
+
+    // The helpers are linked only once per context; switching them back on
+    // just re-enables the call morph pass.
+    if (helpers_ctx == tcg_llvm_ctx){
+        morph_pass->enabled = true;
+        if (inline_pass){
+            inline_pass->enabled = true;
+        }
+        return;
+    }
+
     llvm::ExecutionEngine *ee = tcg_llvm_ctx->getExecutionEngine();
     assert(ee);
     llvm::FunctionPassManager *fpm = tcg_llvm_ctx->getFunctionPassManager();
@@ -167,30 +303,54 @@ void init_llvm_helpers(){
     ee->updateGlobalMapping(gv, get_env());
 
     // Create call morph pass and add to function pass manager
-    llvm::FunctionPass *fp = new llvm::PandaCallMorphFunctionPass();
-    fpm->add(fp);
+    morph_pass = new llvm::PandaCallMorphFunctionPass();
+    fpm->add(morph_pass);
+
+    // Inline helpers into the calls morphed above.  This copies the helpers
+    // now, so it has to happen before any instrumentation is added to them.
+    if (llvm_inline_threshold){
+        inline_pass = new llvm::PandaHelperInlineFunctionPass(mod,
+            llvm_inline_threshold);
+        fpm->add(inline_pass);
+    }
+    helpers_ctx = tcg_llvm_ctx;
 }
 
 /*
- * Stop running QEMU helper functions in the JIT.
+ * Stop running QEMU helper functions in the JIT.  The passes stay in the
+ * function pass manager (which owns them) but leave calls alone, so LLVM
+ * functions generated from now on call the TCG helpers again.
  */
 void uninit_llvm_helpers(){
-    /*
-     * XXX: Here, we unload our pass from the PassRegistry.  This seems to work
-     * fine, until we reload this plugin again into QEMU and we get an LLVM
-     * assertion saying the pass is already registered.  This seems like a bug
-     * with LLVM.  Switching between TCG and LLVM works fine when passes aren't
-     * added to LLVM.
-     */
-    llvm::PassRegistry *pr = llvm::PassRegistry::getPassRegistry();
-    const llvm::PassInfo *pi =
-        //pr->getPassInfo(&llvm::PandaInstrFunctionPass::ID);
-        pr->getPassInfo(llvm::StringRef("PandaCallMorph"));
-    if (!pi){
-        printf("Unable to find 'PandaCallMorph' pass in pass registry\n");
-    }
-    else {
-        pr->unregisterPass(*pi);
+    if (helpers_ctx == tcg_llvm_ctx && morph_pass){
+        morph_pass->enabled = false;
+        if (inline_pass){
+            inline_pass->enabled = false;
+        }
     }
 }
 
+/*
+ * Called when the LLVM context is destroyed, along with the helpers linked
+ * into it.
+ */
+void forget_llvm_helpers(){
+    helpers_ctx = NULL;
+    morph_pass = NULL;
+    inline_pass = NULL;
+}
+
+void limit_llvm_helper_inlining(unsigned max_size){
+    inline_max_size = max_size;
+}
+
+void dump_llvm_helper_inline_stats(FILE *f,
+        int (*cpu_fprintf)(FILE *f, const char *fmt, ...)){
+    LLVMHelperInlineStats *st = &llvm_helper_inline_stats;
+    cpu_fprintf(f, "LLVM inlined calls   %llu (%llu loads/stores, "
+                "%llu left out of line, %llu helpers)\n",
+                (unsigned long long) st->inlined,
+                (unsigned long long) st->memory,
+                (unsigned long long) st->skipped,
+                (unsigned long long) st->helpers);
+}
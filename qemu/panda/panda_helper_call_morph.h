@@ -17,7 +17,10 @@ PANDAENDCOMMENT */
 
 #ifdef __cplusplus
 
+#include <map>
+
 #include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Function.h"
 #include "llvm/Pass.h"
 #include "llvm/InstVisitor.h"
 
@@ -50,11 +53,13 @@ class PandaCallMorphFunctionPass : public FunctionPass {
 public:
     static char ID;
     bool functionChanged; // Return value for runOnFunction()
+    bool enabled; // Cleared by uninit_llvm_helpers()
 
     PandaCallMorphFunctionPass() :
         FunctionPass(ID),
         PHCV(new PandaHelperCallVisitor(this)),
-        functionChanged(false) {}
+        functionChanged(false),
+        enabled(true) {}
 
     ~PandaCallMorphFunctionPass(){
         delete PHCV;
@@ -67,14 +72,69 @@ public:
     }
 };
 
+/*
+ * PandaHelperInlineFunctionPass
+ * A function pass that inlines calls to small LLVM helper functions, and
+ * always to the softmmu load and store fast paths (__ld*_mmu_llvm and
+ * __st*_mmu_llvm).  It runs after PandaCallMorphFunctionPass, and inlines
+ * copies of the helpers taken when they were linked in, before any
+ * instrumentation was added to them, so that the dynamic value pass run after
+ * it sees the inlined code as part of the generated function.
+ */
+class PandaHelperInlineFunctionPass : public FunctionPass {
+    // Helpers that can be inlined, mapped to their uninstrumented copies
+    std::map<Function*, Function*> bodies;
+public:
+    static char ID;
+    bool enabled; // Cleared by uninit_llvm_helpers()
+
+    PandaHelperInlineFunctionPass(Module *mod, unsigned threshold);
+
+    ~PandaHelperInlineFunctionPass();
+
+    bool runOnFunction(Function &F);
+
+    void getAnalysisUsage(AnalysisUsage &AU) const {
+        // We modify in a non-trivial way, so we do nothing here
+    }
+};
+
 } // End LLVM namespace
 
 #endif // __cplusplus
 
+#include <stdio.h>
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/*
+ * Helpers whose size (instructions, arguments and basic blocks) is at most
+ * llvm_inline_threshold are inlined into generated code, as are the softmmu
+ * fast paths.  0 leaves all helper calls out of line.
+ */
+extern uint64_t llvm_inline_threshold;
+
+struct LLVMHelperInlineStats {
+    uint64_t helpers;           /* helpers that can be inlined */
+    uint64_t inlined;           /* calls inlined */
+    uint64_t memory;            /* of which to softmmu loads and stores */
+    uint64_t skipped;           /* calls left out of line */
+};
+
+extern struct LLVMHelperInlineStats llvm_helper_inline_stats;
+
+void dump_llvm_helper_inline_stats(FILE *f,
+                                   int (*cpu_fprintf)(FILE *f, const char *fmt, ...));
+
+/*
+ * Don't inline a helper into a function that would then be larger than
+ * max_size, measured like llvm_inline_threshold.  0 means no limit.
+ */
+void limit_llvm_helper_inlining(unsigned max_size);
+
 /*
  * Start the process of including the execution of QEMU helper functions in the
  * LLVM JIT.
@@ -86,6 +146,11 @@ void init_llvm_helpers(void);
  */
 void uninit_llvm_helpers(void);
 
+/*
+ * Forget the helpers linked into the LLVM context, which is being destroyed.
+ */
+void forget_llvm_helpers(void);
+
 #ifdef __cplusplus
 }
 #endif
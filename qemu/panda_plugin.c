@@ -20,6 +20,7 @@ PANDAENDCOMMENT */
 #include "error.h"
 
 #ifdef CONFIG_LLVM
+#include "rr_log.h"
 #include "panda/panda_helper_call_morph.h"
 #include "tcg.h"
 #include "tcg-llvm.h"
@@ -28,6 +29,15 @@ PANDAENDCOMMENT */
 #include <dlfcn.h>
 #include <string.h>
 
+#ifdef CONFIG_SOFTMMU
+#include <errno.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <zlib.h>
+#endif
+
 
 // WARNING: this is all gloriously un-thread-safe
 
@@ -44,9 +54,11 @@ bool panda_plugins_to_unload[MAX_PANDA_PLUGINS];
 bool panda_plugin_to_unload = false;
 
 bool panda_please_flush_tb = false;
+bool panda_please_invalidate_tb = false;
 bool panda_update_pc = false;
 bool panda_use_memcb = false;
 bool panda_tb_chaining = true;
+bool panda_block_in_llvm = false;
 
 bool panda_add_arg(const char *arg, int arglen) {
     if (arglen > 255) return false;
@@ -165,9 +177,17 @@ void panda_unregister_callbacks(void *plugin) {
     }
 }
 
+// Guest virtual address ranges whose TBs plugins want retranslated
+#define MAX_PANDA_INVALIDATE_RANGES 64
+static target_ulong panda_invalidate_ranges[MAX_PANDA_INVALIDATE_RANGES][2];
+static int panda_nb_invalidate_ranges;
+
 bool panda_flush_tb(void) {
     if(panda_please_flush_tb) {
         panda_please_flush_tb = false;
+        // Everything gets retranslated anyway
+        panda_please_invalidate_tb = false;
+        panda_nb_invalidate_ranges = 0;
         return true;
     }
     else return false;
@@ -177,6 +197,29 @@ void panda_do_flush_tb(void) {
     panda_please_flush_tb = true;
 }
 
+void panda_do_invalidate_tb_range(target_ulong start, target_ulong end) {
+    if(panda_nb_invalidate_ranges == MAX_PANDA_INVALIDATE_RANGES) {
+        // Too many to keep track of; retranslate everything
+        panda_do_flush_tb();
+        return;
+    }
+    panda_invalidate_ranges[panda_nb_invalidate_ranges][0] = start;
+    panda_invalidate_ranges[panda_nb_invalidate_ranges][1] = end;
+    panda_nb_invalidate_ranges++;
+    panda_please_invalidate_tb = true;
+}
+
+int panda_invalidate_tb(void) {
+    int i, n = 0;
+    for(i = 0; i < panda_nb_invalidate_ranges; i++) {
+        n += tb_invalidate_virt_range(panda_invalidate_ranges[i][0],
+                                      panda_invalidate_ranges[i][1]);
+    }
+    panda_nb_invalidate_ranges = 0;
+    panda_please_invalidate_tb = false;
+    return n;
+}
+
 void panda_enable_precise_pc(void) {
     panda_update_pc = true;
 }
@@ -202,23 +245,52 @@ void panda_disable_tb_chaining(void){
 }
 
 #ifdef CONFIG_LLVM
+bool panda_please_disable_llvm = false;
+
 void panda_enable_llvm(void){
-    panda_do_flush_tb();
+    panda_please_disable_llvm = false;
+    // Blocks already translated are lowered to LLVM the first time they run
+    // under it (see cpu_gen_llvm), so nothing has to be flushed, unless TCG
+    // blocks may have been chained and would keep jumping to each other.
+    if (rr_mode != RR_REPLAY && panda_tb_chaining) {
+        panda_do_flush_tb();
+    }
     execute_llvm = 1;
     generate_llvm = 1;
-    tcg_llvm_ctx = tcg_llvm_initialize();
+    // The context (and any helper bitcode linked into it) is kept until
+    // LLVM is disabled again.
+    if (!tcg_llvm_ctx) {
+        tcg_llvm_ctx = tcg_llvm_initialize();
+        if (llvm_inline_threshold) {
+            init_llvm_helpers();
+        }
+    }
 }
 
 extern CPUState *env;
 
-void panda_disable_llvm(void){
+void panda_do_disable_llvm(void){
+    panda_please_disable_llvm = false;
     execute_llvm = 0;
     generate_llvm = 0;
     tb_flush(env);
+    forget_llvm_helpers();
     tcg_llvm_destroy();
     tcg_llvm_ctx = NULL;
 }
 
+void panda_disable_llvm(void){
+    // From inside a callback the current block may be about to run under
+    // LLVM, so the context is only torn down once control is back in the
+    // cpu_exec loop. No new block is chosen for LLVM in the meantime.
+    if (cpu_single_env && cpu_single_env->current_tb) {
+        execute_llvm = 0;
+        panda_please_disable_llvm = true;
+        return;
+    }
+    panda_do_disable_llvm();
+}
+
 void panda_enable_llvm_helpers(void){
     init_llvm_helpers();
 }
@@ -229,23 +301,375 @@ void panda_disable_llvm_helpers(void){
 
 #endif
 
+#ifdef CONFIG_SOFTMMU
+// Returns the ram offset backing physical page addr, or -1 if the page
+// isn't plain RAM (I/O, ROM, unassigned).
+static ram_addr_t panda_phys_page_to_ram(target_phys_addr_t addr) {
+    ram_addr_t pd = cpu_get_physical_page_desc(addr);
+    if ((pd & ~TARGET_PAGE_MASK) != IO_MEM_RAM) return -1;
+    return pd & TARGET_PAGE_MASK;
+}
+
+// Snapshots are written straight from guest RAM, as runs of physical pages
+// that are contiguous in host memory ("extents"). All-zero pages and pages
+// that aren't RAM are left out of the extents and written as holes.
+typedef struct {
+    uint64_t addr;
+    uint64_t len;
+    uint8_t *host;
+} memsavep_extent;
+
+#define MEMSAVEP_IOV 256
+#define MEMSAVEP_SPARSE_EXTENT (1 << 20)
+#define MEMSAVEP_SPARSE_WINDOW 4
+
+static bool panda_page_is_zero(const uint8_t *p) {
+    const unsigned long *w = (const unsigned long *)p;
+    size_t i;
+    for (i = 0; i < TARGET_PAGE_SIZE / sizeof(unsigned long); i++) {
+        if (w[i]) return false;
+    }
+    return true;
+}
+
+// Finds the extents of nonzero RAM below ram_size, in physical address
+// order, splitting them at max_len bytes if max_len is nonzero. Returns the
+// number of extents; *out must be freed with g_free.
+static int panda_memsavep_extents(memsavep_extent **out, uint64_t max_len) {
+    memsavep_extent *ext = NULL;
+    int n = 0, size = 0;
+    ram_addr_t addr, ram_addr;
+    for (addr = 0; addr < ram_size; addr += TARGET_PAGE_SIZE) {
+        ram_addr = panda_phys_page_to_ram(addr);
+        if (ram_addr == (ram_addr_t)-1) continue;
+        uint8_t *host = qemu_get_ram_ptr(ram_addr);
+        if (panda_page_is_zero(host)) continue;
+        if (n > 0 && ext[n-1].addr + ext[n-1].len == addr &&
+            ext[n-1].host + ext[n-1].len == host &&
+            (!max_len || ext[n-1].len < max_len)) {
+            ext[n-1].len += TARGET_PAGE_SIZE;
+            continue;
+        }
+        if (n == size) {
+            size = size ? size * 2 : 64;
+            ext = g_renew(memsavep_extent, ext, size);
+        }
+        ext[n].addr = addr;
+        ext[n].len = TARGET_PAGE_SIZE;
+        ext[n].host = host;
+        n++;
+    }
+    *out = ext;
+    return n;
+}
+
+// Batches buffers into writev calls on a raw file descriptor
+typedef struct {
+    int fd;
+    struct iovec iov[MEMSAVEP_IOV];
+    int n;
+    bool err;
+} memsavep_writer;
+
+static void memsavep_flush(memsavep_writer *w) {
+    struct iovec *iov = w->iov;
+    int n = w->n;
+    w->n = 0;
+    while (n > 0 && !w->err) {
+        ssize_t r = writev(w->fd, iov, n);
+        if (r < 0) {
+            if (errno == EINTR) continue;
+            perror("panda_memsavep: writev");
+            w->err = true;
+            break;
+        }
+        // Skip whatever was written and retry the rest
+        while (n > 0 && (size_t)r >= iov->iov_len) {
+            r -= iov->iov_len;
+            iov++;
+            n--;
+        }
+        if (n > 0) {
+            iov->iov_base = (uint8_t *)iov->iov_base + r;
+            iov->iov_len -= r;
+        }
+    }
+}
+
+static void memsavep_push(memsavep_writer *w, const void *buf, size_t len) {
+    if (w->n == MEMSAVEP_IOV) memsavep_flush(w);
+    w->iov[w->n].iov_base = (void *)buf;
+    w->iov[w->n].iov_len = len;
+    w->n++;
+}
+#endif
+
 void panda_memsavep(FILE *f) {
 #ifdef CONFIG_SOFTMMU
     if (!f) return;
-    uint8_t mem_buf[TARGET_PAGE_SIZE];
-    uint8_t zero_buf[TARGET_PAGE_SIZE];
-    memset(zero_buf, 0, TARGET_PAGE_SIZE);
-    int res;
-    ram_addr_t addr;
-    for (addr = 0; addr < ram_size; addr += TARGET_PAGE_SIZE) {
-        res = panda_physical_memory_rw(addr, mem_buf, TARGET_PAGE_SIZE, 0);
-        if (res == -1) { // I/O. Just fill page with zeroes.
-            fwrite(zero_buf, TARGET_PAGE_SIZE, 1, f);
+    static const uint8_t zero_buf[TARGET_PAGE_SIZE];
+    memsavep_extent *ext;
+    int n = panda_memsavep_extents(&ext, 0);
+    memsavep_writer w = { .fd = fileno(f) };
+
+    // Gaps become file holes if we can seek, explicit zeroes otherwise
+    fflush(f);
+    off_t start = lseek(w.fd, 0, SEEK_CUR);
+    bool seekable = (start != (off_t)-1);
+    uint64_t pos = 0;
+    int i;
+    for (i = 0; i <= n && !w.err; i++) {
+        uint64_t next = (i < n) ? ext[i].addr : ram_size;
+        if (next > pos) {
+            if (seekable) {
+                memsavep_flush(&w);
+                lseek(w.fd, next - pos, SEEK_CUR);
+            }
+            else {
+                uint64_t a;
+                for (a = pos; a < next; a += TARGET_PAGE_SIZE) {
+                    memsavep_push(&w, zero_buf, TARGET_PAGE_SIZE);
+                }
+            }
+            pos = next;
+        }
+        if (i == n) break;
+        memsavep_push(&w, ext[i].host, ext[i].len);
+        pos += ext[i].len;
+    }
+    memsavep_flush(&w);
+    g_free(ext);
+
+    if (seekable) {
+        // A trailing hole only moved the offset; make the file that long
+        struct stat st;
+        if (fstat(w.fd, &st) == 0 && st.st_size < start + (off_t)ram_size) {
+            if (ftruncate(w.fd, start + ram_size) < 0) {
+                perror("panda_memsavep: ftruncate");
+            }
+        }
+        fseeko(f, start + ram_size, SEEK_SET);
+    }
+#endif
+}
+
+#ifdef CONFIG_SOFTMMU
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t page_size;
+    uint64_t ram_size;
+    uint64_t nextents;
+} __attribute__((packed)) memsavep_sparse_header;
+
+typedef struct {
+    uint64_t addr;
+    uint64_t len;
+    uint64_t offset;
+    uint64_t stored_len;
+} __attribute__((packed)) memsavep_sparse_extent;
+
+// Shared state between the sparse snapshot writer and its compression
+// workers. Workers claim extents in order, but never more than window
+// extents ahead of the writer, so at most that many compressed buffers are
+// alive at once.
+typedef struct {
+    memsavep_extent *ext;
+    int n;
+    uint8_t **zbuf;         // compressed data, or NULL to store raw
+    uint64_t *zlen;
+    bool *done;
+    int next_claim;
+    int next_write;
+    int window;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+} memsavep_compress_job;
+
+static void *memsavep_compress_worker(void *opaque) {
+    memsavep_compress_job *j = opaque;
+    pthread_mutex_lock(&j->lock);
+    while (true) {
+        while (j->next_claim < j->n &&
+               j->next_claim >= j->next_write + j->window) {
+            pthread_cond_wait(&j->cond, &j->lock);
+        }
+        if (j->next_claim >= j->n) break;
+        int i = j->next_claim++;
+        pthread_mutex_unlock(&j->lock);
+
+        uLongf zlen = compressBound(j->ext[i].len);
+        uint8_t *z = g_malloc(zlen);
+        if (compress2(z, &zlen, j->ext[i].host, j->ext[i].len,
+                      Z_BEST_SPEED) != Z_OK || zlen >= j->ext[i].len) {
+            g_free(z);
+            z = NULL;
+            zlen = j->ext[i].len;
         }
-        else {
-            fwrite(mem_buf, TARGET_PAGE_SIZE, 1, f);
+
+        pthread_mutex_lock(&j->lock);
+        j->zbuf[i] = z;
+        j->zlen[i] = zlen;
+        j->done[i] = true;
+        pthread_cond_broadcast(&j->cond);
+    }
+    pthread_mutex_unlock(&j->lock);
+    return NULL;
+}
+
+// Compresses the extents on nthreads workers and writes them in order,
+// filling in table[i].offset/stored_len. Returns 0 or -1.
+static int memsavep_write_compressed(FILE *f, memsavep_extent *ext, int n,
+                                     memsavep_sparse_extent *table,
+                                     uint64_t off, int nthreads) {
+    memsavep_compress_job j;
+    pthread_t *workers = g_new(pthread_t, nthreads);
+    int i, ret = 0;
+
+    memset(&j, 0, sizeof(j));
+    j.ext = ext;
+    j.n = n;
+    j.zbuf = g_new0(uint8_t *, n);
+    j.zlen = g_new0(uint64_t, n);
+    j.done = g_new0(bool, n);
+    j.window = MEMSAVEP_SPARSE_WINDOW * nthreads;
+    pthread_mutex_init(&j.lock, NULL);
+    pthread_cond_init(&j.cond, NULL);
+    for (i = 0; i < nthreads; i++) {
+        pthread_create(&workers[i], NULL, memsavep_compress_worker, &j);
+    }
+
+    for (i = 0; i < n; i++) {
+        pthread_mutex_lock(&j.lock);
+        while (!j.done[i]) pthread_cond_wait(&j.cond, &j.lock);
+        pthread_mutex_unlock(&j.lock);
+
+        const uint8_t *data = j.zbuf[i] ? j.zbuf[i] : ext[i].host;
+        if (ret == 0 && fwrite(data, j.zlen[i], 1, f) != 1) ret = -1;
+        table[i].offset = off;
+        table[i].stored_len = j.zlen[i];
+        off += j.zlen[i];
+        g_free(j.zbuf[i]);
+
+        pthread_mutex_lock(&j.lock);
+        j.next_write = i + 1;
+        pthread_cond_broadcast(&j.cond);
+        pthread_mutex_unlock(&j.lock);
+    }
+
+    for (i = 0; i < nthreads; i++) {
+        pthread_join(workers[i], NULL);
+    }
+    pthread_mutex_destroy(&j.lock);
+    pthread_cond_destroy(&j.cond);
+    g_free(workers);
+    g_free(j.zbuf);
+    g_free(j.zlen);
+    g_free(j.done);
+    return ret;
+}
+#endif
+
+int panda_memsavep_sparse(FILE *f, int nthreads) {
+#ifdef CONFIG_SOFTMMU
+    if (!f) return -1;
+    memsavep_extent *ext;
+    int n = panda_memsavep_extents(&ext, MEMSAVEP_SPARSE_EXTENT);
+    memsavep_sparse_header hdr;
+    memsavep_sparse_extent *table = g_new0(memsavep_sparse_extent, n);
+    off_t start = ftello(f);
+    off_t table_pos = start + sizeof(hdr);
+    uint64_t off = table_pos + n * sizeof(*table);
+    int i, ret = 0;
+
+    memcpy(hdr.magic, "PANDASPM", 8);
+    hdr.version = 1;
+    hdr.page_size = TARGET_PAGE_SIZE;
+    hdr.ram_size = ram_size;
+    hdr.nextents = n;
+    for (i = 0; i < n; i++) {
+        table[i].addr = ext[i].addr;
+        table[i].len = ext[i].len;
+        table[i].offset = off;
+        table[i].stored_len = ext[i].len;
+        off += ext[i].len;
+    }
+    if (fwrite(&hdr, sizeof(hdr), 1, f) != 1 ||
+        fwrite(table, sizeof(*table), n, f) != (size_t)n) {
+        ret = -1;
+    }
+    else if (nthreads <= 0) {
+        // Uncompressed: offsets are already known, just stream the RAM out
+        memsavep_writer w = { .fd = fileno(f) };
+        fflush(f);
+        for (i = 0; i < n; i++) {
+            memsavep_push(&w, ext[i].host, ext[i].len);
+        }
+        memsavep_flush(&w);
+        if (w.err) ret = -1;
+        if (start != (off_t)-1) fseeko(f, off, SEEK_SET);
+    }
+    else if (start == (off_t)-1) {
+        // The table is rewritten once the compressed sizes are known,
+        // which needs a seekable file
+        fprintf(stderr, "panda_memsavep_sparse: compression needs a seekable file\n");
+        ret = -1;
+    }
+    else {
+        off = table_pos + n * sizeof(*table);
+        ret = memsavep_write_compressed(f, ext, n, table, off, nthreads);
+        off = n ? table[n-1].offset + table[n-1].stored_len : off;
+        if (ret == 0 &&
+            (fseeko(f, table_pos, SEEK_SET) != 0 ||
+             fwrite(table, sizeof(*table), n, f) != (size_t)n ||
+             fseeko(f, off, SEEK_SET) != 0)) {
+            ret = -1;
+        }
+    }
+
+    g_free(table);
+    g_free(ext);
+    return ret;
+#else
+    return -1;
+#endif
+}
+
+void panda_memsavep_dirty_reset(void) {
+#ifdef CONFIG_SOFTMMU
+    RAMBlock *block;
+    // reset_dirty must not span RAM blocks
+    QLIST_FOREACH(block, &ram_list.blocks, next) {
+        cpu_physical_memory_reset_dirty(block->offset,
+                                        block->offset + block->length,
+                                        PANDA_DIRTY_FLAG);
+    }
+#endif
+}
+
+int panda_memsavep_dirty(FILE *f) {
+#ifdef CONFIG_SOFTMMU
+    if (!f) return -1;
+    int npages = 0;
+    ram_addr_t addr, ram_addr;
+    for (addr = 0; addr < ram_size; addr += TARGET_PAGE_SIZE) {
+        ram_addr = panda_phys_page_to_ram(addr);
+        if (ram_addr == (ram_addr_t)-1) continue;
+        if (!cpu_physical_memory_get_dirty(ram_addr, PANDA_DIRTY_FLAG)) continue;
+        uint64_t page_addr = addr;
+        uint8_t *ptr = qemu_get_ram_ptr(ram_addr);
+        if (fwrite(&page_addr, sizeof(page_addr), 1, f) != 1 ||
+            fwrite(ptr, TARGET_PAGE_SIZE, 1, f) != 1) {
+            qemu_put_ram_ptr(ptr);
+            return -1;
         }
+        qemu_put_ram_ptr(ptr);
+        npages++;
     }
+    panda_memsavep_dirty_reset();
+    return npages;
+#else
+    return -1;
 #endif
 }
 
@@ -29,6 +29,7 @@ typedef enum panda_cb_type {
     PANDA_CB_BEFORE_BLOCK_TRANSLATE,    // Before translating each basic block
     PANDA_CB_AFTER_BLOCK_TRANSLATE,     // After translating each basic block
     PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT,    // Before executing each basic block (with option to invalidate, may trigger retranslation)
+    PANDA_CB_BEFORE_BLOCK_EXEC_LLVM_OPT,    // Before executing each basic block (with option to run it under LLVM)
     PANDA_CB_BEFORE_BLOCK_EXEC,         // Before executing each basic block
     PANDA_CB_AFTER_BLOCK_EXEC,          // After executing each basic block
     PANDA_CB_INSN_TRANSLATE,    // Before an insn is translated
@@ -50,8 +51,10 @@ typedef enum panda_cb_type {
     PANDA_CB_VMI_AFTER_FORK,    // After returning from fork()
     PANDA_CB_VMI_AFTER_EXEC,    // After returning from exec()
     PANDA_CB_VMI_AFTER_CLONE,    // After returning from clone()
+    PANDA_CB_VMI_AFTER_MMAP,    // After returning from mmap2()
 #endif
     PANDA_CB_VMI_PGD_CHANGED,   // After CPU's PGD is written to
+    PANDA_CB_BEFORE_LLVM_FREE,  // Before a TB's LLVM code is freed
     PANDA_CB_LAST,
 } panda_cb_type;
 
@@ -72,6 +75,22 @@ typedef union panda_cb {
     */
     bool (*before_block_exec_invalidate_opt)(CPUState *env, TranslationBlock *tb);
     
+    /* Callback ID: PANDA_CB_BEFORE_BLOCK_EXEC_LLVM_OPT
+
+       before_block_exec_llvm_opt: called before execution of every basic
+       block when LLVM is enabled, to choose whether it runs under LLVM or
+       TCG. If any callback is registered, only the blocks that at least one
+       of them returns true for run under LLVM.
+
+       Arguments:
+        CPUState *env: the current CPU state
+        TranslationBlock *tb: the TB we are about to execute
+
+       Return value:
+        true if the block should run under LLVM, false for TCG
+    */
+    bool (*before_block_exec_llvm_opt)(CPUState *env, TranslationBlock *tb);
+
     /* Callback ID: PANDA_CB_BEFORE_BLOCK_EXEC
 
        before_block_exec: called before execution of every basic block
@@ -404,6 +423,18 @@ typedef union panda_cb {
  *       unused
  */
     int (*return_from_clone)(CPUState *env);
+
+/* Callback ID: PANDA_CB_VMI_AFTER_MMAP
+ * 
+ *      return_from_mmap: Called after mmap2 returns, with the address of
+ *                        the new mapping (or an error) in the return register
+ *      Arguments:
+ *       CPUState *env: pointer to CPUState
+ * 
+ *      Return value:
+ *       unused
+ */
+    int (*return_from_mmap)(CPUState *env);
 #endif // CONFIG_PANDA_VMI
 
 /* Callback ID: PANDA_CB_VMI_PGD_CHANGED
@@ -418,7 +449,27 @@ typedef union panda_cb {
  *       unused
  */
     int (*after_PGD_write)(CPUState *env, target_ulong oldval, target_ulong newval);
-    
+
+/* Callback ID: PANDA_CB_BEFORE_LLVM_FREE
+ *
+ *      before_llvm_free: Called before the LLVM function and code for a TB
+ *                        are freed: on a full flush, on tb_free, when the
+ *                        TB's code buffer region is evicted, or when its
+ *                        code is collected to stay under -llvm-mem-limit
+ *                        (the TB is then lowered again, into a function
+ *                        with a new name, if it runs under LLVM again).
+ *                        Invalidating a TB alone doesn't free its LLVM
+ *                        code. Plugins that keep data keyed by LLVM
+ *                        functions or their names should drop it.
+ *      Arguments:
+ *       CPUState* env: pointer to CPUState (may be NULL)
+ *       TranslationBlock *tb: the TB; tb->llvm_function is still valid
+ *
+ *      Return value:
+ *       unused
+ */
+    int (*before_llvm_free)(CPUState *env, TranslationBlock *tb);
+
 } panda_cb;
 
 // Doubly linked list that stores a callback, along with its owner
@@ -451,28 +502,44 @@ int panda_physical_memory_rw(target_phys_addr_t addr, uint8_t *buf, int len, int
 #endif
 
 int panda_virtual_memory_rw(CPUState *env, target_ulong addr, uint8_t *buf, int len, int is_write);
+uint8_t *panda_virt_to_host(CPUState *env, target_ulong addr, int len);
 
 bool panda_flush_tb(void);
 
 void panda_do_flush_tb(void);
+// Retranslate only the code in the guest virtual address range [start, end)
+// (in every address space), once the current TB is done
+void panda_do_invalidate_tb_range(target_ulong start, target_ulong end);
+int panda_invalidate_tb(void);
 void panda_enable_precise_pc(void);
 void panda_disable_precise_pc(void);
 void panda_enable_memcb(void);
 void panda_disable_memcb(void);
 void panda_enable_llvm(void);
 void panda_disable_llvm(void);
+void panda_do_disable_llvm(void);
 void panda_enable_llvm_helpers(void);
 void panda_disable_llvm_helpers(void);
 void panda_enable_tb_chaining(void);
 void panda_disable_tb_chaining(void);
 void panda_memsavep(FILE *f);
+int panda_memsavep_sparse(FILE *f, int nthreads);
+void panda_memsavep_dirty_reset(void);
+int panda_memsavep_dirty(FILE *f);
 
 extern bool panda_update_pc;
+extern int panda_vtlb_enabled;
+extern uint64_t panda_vtlb_hits;
+extern uint64_t panda_vtlb_misses;
 extern bool panda_use_memcb;
 extern panda_cb_list *panda_cbs[PANDA_CB_LAST];
 extern bool panda_plugins_to_unload[MAX_PANDA_PLUGINS];
 extern bool panda_plugin_to_unload;
+extern bool panda_please_flush_tb;
+extern bool panda_please_invalidate_tb;
 extern bool panda_tb_chaining;
+extern bool panda_block_in_llvm;
+extern bool panda_please_disable_llvm;
 
 extern char panda_argv[MAX_PANDA_PLUGIN_ARGS][256];
 extern int panda_argc;
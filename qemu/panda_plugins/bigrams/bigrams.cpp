@@ -32,11 +32,14 @@ extern "C" {
 #include <stdlib.h>
 #include <ctype.h>
 #include <math.h>
-#include <map>
-#include <list>
+#include <string.h>
+#include <vector>
+#include <string>
 #include <algorithm>
 
 #include "../common/prog_point.h"
+#include "../common/tap_store.h"
+#include "bigrams.h"
 
 // These need to be extern "C" so that the ABI is compatible with
 // QEMU/PANDA, which is written in C
@@ -55,16 +58,67 @@ get_prog_point_t get_prog_point;
 uint64_t bytes_read, bytes_written;
 uint64_t num_reads, num_writes;
 
-struct text_counter {
-    bool started;
-    int num_bytes;
-    unsigned char prev_char;
-    std::map<unsigned short,unsigned int> hist;
-};
-
-std::map<prog_point,text_counter> text_tracker;
+tap_store<prog_point,text_counter,hash_prog_point> *text_tracker;
 //FILE *text_memlog;
 
+// Reference histograms for online classification, loaded from
+// -panda-arg bigrams:ref=<file> (65536 counts, as written by
+// scripts/make_bigram_hist.py). Matches go to bigram_matches.txt, using
+// the cosine distance threshold from bigrams:threshold=<dist> (default
+// 0.1).
+bigram_classifier<prog_point,hash_prog_point> classifier;
+FILE *match_log;
+
+static bool load_reference(const char *path, std::vector<double> &counts) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror("fopen");
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    rewind(f);
+    // numpy writes np.int, which is 64 bits on most hosts
+    bool ok = true;
+    if (len == 65536 * sizeof(int64_t)) {
+        std::vector<int64_t> raw(65536);
+        ok = fread(&raw[0], sizeof(int64_t), 65536, f) == 65536;
+        counts.assign(raw.begin(), raw.end());
+    }
+    else if (len == 65536 * sizeof(int32_t)) {
+        std::vector<int32_t> raw(65536);
+        ok = fread(&raw[0], sizeof(int32_t), 65536, f) == 65536;
+        counts.assign(raw.begin(), raw.end());
+    }
+    else {
+        printf("%s: not a bigram histogram (%ld bytes)\n", path, len);
+        ok = false;
+    }
+    fclose(f);
+    return ok;
+}
+
+static bool load_references(void) {
+    for (int i = 0; i < panda_argc; i++) {
+        if (0 == strncmp(panda_argv[i], "bigrams:ref=", 12)) {
+            std::vector<double> counts;
+            if (!load_reference(panda_argv[i] + 12, counts)) return false;
+            classifier.add_reference(panda_argv[i] + 12, counts);
+        }
+        else if (0 == strncmp(panda_argv[i], "bigrams:threshold=", 18)) {
+            classifier.threshold = atof(panda_argv[i] + 18);
+        }
+    }
+    return true;
+}
+
+static void report_match(const prog_point &p, size_t r, double dist,
+                         int num_bytes) {
+    fprintf(match_log, TARGET_FMT_lx " " TARGET_FMT_lx " " TARGET_FMT_lx " %s %f %d\n",
+        p.caller, p.pc, p.cr3, classifier.names[r].c_str(), dist, num_bytes);
+    fflush(match_log);
+}
+
 int mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
                        target_ulong size, void *buf) {
     bytes_written += size;
@@ -73,7 +127,9 @@ int mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
 
     get_prog_point(env, &p);
 
-    text_counter &tc = text_tracker[p];    
+    text_counter &tc = (*text_tracker)[p];
+    tap_score *score = NULL;
+    if (classifier.nrefs) score = &classifier.score(p, text_tracker->runs());
 
     for (unsigned int i = 0; i < size; i++) {
         unsigned char val = ((unsigned char *)buf)[i];
@@ -85,10 +141,12 @@ int mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
         else {
             unsigned short bigram;
             bigram = (tc.prev_char << 8) | val;
-            tc.hist[bigram]++;
+            unsigned int old = tc.hist.add(bigram, 1);
+            if (score) classifier.update(*score, bigram, old);
             tc.prev_char = val;
         }
         tc.num_bytes++;
+        if (score) classifier.check(p, *score, report_match);
     }
  
     return 1;
@@ -113,6 +171,20 @@ bool init_plugin(void *self) {
         return false;
     }
 
+    if (!load_references()) return false;
+    if (classifier.nrefs) {
+        printf("bigrams: classifying against %zu reference histograms\n",
+            classifier.nrefs);
+        match_log = fopen("bigram_matches.txt", "w");
+        if (!match_log) {
+            perror("fopen");
+            return false;
+        }
+    }
+
+    text_tracker = new tap_store<prog_point,text_counter,hash_prog_point>(
+        "bigram_mem_report", tap_store_mem_limit("bigrams"));
+
     // Need this to get EIP with our callbacks
     panda_enable_precise_pc();
     // Enable memory logging
@@ -142,30 +214,28 @@ void uninit_plugin(void *self) {
     uint32_t target_ulong_size = sizeof(target_ulong);
     fwrite(&target_ulong_size, sizeof(uint32_t), 1, mem_report);
 
-    std::map<prog_point,text_counter>::iterator it;
-    for(it = text_tracker.begin(); it != text_tracker.end(); it++) {
+    text_tracker->finish([mem_report](const prog_point &p, const text_counter &tc) {
         // Skip low-data entries
-        if (it->second.num_bytes < 80) continue;
+        if (tc.num_bytes < 80) return;
 
         unsigned int hist_keys = 0;
-        hist_keys = it->second.hist.size();
+        hist_keys = tc.hist.num_keys();
 
         // Write the program point
-        fwrite(&it->first, sizeof(prog_point), 1, mem_report);
+        fwrite(&p, sizeof(prog_point), 1, mem_report);
 
         // Write the number of keys
         fwrite(&hist_keys, sizeof(hist_keys), 1, mem_report);
-        
+
         // Write each key/value of the (hopefully sparse) histogram
-        std::map<unsigned short,unsigned int>::iterator it2;
-        for(it2 = it->second.hist.begin(); it2 != it->second.hist.end(); it2++) {
-            fwrite(&it2->first, sizeof(it2->first), 1, mem_report);   // Key: unsigned short
-            fwrite(&it2->second, sizeof(it2->second), 1, mem_report); // Value: unsigned int
-        }
-        //printf("Wrote histogram with %d entries (%ld bytes)\n", 
-        //    hist_keys, (sizeof(unsigned short)+sizeof(unsigned long))*hist_keys + sizeof(prog_point) + sizeof(hist_keys));
-    }
+        tc.hist.for_each([mem_report](unsigned short k, unsigned int v) {
+            fwrite(&k, sizeof(k), 1, mem_report);   // Key: unsigned short
+            fwrite(&v, sizeof(v), 1, mem_report);   // Value: unsigned int
+        });
+    });
     fclose(mem_report);
-    
+    delete text_tracker;
+    if (match_log) fclose(match_log);
+
     //fclose(text_memlog);
 }
@@ -0,0 +1,242 @@
+/* PANDABEGINCOMMENT
+ *
+ * Authors:
+ *  Tim Leek               tleek@ll.mit.edu
+ *  Ryan Whelan            rwhelan@ll.mit.edu
+ *  Joshua Hodosh          josh.hodosh@ll.mit.edu
+ *  Michael Zhivich        mzhivich@ll.mit.edu
+ *  Brendan Dolan-Gavitt   brendandg@gatech.edu
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+#ifndef __BIGRAMS_H__
+#define __BIGRAMS_H__
+
+// Per-tap bigram histograms and the online classifier. Kept free of QEMU
+// headers so bigrams_test can drive them against a tap_store directly.
+// Requires C++11.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <unordered_map>
+
+// Bigram histograms start out as a sorted (bigram, count) vector and are
+// promoted to a dense 64K-entry array once they have more than
+// BIGRAM_DENSE_THRESHOLD distinct bigrams, so the many taps that only
+// ever see a handful of bytes stay small.
+#define BIGRAM_DENSE_THRESHOLD 4096
+
+struct bigram_hist {
+    std::vector<std::pair<unsigned short,unsigned int> > sparse;
+    std::vector<unsigned int> dense;
+
+    // Returns the count before the add
+    unsigned int add(unsigned short bigram, unsigned int n) {
+        unsigned int old;
+        if (!dense.empty()) {
+            old = dense[bigram];
+            dense[bigram] += n;
+            return old;
+        }
+        std::vector<std::pair<unsigned short,unsigned int> >::iterator it;
+        it = std::lower_bound(sparse.begin(), sparse.end(),
+                std::make_pair(bigram, 0U));
+        if (it != sparse.end() && it->first == bigram) {
+            old = it->second;
+            it->second += n;
+            return old;
+        }
+        sparse.insert(it, std::make_pair(bigram, n));
+        if (sparse.size() > BIGRAM_DENSE_THRESHOLD) {
+            dense.assign(65536, 0);
+            for (it = sparse.begin(); it != sparse.end(); it++)
+                dense[it->first] = it->second;
+            std::vector<std::pair<unsigned short,unsigned int> >().swap(sparse);
+        }
+        return 0;
+    }
+
+    unsigned int num_keys() const {
+        if (dense.empty()) return sparse.size();
+        return dense.size() - std::count(dense.begin(), dense.end(), 0U);
+    }
+
+    // Calls f(bigram, count) for each nonzero entry in increasing order
+    template <typename F>
+    void for_each(F f) const {
+        if (dense.empty()) {
+            for (size_t i = 0; i < sparse.size(); i++)
+                f(sparse[i].first, sparse[i].second);
+        }
+        else {
+            for (size_t i = 0; i < dense.size(); i++)
+                if (dense[i]) f((unsigned short)i, dense[i]);
+        }
+    }
+
+    size_t heap_bytes() const {
+        return sparse.capacity() * sizeof(sparse[0]) +
+               dense.capacity() * sizeof(dense[0]);
+    }
+};
+
+// prev_char does not survive a spill, so each time the store spills we
+// lose at most one bigram per tap.
+struct text_counter {
+    bool started;
+    int num_bytes;
+    unsigned char prev_char;
+    bigram_hist hist;
+
+    text_counter() : started(false), num_bytes(0), prev_char(0) {}
+
+    void merge(const text_counter &o) {
+        num_bytes += o.num_bytes;
+        bigram_hist &h = hist;
+        o.hist.for_each([&h](unsigned short k, unsigned int v) { h.add(k, v); });
+    }
+
+    size_t heap_bytes() const {
+        return hist.heap_bytes();
+    }
+
+    void write(FILE *f) const {
+        unsigned int hist_keys = hist.num_keys();
+        fwrite(&num_bytes, sizeof(num_bytes), 1, f);
+        fwrite(&hist_keys, sizeof(hist_keys), 1, f);
+        hist.for_each([f](unsigned short k, unsigned int v) {
+            fwrite(&k, sizeof(k), 1, f);
+            fwrite(&v, sizeof(v), 1, f);
+        });
+    }
+
+    bool read(FILE *f) {
+        unsigned int hist_keys;
+        if (fread(&num_bytes, sizeof(num_bytes), 1, f) != 1) return false;
+        if (fread(&hist_keys, sizeof(hist_keys), 1, f) != 1) return false;
+        for (unsigned int i = 0; i < hist_keys; i++) {
+            unsigned short k;
+            unsigned int v;
+            if (fread(&k, sizeof(k), 1, f) != 1) return false;
+            if (fread(&v, sizeof(v), 1, f) != 1) return false;
+            hist.add(k, v);
+        }
+        return true;
+    }
+};
+
+// A tap is rescored every BIGRAM_SCORE_INTERVAL bytes and reported the
+// first time its cosine distance to a reference drops below the
+// threshold.
+#define BIGRAM_SCORE_INTERVAL 64
+#define BIGRAM_MIN_BYTES 80
+
+// Online classifier state for one tap. It lives outside the tap_store and
+// is never spilled -- a few doubles per reference is small next to the
+// histogram -- so scores keep accumulating and a tap is reported at most
+// once per reference for the whole run.
+//
+// The dot products are linear in the histogram and stay exact. The
+// squared norm is not: after a spill the histogram restarts from zero, so
+// the counts it hands back only cover the current segment. We keep the
+// exact squared norm of the current segment plus the sum of the norms of
+// the segments already spilled; by the triangle inequality that sum is an
+// upper bound on the true norm, so a spilled tap can only look further
+// from a reference than it really is, never closer.
+struct tap_score {
+    std::vector<double> dots;
+    std::vector<bool> matched;
+    uint64_t norm2;         // current segment
+    double spilled_norm;    // sum of the norms of earlier segments
+    int run;                // tap_store run count the segment started at
+    int num_bytes;
+
+    tap_score() : norm2(0), spilled_norm(0), run(0), num_bytes(0) {}
+
+    double norm() const { return spilled_norm + sqrt((double)norm2); }
+};
+
+// Reference histograms are scaled to unit length and stored bigram-major,
+// matrix[bigram*nrefs + r], so updating a tap's dot products for one new
+// bigram is a contiguous run of adds the compiler can vectorize.
+template <typename K, typename Hash>
+struct bigram_classifier {
+    std::vector<std::string> names;
+    std::vector<float> matrix;
+    size_t nrefs;
+    double threshold;
+    std::unordered_map<K, tap_score, Hash> scores;
+
+    bigram_classifier() : nrefs(0), threshold(0.1) {}
+
+    // Takes raw 65536-entry counts; all-zero references are dropped
+    void add_reference(const std::string &name, std::vector<double> counts) {
+        double norm = 0;
+        for (size_t k = 0; k < counts.size(); k++) norm += counts[k] * counts[k];
+        if (norm == 0) return;
+        norm = sqrt(norm);
+        std::vector<float> m(65536 * (nrefs + 1));
+        for (size_t k = 0; k < 65536; k++) {
+            for (size_t r = 0; r < nrefs; r++)
+                m[k * (nrefs + 1) + r] = matrix[k * nrefs + r];
+            m[k * (nrefs + 1) + nrefs] = counts[k] / norm;
+        }
+        matrix.swap(m);
+        names.push_back(name);
+        nrefs++;
+    }
+
+    // Returns the tap's score, starting a new norm segment if the store
+    // has spilled since the tap was last seen.
+    tap_score &score(const K &key, int runs) {
+        tap_score &s = scores[key];
+        if (s.dots.empty()) {
+            s.dots.assign(nrefs, 0.0);
+            s.matched.assign(nrefs, false);
+            s.run = runs;
+        }
+        else if (s.run != runs) {
+            s.spilled_norm += sqrt((double)s.norm2);
+            s.norm2 = 0;
+            s.run = runs;
+        }
+        return s;
+    }
+
+    // old is the bigram's count in the tap's in-memory histogram before
+    // the add, as returned by bigram_hist::add
+    void update(tap_score &s, unsigned short bigram, unsigned int old) {
+        // ||h + e_k||^2 = ||h||^2 + 2*h[k] + 1
+        s.norm2 += 2 * (uint64_t)old + 1;
+        const float *row = &matrix[bigram * nrefs];
+        double *dots = &s.dots[0];
+        for (size_t r = 0; r < nrefs; r++) dots[r] += row[r];
+    }
+
+    // Call once per byte written to the tap; calls
+    // report(key, ref, dist, num_bytes) for each new match
+    template <typename F>
+    void check(const K &key, tap_score &s, F report) {
+        s.num_bytes++;
+        if (!s.norm2 || s.num_bytes < BIGRAM_MIN_BYTES ||
+                s.num_bytes % BIGRAM_SCORE_INTERVAL != 0)
+            return;
+        double norm = s.norm();
+        for (size_t r = 0; r < nrefs; r++) {
+            if (s.matched[r]) continue;
+            double dist = 1.0 - s.dots[r] / norm;
+            if (dist < threshold) {
+                s.matched[r] = true;
+                report(key, r, dist, s.num_bytes);
+            }
+        }
+    }
+};
+
+#endif
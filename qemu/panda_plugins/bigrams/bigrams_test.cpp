@@ -0,0 +1,148 @@
+/* PANDABEGINCOMMENT
+ *
+ * Authors:
+ *  Tim Leek               tleek@ll.mit.edu
+ *  Ryan Whelan            rwhelan@ll.mit.edu
+ *  Joshua Hodosh          josh.hodosh@ll.mit.edu
+ *  Michael Zhivich        mzhivich@ll.mit.edu
+ *  Brendan Dolan-Gavitt   brendandg@gatech.edu
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+
+/*
+ * This test feeds text to a few taps through a tap_store, forcing spills
+ * in the middle, and checks that the online classifier keeps its scores
+ * across them: a tap that matches is reported exactly once, and a tap
+ * that had only seen part of its text when the store spilled still
+ * matches afterwards.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <functional>
+#include <map>
+
+// tap_store.h reads these for tap_store_mem_limit
+char panda_argv[1][256];
+int panda_argc;
+
+#include "../common/tap_store.h"
+#include "bigrams.h"
+
+typedef uint64_t tap_t;
+
+static const char text[] =
+    "It was the best of times, it was the worst of times, it was the age "
+    "of wisdom, it was the age of foolishness, it was the epoch of belief. ";
+
+tap_store<tap_t,text_counter,std::hash<tap_t> > *store;
+bigram_classifier<tap_t,std::hash<tap_t> > classifier;
+std::map<tap_t,int> reports;
+
+// Same per-byte loop as mem_write_callback
+static void write_tap(tap_t tap, const unsigned char *buf, size_t size) {
+    text_counter &tc = (*store)[tap];
+    tap_score &score = classifier.score(tap, store->runs());
+    for (size_t i = 0; i < size; i++) {
+        unsigned char val = buf[i];
+        if (!tc.started) {
+            tc.prev_char = val;
+            tc.started = true;
+        }
+        else {
+            unsigned short bigram = (tc.prev_char << 8) | val;
+            unsigned int old = tc.hist.add(bigram, 1);
+            classifier.update(score, bigram, old);
+            tc.prev_char = val;
+        }
+        tc.num_bytes++;
+        classifier.check(tap, score,
+            [](const tap_t &t, size_t r, double dist, int num_bytes) {
+                printf("tap %lu matched %s at %d bytes (%f)\n",
+                    (unsigned long)t, classifier.names[r].c_str(),
+                    num_bytes, dist);
+                reports[t]++;
+            });
+    }
+}
+
+// Writes n bytes of the text, continuing where the tap left off
+static void write_text(tap_t tap, size_t &off, size_t n) {
+    size_t len = sizeof(text) - 1;
+    for (size_t i = 0; i < n; i++, off++)
+        write_tap(tap, (const unsigned char *)&text[off % len], 1);
+}
+
+static void write_noise(tap_t tap, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        unsigned char val = rand();
+        write_tap(tap, &val, 1);
+    }
+}
+
+int main(int argc, char **argv) {
+    int failed = 0;
+    char prefix[64];
+    snprintf(prefix, sizeof(prefix), "bigrams_test.%d", (int)getpid());
+    store = new tap_store<tap_t,text_counter,std::hash<tap_t> >(prefix,
+        TAP_STORE_DEFAULT_MEM_LIMIT);
+
+    std::vector<double> ref(65536, 0.0);
+    size_t len = sizeof(text) - 1;
+    for (size_t i = 0; i < 8 * len; i++)
+        ref[((unsigned char)text[i % len] << 8) |
+            (unsigned char)text[(i + 1) % len]] += 1;
+    classifier.add_reference("text", ref);
+
+    // Tap 1 matches before the spill and keeps writing the same text
+    // after it; tap 2 has fewer than BIGRAM_MIN_BYTES when the store
+    // spills; tap 3 never matches.
+    size_t off1 = 0, off2 = 0;
+    write_text(1, off1, 3 * BIGRAM_SCORE_INTERVAL);
+    write_text(2, off2, BIGRAM_MIN_BYTES - 10);
+    write_noise(3, 3 * BIGRAM_SCORE_INTERVAL);
+    store->spill();
+    write_text(1, off1, 3 * BIGRAM_SCORE_INTERVAL);
+    write_text(2, off2, 2 * BIGRAM_SCORE_INTERVAL);
+    store->spill();
+    write_text(1, off1, 3 * BIGRAM_SCORE_INTERVAL);
+    write_noise(3, 3 * BIGRAM_SCORE_INTERVAL);
+
+    if (store->runs() != 2) {
+        printf("FAIL: expected 2 spill runs, got %d\n", store->runs());
+        failed++;
+    }
+    if (reports[1] != 1) {
+        printf("FAIL: tap 1 reported %d times, expected once\n", reports[1]);
+        failed++;
+    }
+    if (reports[2] != 1) {
+        printf("FAIL: tap 2 reported %d times, expected once\n", reports[2]);
+        failed++;
+    }
+    if (reports[3] != 0) {
+        printf("FAIL: tap 3 reported %d times, expected never\n", reports[3]);
+        failed++;
+    }
+
+    // The merged histograms still see every byte
+    std::map<tap_t,int> bytes;
+    store->finish([&bytes](const tap_t &t, const text_counter &tc) {
+        bytes[t] = tc.num_bytes;
+    });
+    if (bytes[1] != 9 * BIGRAM_SCORE_INTERVAL) {
+        printf("FAIL: tap 1 merged %d bytes, expected %d\n", bytes[1],
+            9 * BIGRAM_SCORE_INTERVAL);
+        failed++;
+    }
+    delete store;
+
+    if (failed) return 1;
+    printf("PASS\n");
+    return 0;
+}
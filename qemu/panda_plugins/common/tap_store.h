@@ -0,0 +1,263 @@
+/* PANDABEGINCOMMENT
+ *
+ * Authors:
+ *  Tim Leek               tleek@ll.mit.edu
+ *  Ryan Whelan            rwhelan@ll.mit.edu
+ *  Joshua Hodosh          josh.hodosh@ll.mit.edu
+ *  Michael Zhivich        mzhivich@ll.mit.edu
+ *  Brendan Dolan-Gavitt   brendandg@gatech.edu
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+#ifndef __TAP_STORE_H__
+#define __TAP_STORE_H__
+
+// Bounded-memory aggregation of per-tap statistics.
+//
+// tap_store<K,V,Hash> keeps the live entries in an open-addressed hash
+// table. Every TAP_STORE_CHECK_INTERVAL lookups it estimates its memory use,
+// and once that exceeds mem_limit it writes all entries to disk as a run
+// sorted by K::operator< and starts over with an empty table. finish()
+// merges the runs and whatever is still in memory, combining entries for
+// the same key, and hands each key to a callback in sorted order -- the
+// same order iterating a std::map<K,V> would give, so plugins can write
+// their existing report formats unchanged.
+//
+// K must be a POD with operator<. V must provide:
+//   void merge(const V &other);     // fold other's counts into this one
+//   size_t heap_bytes() const;      // memory owned outside sizeof(V)
+//   void write(FILE *f) const;      // serialize to a spill run
+//   bool read(FILE *f);             // deserialize, false on EOF
+//
+// Requires C++11.
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+#define TAP_STORE_DEFAULT_MEM_LIMIT (512ULL << 20)
+#define TAP_STORE_CHECK_INTERVAL    (1 << 20)
+#define TAP_STORE_INITIAL_SIZE      (1 << 12)
+
+// Simple additive counter for use as a tap_store value
+template <typename T>
+struct tap_count {
+    T n;
+    tap_count() : n(0) {}
+    void merge(const tap_count &o) { n += o.n; }
+    size_t heap_bytes() const { return 0; }
+    void write(FILE *f) const { fwrite(&n, sizeof(n), 1, f); }
+    bool read(FILE *f) { return fread(&n, sizeof(n), 1, f) == 1; }
+};
+
+// Look for -panda-arg <plugin>:mem_limit=<MB>
+static inline uint64_t tap_store_mem_limit(const char *plugin) {
+    char prefix[256];
+    snprintf(prefix, sizeof(prefix), "%s:mem_limit=", plugin);
+    size_t len = strlen(prefix);
+    for (int i = 0; i < panda_argc; i++) {
+        if (0 == strncmp(panda_argv[i], prefix, len)) {
+            return strtoull(panda_argv[i] + len, NULL, 0) << 20;
+        }
+    }
+    return TAP_STORE_DEFAULT_MEM_LIMIT;
+}
+
+template <typename K, typename V, typename Hash>
+class tap_store {
+public:
+    tap_store(const std::string &prefix,
+              uint64_t mem_limit = TAP_STORE_DEFAULT_MEM_LIMIT)
+        : prefix(prefix), mem_limit(mem_limit), count(0), ops(0), nruns(0) {
+        table.resize(TAP_STORE_INITIAL_SIZE);
+    }
+
+    ~tap_store() { remove_runs(); }
+
+    // Find or create the entry for key. The reference is only valid until
+    // the next call, since that may spill or grow the table.
+    V &operator[](const K &key) {
+        if (++ops % TAP_STORE_CHECK_INTERVAL == 0 && mem_usage() > mem_limit) {
+            spill();
+        }
+        size_t i = find(key);
+        if (!table[i].used) {
+            if ((count + 1) * 2 > table.size()) {
+                grow();
+                i = find(key);
+            }
+            table[i].used = true;
+            table[i].key = key;
+            count++;
+        }
+        return table[i].val;
+    }
+
+    size_t size() const { return count; }
+    int runs() const { return nruns; }
+
+    size_t mem_usage() const {
+        size_t bytes = table.size() * sizeof(slot);
+        for (size_t i = 0; i < table.size(); i++) {
+            if (table[i].used) bytes += table[i].val.heap_bytes();
+        }
+        return bytes;
+    }
+
+    // Write the current contents out as a sorted run and empty the table
+    bool spill() {
+        if (count == 0) return true;
+        std::string path = run_path(nruns);
+        FILE *f = fopen(path.c_str(), "wb");
+        if (!f) {
+            perror("tap_store: fopen");
+            return false;
+        }
+        std::vector<slot *> sorted = sorted_slots();
+        for (size_t i = 0; i < sorted.size(); i++) {
+            fwrite(&sorted[i]->key, sizeof(K), 1, f);
+            sorted[i]->val.write(f);
+        }
+        fclose(f);
+        nruns++;
+        std::vector<slot>(TAP_STORE_INITIAL_SIZE).swap(table);
+        count = 0;
+        return true;
+    }
+
+    // Merge all runs with the in-memory entries and call emit(key, value)
+    // once per distinct key, in increasing key order. The store is empty
+    // afterwards.
+    template <typename F>
+    void finish(F emit) {
+        std::vector<run_reader> readers(nruns);
+        for (int r = 0; r < nruns; r++) {
+            readers[r].f = fopen(run_path(r).c_str(), "rb");
+            if (!readers[r].f) perror("tap_store: fopen");
+            readers[r].next();
+        }
+        std::vector<slot *> mem = sorted_slots();
+        size_t mi = 0;
+
+        while (true) {
+            const K *min = NULL;
+            for (size_t r = 0; r < readers.size(); r++) {
+                if (readers[r].valid && (!min || readers[r].key < *min))
+                    min = &readers[r].key;
+            }
+            if (mi < mem.size() && (!min || mem[mi]->key < *min))
+                min = &mem[mi]->key;
+            if (!min) break;
+
+            K key = *min;
+            V acc;
+            for (size_t r = 0; r < readers.size(); r++) {
+                while (readers[r].valid && key_eq(readers[r].key, key)) {
+                    acc.merge(readers[r].val);
+                    readers[r].next();
+                }
+            }
+            if (mi < mem.size() && key_eq(mem[mi]->key, key)) {
+                acc.merge(mem[mi]->val);
+                mi++;
+            }
+            emit(key, acc);
+        }
+
+        for (size_t r = 0; r < readers.size(); r++) {
+            if (readers[r].f) fclose(readers[r].f);
+        }
+        remove_runs();
+        std::vector<slot>(TAP_STORE_INITIAL_SIZE).swap(table);
+        count = 0;
+    }
+
+private:
+    struct slot {
+        K key;
+        V val;
+        bool used;
+        slot() : key(), val(), used(false) {}
+    };
+
+    struct run_reader {
+        FILE *f;
+        K key;
+        V val;
+        bool valid;
+        run_reader() : f(NULL), key(), val(), valid(false) {}
+        void next() {
+            val = V();
+            valid = f && fread(&key, sizeof(K), 1, f) == 1 && val.read(f);
+        }
+    };
+
+    static bool key_eq(const K &a, const K &b) {
+        return !(a < b) && !(b < a);
+    }
+
+    static bool slot_less(const slot *a, const slot *b) {
+        return a->key < b->key;
+    }
+
+    // Linear probe for key; returns its slot or the empty slot where it
+    // belongs. The multiply spreads weak hashes (e.g. xor of fields)
+    // across the table.
+    size_t find(const K &key) const {
+        size_t mask = table.size() - 1;
+        size_t i = ((uint64_t)Hash()(key) * 0x9e3779b97f4a7c15ULL) >> 32 & mask;
+        while (table[i].used && !key_eq(table[i].key, key)) {
+            i = (i + 1) & mask;
+        }
+        return i;
+    }
+
+    void grow() {
+        std::vector<slot> old(table.size() * 2);
+        old.swap(table);
+        for (size_t i = 0; i < old.size(); i++) {
+            if (!old[i].used) continue;
+            size_t j = find(old[i].key);
+            table[j].used = true;
+            table[j].key = old[i].key;
+            std::swap(table[j].val, old[i].val);
+        }
+    }
+
+    std::vector<slot *> sorted_slots() {
+        std::vector<slot *> sorted;
+        sorted.reserve(count);
+        for (size_t i = 0; i < table.size(); i++) {
+            if (table[i].used) sorted.push_back(&table[i]);
+        }
+        std::sort(sorted.begin(), sorted.end(), slot_less);
+        return sorted;
+    }
+
+    std::string run_path(int n) const {
+        char suffix[32];
+        snprintf(suffix, sizeof(suffix), ".run.%d", n);
+        return prefix + suffix;
+    }
+
+    void remove_runs() {
+        for (int r = 0; r < nruns; r++) unlink(run_path(r).c_str());
+        nruns = 0;
+    }
+
+    std::string prefix;
+    uint64_t mem_limit;
+    std::vector<slot> table;
+    size_t count;
+    uint64_t ops;
+    int nruns;
+};
+
+#endif
@@ -32,11 +32,10 @@ extern "C" {
 #include <stdlib.h>
 #include <ctype.h>
 #include <math.h>
-#include <map>
-#include <list>
 #include <algorithm>
 
 #include "../common/prog_point.h"
+#include "../common/tap_store.h"
 
 // These need to be extern "C" so that the ABI is compatible with
 // QEMU/PANDA, which is written in C
@@ -59,7 +58,13 @@ struct recent_addr {
 #define HISTORY_SIZE 5
 recent_addr history[HISTORY_SIZE];
 int history_pos = 0;
-std::map<std::pair<prog_point,prog_point>,int> correlated;
+typedef std::pair<prog_point,prog_point> tap_pair;
+struct hash_tap_pair {
+    size_t operator()(const tap_pair &p) const {
+        return hash_prog_point()(p.first) * 31 + hash_prog_point()(p.second);
+    }
+};
+tap_store<tap_pair,tap_count<int>,hash_tap_pair> *correlated;
 
 int mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
                        target_ulong size, void *buf) {
@@ -69,9 +74,9 @@ int mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
     for (int i = 0; i < HISTORY_SIZE; i++) {
         if (history[i].p == p) continue;
         if (addr == history[i].end_addr)
-            correlated[std::make_pair(history[i].p, p)]++;
+            (*correlated)[std::make_pair(history[i].p, p)].n++;
         else if (addr+size == history[i].start_addr)
-            correlated[std::make_pair(p, history[i].p)]++;
+            (*correlated)[std::make_pair(p, history[i].p)].n++;
     }
 
     // Handle cases like rep stosd. We want to keep extending the
@@ -109,6 +114,9 @@ bool init_plugin(void *self) {
 
     printf("Initializing plugin correlatetaps\n");
 
+    correlated = new tap_store<tap_pair,tap_count<int>,hash_tap_pair>(
+        "correlated_taps", tap_store_mem_limit("correlatetaps"));
+
     void *cs_plugin = panda_get_plugin_by_name("panda_callstack_instr.so");
     if (!cs_plugin) {
         printf("Couldn't load callstack plugin\n");
@@ -142,11 +150,11 @@ void uninit_plugin(void *self) {
         return;
     }
 
-    std::map<std::pair<prog_point,prog_point>,int>::iterator it;
-    for(it = correlated.begin(); it != correlated.end(); it++) {
-        fwrite(&it->first.first, sizeof(prog_point), 1, mem_report);
-        fwrite(&it->first.second, sizeof(prog_point), 1, mem_report);
-        fwrite(&it->second, sizeof(int), 1, mem_report);
-    }
+    correlated->finish([mem_report](const tap_pair &k, const tap_count<int> &c) {
+        fwrite(&k.first, sizeof(prog_point), 1, mem_report);
+        fwrite(&k.second, sizeof(prog_point), 1, mem_report);
+        fwrite(&c.n, sizeof(int), 1, mem_report);
+    });
     fclose(mem_report);
+    delete correlated;
 }
@@ -28,10 +28,17 @@ extern "C" {
 }
 
 #include "keyfind.h"
+#include <openssl/crypto.h>
 #include <unordered_set>
+#include <unordered_map>
+#include <array>
 #include <vector>
 #include <set>
 #include <map>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 // These need to be extern "C" so that the ABI is compatible with
 // QEMU/PANDA, which is written in C
@@ -67,10 +74,8 @@ void read_hex_string(std::string in, unsigned char *out)
     }
 }
 
-// Globals
-StringInfo g_keydata;
-StringInfo g_master_secret;
-StringInfo g_out;
+// Globals. These are read-only once init_plugin is done, so the
+// verification workers can share them.
 StringInfo g_client_random;
 StringInfo g_server_random;
 StringInfo g_version;
@@ -119,15 +124,18 @@ struct key_buf {
 std::set<prog_point> matches;
 std::map<prog_point,key_buf> key_tracker;
 
-bool check_key(StringInfo *master_secret, StringInfo *client_random, StringInfo *server_random,
+// keydata and out are scratch buffers owned by the caller, sized for the
+// key block and the decrypted message respectively
+bool check_key(StringInfo *master_secret, StringInfo *keydata, StringInfo *out,
+               StringInfo *client_random, StringInfo *server_random,
                StringInfo *enc_msg, StringInfo *version, StringInfo *content_type,
                const EVP_MD *md, const EVP_CIPHER *ciph)
 {
     // Generate the session keys
     if (version->data[0] == 0x03 && version->data[1] == 0x03) {
-        tls12_prf(EVP_sha256(), master_secret, "key expansion", server_random, client_random, &g_keydata);
+        tls12_prf(EVP_sha256(), master_secret, "key expansion", server_random, client_random, keydata);
     } else {
-        tls_prf(master_secret, "key expansion", server_random, client_random, &g_keydata);
+        tls_prf(master_secret, "key expansion", server_random, client_random, keydata);
     }
     
     // Divvy up the key block
@@ -138,7 +146,7 @@ bool check_key(StringInfo *master_secret, StringInfo *client_random, StringInfo
     unsigned char *client_enc_iv;
     //unsigned char *server_enc_iv;
 
-    unsigned char *keyblock_ptr = g_keydata.data;
+    unsigned char *keyblock_ptr = keydata->data;
     // Client MAC
     client_mac_key = keyblock_ptr;
     keyblock_ptr += EVP_MD_size(md);
@@ -167,11 +175,11 @@ bool check_key(StringInfo *master_secret, StringInfo *client_random, StringInfo
     EVP_CIPHER_CTX_set_padding(&ctx, 1);
     res = EVP_DecryptInit_ex(&ctx, ciph, NULL, client_enc_key, client_enc_iv);
     CHECK(res, "EVP_DecryptInit");
-    res = EVP_DecryptUpdate(&ctx, g_out.data, &tmp_len, enc_msg->data, enc_msg->data_len);
+    res = EVP_DecryptUpdate(&ctx, out->data, &tmp_len, enc_msg->data, enc_msg->data_len);
     CHECK(res, "EVP_DecryptUpdate");
     dec_data_len += tmp_len;
     tmp_len = enc_msg->data_len - dec_data_len;
-    EVP_DecryptFinal_ex(&ctx, g_out.data+dec_data_len, &tmp_len); 
+    EVP_DecryptFinal_ex(&ctx, out->data+dec_data_len, &tmp_len); 
     CHECK(res, "EVP_DecryptFinal");
     dec_data_len += tmp_len;
     EVP_CIPHER_CTX_cleanup(&ctx);
@@ -179,12 +187,12 @@ bool check_key(StringInfo *master_secret, StringInfo *client_random, StringInfo
     // For some reason there's always one byte of extra padding?
     // This only applies to block ciphers, of course.
     if (EVP_CIPHER_block_size(ciph) != 1) dec_data_len--;
-    g_out.data_len = dec_data_len;
-    ssl_print_string("decrypted data", &g_out);
+    out->data_len = dec_data_len;
+    ssl_print_string("decrypted data", out);
     
     unsigned short msg_len = dec_data_len - EVP_MD_size(md);
-    unsigned char *msg = g_out.data;
-    unsigned char *mac = g_out.data + msg_len;
+    unsigned char *msg = out->data;
+    unsigned char *mac = out->data + msg_len;
 
     // TLS 1.1 and 1.2 provide an IV in the decrypted data. Skip it.
     if (version->data[0] == 0x03 && version->data[1] > 0x01) {
@@ -219,6 +227,149 @@ bool check_key(StringInfo *master_secret, StringInfo *client_random, StringInfo
         return false;
 }
 
+// Candidate verification worker pool. mem_write_callback copies each
+// candidate master secret into key_queue and goes back to the guest; a pool
+// of worker threads (-panda-arg keyfind:threads=<n>) runs check_key on
+// them. Identical candidate bytes are only checked once no matter which
+// tap wrote them: key_state remembers the verdict for each candidate's
+// bytes, and taps that produce a candidate still being checked wait in
+// key_waiters for the result. Only the last MAX_NOMATCH_VERDICTS negative
+// verdicts are kept, so a long replay doesn't grow key_state without bound;
+// a candidate whose verdict was dropped is just checked again.
+typedef std::array<uint8_t,MASTER_SECRET_SIZE> secret_bytes;
+
+// FNV-1a
+struct hash_secret_bytes {
+    size_t operator()(const secret_bytes &key) const {
+        uint64_t h = 0xcbf29ce484222325ULL;
+        for (int i = 0; i < MASTER_SECRET_SIZE; i++) {
+            h ^= key[i];
+            h *= 0x100000001b3ULL;
+        }
+        return h;
+    }
+};
+
+struct key_candidate {
+    secret_bytes key;
+    prog_point p;
+};
+
+enum { KEY_PENDING, KEY_NOMATCH, KEY_MATCH };
+
+#define MAX_QUEUED_CANDIDATES 65536
+#define MAX_NOMATCH_VERDICTS (1 << 18)
+
+std::mutex queue_lock;  // protects everything below, plus matches
+std::condition_variable queue_nonempty;
+std::condition_variable queue_nonfull;
+std::deque<key_candidate> key_queue;
+std::unordered_map<secret_bytes,int,hash_secret_bytes> key_state;
+std::unordered_multimap<secret_bytes,prog_point,hash_secret_bytes> key_waiters;
+std::deque<secret_bytes> nomatch_order;  // oldest negative verdict first
+bool workers_done = false;
+uint64_t num_candidates, num_duplicates, num_checked;
+
+std::vector<std::thread> workers;
+int needed_keydata;
+
+// Call with queue_lock held
+static void record_match(const prog_point &p, const uint8_t *key) {
+    if (!matches.insert(p).second) return;
+    fprintf(stderr, "MAC match found at " TARGET_FMT_lx " " TARGET_FMT_lx " " TARGET_FMT_lx "\n",
+        p.caller, p.pc, p.cr3);
+    fprintf(stderr, "Key: ");
+    for(int j = 0; j < MASTER_SECRET_SIZE; j++)
+        fprintf(stderr, "%02x", key[j]);
+    fprintf(stderr, "\n");
+}
+
+static void enqueue_candidates(std::vector<key_candidate> &batch) {
+    std::unique_lock<std::mutex> lk(queue_lock);
+    for (size_t i = 0; i < batch.size(); i++) {
+        key_candidate &c = batch[i];
+        num_candidates++;
+        std::unordered_map<secret_bytes,int,hash_secret_bytes>::iterator it =
+            key_state.find(c.key);
+        if (it != key_state.end()) {
+            num_duplicates++;
+            if (it->second == KEY_MATCH)
+                record_match(c.p, c.key.data());
+            else if (it->second == KEY_PENDING)
+                key_waiters.insert(std::make_pair(c.key, c.p));
+            continue;
+        }
+        key_state[c.key] = KEY_PENDING;
+        // Backpressure: stall the guest rather than queue without bound
+        queue_nonfull.wait(lk, []{ return key_queue.size() < MAX_QUEUED_CANDIDATES; });
+        key_queue.push_back(c);
+        queue_nonempty.notify_one();
+    }
+}
+
+static void key_worker(void) {
+    StringInfo master_secret, keydata, out;
+    ssl_data_alloc(&master_secret, MASTER_SECRET_SIZE);
+    ssl_data_alloc(&keydata, needed_keydata);
+    ssl_data_alloc(&out, g_enc_msg.data_len);
+
+    while (true) {
+        key_candidate c;
+        {
+            std::unique_lock<std::mutex> lk(queue_lock);
+            queue_nonempty.wait(lk, []{ return !key_queue.empty() || workers_done; });
+            if (key_queue.empty()) break;
+            c = key_queue.front();
+            key_queue.pop_front();
+        }
+        queue_nonfull.notify_one();
+
+        memcpy(master_secret.data, c.key.data(), MASTER_SECRET_SIZE);
+        bool match = check_key(&master_secret, &keydata, &out,
+                               &g_client_random, &g_server_random,
+                               &g_enc_msg, &g_version, &g_content_type, g_md, g_ciph);
+
+        std::lock_guard<std::mutex> lk(queue_lock);
+        num_checked++;
+        key_state[c.key] = match ? KEY_MATCH : KEY_NOMATCH;
+        if (match) {
+            record_match(c.p, c.key.data());
+        } else {
+            nomatch_order.push_back(c.key);
+            if (nomatch_order.size() > MAX_NOMATCH_VERDICTS) {
+                // Unless it is being checked again after an earlier drop
+                std::unordered_map<secret_bytes,int,hash_secret_bytes>::iterator old =
+                    key_state.find(nomatch_order.front());
+                if (old != key_state.end() && old->second == KEY_NOMATCH)
+                    key_state.erase(old);
+                nomatch_order.pop_front();
+            }
+        }
+        typedef std::unordered_multimap<secret_bytes,prog_point,hash_secret_bytes>::iterator waiter_it;
+        std::pair<waiter_it,waiter_it> waiting = key_waiters.equal_range(c.key);
+        if (match) {
+            for (waiter_it it = waiting.first; it != waiting.second; it++) {
+                record_match(it->second, c.key.data());
+            }
+        }
+        key_waiters.erase(waiting.first, waiting.second);
+    }
+
+    free(master_secret.data);
+    free(keydata.data);
+    free(out.data);
+}
+
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+// OpenSSL < 1.1 needs locking callbacks to be used from several threads
+std::mutex *ssl_locks;
+
+static void ssl_locking_cb(int mode, int n, const char *file, int line) {
+    if (mode & CRYPTO_LOCK) ssl_locks[n].lock();
+    else ssl_locks[n].unlock();
+}
+#endif
+
 int mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
                        target_ulong size, void *buf) {
     prog_point p = {};
@@ -238,6 +389,7 @@ int mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
     // XXX DEBUG: Just check the one we KNOW is correct
     //if(p.caller != 0x0000000074ce9788 || p.pc != 0x0000000074ce82ef || p.cr3 != 0x000000003f9650e0) return 1;
 
+    std::vector<key_candidate> batch;
     for (unsigned int i = 0; i < size; i++) {
         uint8_t val = ((uint8_t *)buf)[i];
         key_buf *k = &key_tracker[p];
@@ -250,27 +402,18 @@ int mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
         }
         if (likely(k->filled)) {
             // Copy it out of the ring buffer
+            key_candidate c;
             int key_bytes_left = sizeof(k->key) - k->start;
             int key_bytes_right = k->start;
-            memcpy(g_master_secret.data, k->key+k->start, key_bytes_left);
+            memcpy(c.key.data(), k->key+k->start, key_bytes_left);
             if(key_bytes_right) {
-                memcpy(g_master_secret.data+key_bytes_left, k->key, key_bytes_right);
-            }
-
-            bool match = check_key(&g_master_secret, &g_client_random, &g_server_random,
-                           &g_enc_msg, &g_version, &g_content_type, g_md, g_ciph);
-
-            if (unlikely(match)) {
-                fprintf(stderr, "MAC match found at " TARGET_FMT_lx " " TARGET_FMT_lx " " TARGET_FMT_lx "\n",
-                    p.caller, p.pc, p.cr3);
-                fprintf(stderr, "Key: ");
-                for(int j = 0; j < MASTER_SECRET_SIZE; j++)
-                    fprintf(stderr, "%02x", g_master_secret.data[j]);
-                fprintf(stderr, "\n");
-                matches.insert(p);
+                memcpy(c.key.data()+key_bytes_left, k->key, key_bytes_right);
             }
+            c.p = p;
+            batch.push_back(c);
         }
     }
+    if (!batch.empty()) enqueue_candidates(batch);
  
     return 1;
 }
@@ -477,19 +620,31 @@ bool init_plugin(void *self) {
     if (!found_cipher) { fprintf(stderr, "Cipher not found in config file, aborting.\n"); return false; }
     if (!found_mac) { fprintf(stderr, "MAC not found in config file, aborting.\n"); return false; }
 
-    // Global data. Init it once here so we don't have to
-    // re-alloc each time.
-    ssl_data_alloc(&g_master_secret, MASTER_SECRET_SIZE);
-    int needed = 0;
-    needed = EVP_MD_size(g_md)*2 + \
-             EVP_CIPHER_key_length(g_ciph)*2 + \
-             EVP_CIPHER_iv_length(g_ciph)*2;
-    ssl_data_alloc(&g_keydata, needed);
-    ssl_data_alloc(&g_out, g_enc_msg.data_len);
+    // Size of the key block each worker needs scratch space for
+    needed_keydata = EVP_MD_size(g_md)*2 + \
+                     EVP_CIPHER_key_length(g_ciph)*2 + \
+                     EVP_CIPHER_iv_length(g_ciph)*2;
+
+    // Start the verification workers
+    int nthreads = std::thread::hardware_concurrency() - 1;
+    for (int i = 0; i < panda_argc; i++) {
+        if (0 == strncmp(panda_argv[i], "keyfind:threads=", 16)) {
+            nthreads = atoi(panda_argv[i] + 16);
+        }
+    }
+    if (nthreads < 1) nthreads = 1;
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+    ssl_locks = new std::mutex[CRYPTO_num_locks()];
+    CRYPTO_set_locking_callback(ssl_locking_cb);
+#endif
+    printf("keyfind: Checking candidates with %d worker threads.\n", nthreads);
+    for (int i = 0; i < nthreads; i++) {
+        workers.push_back(std::thread(key_worker));
+    }
  
     return true;
     /*
-    bool match = check_key(&g_master_secret, &g_client_random, &g_server_random,
+    bool match = check_key(&g_master_secret, &g_keydata, &g_out, &g_client_random, &g_server_random,
                            &g_enc_msg, &g_version, &g_content_type, g_md, g_ciph);
     if (match)
         fprintf(stderr, "MAC matches\n");
@@ -501,7 +656,22 @@ bool init_plugin(void *self) {
 }
 
 void uninit_plugin(void *self) {
+    // Let the workers drain the queue
+    {
+        std::lock_guard<std::mutex> lk(queue_lock);
+        workers_done = true;
+    }
+    queue_nonempty.notify_all();
+    for (size_t i = 0; i < workers.size(); i++) workers[i].join();
+    workers.clear();
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+    CRYPTO_set_locking_callback(NULL);
+    delete[] ssl_locks;
+#endif
+
     printf("%d / %d blocks instrumented.\n", instrumented, total);
+    printf("keyfind: %lu candidates, %lu duplicates skipped, %lu checked.\n",
+        num_candidates, num_duplicates, num_checked);
     FILE *mem_report = fopen("key_matches.txt", "w");
     if(!mem_report) {
         printf("Couldn't write report:\n");
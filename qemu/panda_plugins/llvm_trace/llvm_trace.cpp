@@ -100,6 +100,9 @@ llvm::PandaInstrFunctionPass *PIFP;
  */
 int phys_mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
                        target_ulong size, void *buf) {
+    if (!panda_block_in_llvm){
+        return 0; // not instrumented, see before_block_exec
+    }
     DynValBuffer *dynval_buffer = PIFP->PIV->getDynvalBuffer();
     log_dynval(dynval_buffer, ADDRENTRY, STORE, addr);
     return 0;
@@ -107,6 +110,9 @@ int phys_mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
 
 int phys_mem_read_callback(CPUState *env, target_ulong pc, target_ulong addr,
         target_ulong size, void *buf){
+    if (!panda_block_in_llvm){
+        return 0; // not instrumented, see before_block_exec
+    }
     DynValBuffer *dynval_buffer = PIFP->PIV->getDynvalBuffer();
     log_dynval(dynval_buffer, ADDRENTRY, LOAD, addr);
     return 0;
@@ -148,6 +154,11 @@ static void llvm_init(){
 
 
 int before_block_exec(CPUState *env, TranslationBlock *tb){
+  // Blocks a plugin chose to run under TCG aren't instrumented, so there
+  // is nothing to log for them
+  if (!panda_block_in_llvm){
+    return 0;
+  }
 
   if (tubtf_on) {
     char *llvm_fn_name = (char *) tcg_llvm_get_func_name(tb);
@@ -170,6 +181,9 @@ int before_block_exec(CPUState *env, TranslationBlock *tb){
 
 int after_block_exec(CPUState *env, TranslationBlock *tb,
         TranslationBlock *next_tb){
+  if (!panda_block_in_llvm){
+    return 0;
+  }
   if (tubtf_on == 0) {
     // flush dynlog to file
     assert(memlog);
@@ -181,6 +195,9 @@ int after_block_exec(CPUState *env, TranslationBlock *tb,
 }
 
 int cb_cpu_restore_state(CPUState *env, TranslationBlock *tb){
+    if (!panda_block_in_llvm){
+        return 0;
+    }
     printf("EXCEPTION - logging\n");
     DynValBuffer *dynval_buffer = PIFP->PIV->getDynvalBuffer();
     log_exception(dynval_buffer);
@@ -339,11 +356,19 @@ bool init_plugin(void *self) {
     panda_register_callback(self, PANDA_CB_USER_AFTER_SYSCALL, pcb);
 #endif
 
+    // The dynamic value log has to line up with the unoptimized IR
+    if (llvm_opt_threshold){
+        printf("llvm_trace: turning off LLVM tiered optimization\n");
+        llvm_opt_threshold = 0;
+    }
+    // Every block chosen for LLVM has to run under it
+    tcg_llvm_set_async(0);
     if (!execute_llvm){
         panda_enable_llvm();
     }
-    llvm::llvm_init();
+    // Helpers are morphed (and inlined) before the instrumentation pass runs
     panda_enable_llvm_helpers();
+    llvm::llvm_init();
 
     /*
      * Run instrumentation pass over all helper functions that are now in the
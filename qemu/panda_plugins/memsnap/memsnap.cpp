@@ -32,6 +32,7 @@ extern "C" {
 #include <stdlib.h>
 #include <ctype.h>
 #include <math.h>
+#include <string.h>
 #include <set>
 #include <iostream>
 #include <fstream>
@@ -55,6 +56,22 @@ std::set<prog_point> tap_points;
 
 bool done = false;
 
+// Incremental mode: the first tap hit writes a full base image, later hits
+// append only the pages dirtied since the previous snapshot to
+// memsnap.delta. memsnap_index.txt records, per snapshot, the tap point,
+// offset into memsnap.delta and number of (uint64_t addr, page) records,
+// so scripts/memsnap_restore.py can rebuild any snapshot.
+bool incremental = false;
+int nsnaps = 0;
+FILE *delta_file = NULL;
+FILE *index_file = NULL;
+
+// memsnap:sparse=1 writes full images in the panda_memsavep_sparse format
+// (see scripts/memsavep_expand.py), compressed on memsnap:threads=N worker
+// threads if N > 0.
+bool sparse = false;
+int compress_threads = 0;
+
 int mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
                        target_ulong size, void *buf) {
     if(done) return 1;
@@ -68,9 +85,33 @@ int mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
         char path[256];
         sprintf(path, TARGET_FMT_lx "." TARGET_FMT_lx "." TARGET_FMT_lx ".mem",
             p.caller, p.pc, p.cr3);
-        FILE *f = fopen(path, "wb");
-        panda_memsavep(f);
-        fclose(f);
+        if (incremental && nsnaps > 0) {
+            long off = ftell(delta_file);
+            int npages = panda_memsavep_dirty(delta_file);
+            fprintf(index_file, "%d " TARGET_FMT_lx " " TARGET_FMT_lx " " TARGET_FMT_lx " %ld %d\n",
+                nsnaps, p.caller, p.pc, p.cr3, off, npages);
+        }
+        else {
+            FILE *f = fopen(path, "wb");
+            if (sparse) {
+                if (panda_memsavep_sparse(f, compress_threads) < 0)
+                    printf("memsnap: failed to write %s\n", path);
+            }
+            else {
+                panda_memsavep(f);
+            }
+            fclose(f);
+            if (incremental) {
+                panda_memsavep_dirty_reset();
+                fprintf(index_file, "%d " TARGET_FMT_lx " " TARGET_FMT_lx " " TARGET_FMT_lx " %s %d\n",
+                    nsnaps, p.caller, p.pc, p.cr3, path, TARGET_PAGE_SIZE);
+            }
+        }
+        nsnaps++;
+        if (incremental) {
+            fflush(delta_file);
+            fflush(index_file);
+        }
     }
     
     if (tap_points.empty()) done = true;
@@ -82,6 +123,26 @@ bool init_plugin(void *self) {
     panda_cb pcb;
 
     printf("Initializing plugin memsnap\n");
+
+    for (int i = 0; i < panda_argc; i++) {
+        if (0 == strncmp(panda_argv[i], "memsnap:incremental=", 20)) {
+            incremental = (0 == strcmp(panda_argv[i] + 20, "1"));
+        }
+        else if (0 == strncmp(panda_argv[i], "memsnap:sparse=", 15)) {
+            sparse = (0 == strcmp(panda_argv[i] + 15, "1"));
+        }
+        else if (0 == strncmp(panda_argv[i], "memsnap:threads=", 16)) {
+            compress_threads = atoi(panda_argv[i] + 16);
+        }
+    }
+    if (incremental) {
+        delta_file = fopen("memsnap.delta", "wb");
+        index_file = fopen("memsnap_index.txt", "w");
+        if (!delta_file || !index_file) {
+            printf("Couldn't open memsnap.delta / memsnap_index.txt. Exiting.\n");
+            return false;
+        }
+    }
     
     std::ifstream taps("tap_points.txt");
     if (!taps) {
@@ -123,5 +184,6 @@ bool init_plugin(void *self) {
 }
 
 void uninit_plugin(void *self) {
-
+    if (delta_file) fclose(delta_file);
+    if (index_file) fclose(index_file);
 }
@@ -14,17 +14,42 @@
 #PANDAENDCOMMENT */
 
 """
-Output panda tool to parse system calls on Linux
+Output a table of Linux system call prototypes used by the syscalls plugin:
+for each call, its number, name, argument types, the registers each
+argument is passed in, and the argument names.
+
+Argument types are 's' (string), 'p' (pointer), '4' (32 bit) and '8' (64 bit).
+On 32 bit guests a 64 bit argument takes a pair of registers; argregs holds
+the one with the low half and argregs_hi the one with the high half.
+
+usage: python android_syscall_parser.py <prototypes.txt> <arch> > syscall_table_<arch>.h
+   eg: python android_syscall_parser.py android_arm_prototypes.txt arm > syscall_table_arm.h
+       python android_syscall_parser.py linux_x86_prototypes.txt x86 > syscall_table_x86.h
+       python android_syscall_parser.py linux_x86_64_prototypes.txt x86_64 > syscall_table_x86_64.h
 """
 
 import re
+import sys
+
+# Argument registers, as indices into env->regs, and how 64 bit arguments
+# are passed:
+#   'aligned': in an even/odd register pair, low half first (ARM EABI)
+#   'pair':    in the next two registers, low half first (i386)
+#   'single':  in one register (x86_64)
+ARCHES = {
+    # r0-r6; the call number is in r7
+    'arm':    {'args': [0, 1, 2, 3, 4, 5, 6], 'arg64': 'aligned'},
+    # EBX, ECX, EDX, ESI, EDI, EBP; the call number is in EAX
+    'x86':    {'args': [3, 1, 2, 6, 7, 5], 'arg64': 'pair'},
+    # RDI, RSI, RDX, R10, R8, R9; the call number is in RAX
+    'x86_64': {'args': [7, 6, 2, 10, 8, 9], 'arg64': 'single'},
+}
 
-ARM_CALLNO = "env->regs[7]"
-ARM_ARGS = ["env->regs[0]", "env->regs[1]", "env->regs[2]", "env->regs[3]", "env->regs[4]", "env->regs[5]", "env->regs[6]"]
-ARM_SP = "env->regs[13]"
+NO_REG = "0xff"
 
-X86_CALLNO = "EAX"
-X86_ARGS = ["EBX", "ECX", "EDX", "ESI", "EDI", "EBP"]
+protofile, arch = sys.argv[1], sys.argv[2]
+ARGS = ARCHES[arch]['args']
+ARG64 = ARCHES[arch]['arg64']
 
 
 types_64 = ["loff_t", 'u64']
@@ -33,26 +58,25 @@ types_32 = ["int", "long", "size_t", 'u32', 'off_t', 'timer_t', '__s32', 'key_t'
 types_16 = ['old_uid_t', 'uid_t', 'mode_t', 'gid_t', 'pid_t']
 types_pointer = ['cap_user_data_t', 'cap_user_header_t', '...']
 
-print "switch(", ARM_CALLNO, "){\n"
+# Calls that the plugin needs to see return, for the VMI callbacks
+callbacks = {
+    'fork': 'SYSCALL_CB_FORK',
+    'execve': 'SYSCALL_CB_EXEC',
+    'clone': 'SYSCALL_CB_CLONE',
+    'do_mmap2': 'SYSCALL_CB_MMAP',
+    'sys_prctl': 'SYSCALL_CB_PRCTL',
+}
 
+def c_string(s):
+    return '"%s"' % s.replace('\\', '\\\\').replace('"', '\\"')
 
-def copy_string(source, fname):
-    print "log_string(%s, \"%s\");" % (source,fname)
+print "// Generated by android_syscall_parser.py from %s" % protofile
+print "static const syscall_prototype syscall_prototypes_%s[] = {" % arch
 
-def record_address(source, fname):
-    print "log_pointer(%s, \"%s\");" %(source, fname)
-    
-def record_32(source, fname):
-    print "log_32(%s, \"%s\");" %(source, fname)
-
-def record_64(highsource, lowsource, fname):
-    print "log_64(%s, %s, \"%s\");" %(highsource, lowsource, fname)
-    
-# Goldfish kernel doesn't support OABI layer. Yay!
-with open("android_arm_syscall_prototypes") as armcalls:
-    linere = re.compile("(\d+) (.+) (\w+)\((.*)\);")
-    charre = re.compile("char.*\*")
-    for line in armcalls:
+with open(protofile) as calls:
+    linere = re.compile("(\\d+) (.+) (\\w+)\\((.*)\\);")
+    charre = re.compile("char.*\\*")
+    for line in calls:
         # Fields: <no> <return-type> <name><signature with spaces>
         fields = linere.match(line)
         callno = fields.group(1)
@@ -80,44 +104,34 @@ with open("android_arm_syscall_prototypes") as armcalls:
             elif arg.strip() == 'unsigned' or (len(arg.split()) is 2 and arg.split()[0] == 'unsigned'):
                 format += '4'
             else:
-                print "unknown:", arg
-        print "case", callno, ":"
-        print "record_syscall(\"%s\");" % callname
+                print "// unknown:", arg
+        types = ""
+        regs = []
+        regs_hi = []
+        names = []
         argno = 0
         for i, val in enumerate(format):
-            if argno >= len(ARM_ARGS):
+            if argno >= len(ARGS):
                 print "// out of registers. Use the stack!"
                 break
-            if val == 's':
-                copy_string(ARM_ARGS[argno], args[i])
-            elif val == 'p':
-                record_address(ARM_ARGS[argno], args[i])
-            elif val == '4':
-                record_32(ARM_ARGS[argno], args[i])
-            elif val == '8':
+            if val == '8' and ARG64 != 'single':
                 # alignment sadness. Linux tried to make sure none of these happen
-                if (argno % 2) == 1:
+                if ARG64 == 'aligned' and (argno % 2) == 1:
                     print "// skipping arg for alignment"
                     argno+= 1
-                    if argno >= len(ARM_ARGS):
-                        print "// out of registers. Use the stack!"
-                        break
-                record_64(ARM_ARGS[argno], ARM_ARGS[argno+1],args[i])
+                if argno+1 >= len(ARGS):
+                    print "// out of registers. Use the stack!"
+                    break
+                regs.append(str(ARGS[argno]))
+                regs_hi.append(str(ARGS[argno+1]))
                 argno+=1
+            else:
+                regs.append(str(ARGS[argno]))
+                regs_hi.append(NO_REG)
+            types += val
+            names.append(c_string(args[i]))
             argno+=1
-        if callname == 'fork':
-            print "call_fork_callback(env, pc);"
-        elif callname == 'execve':
-            print "call_exec_callback(env, pc);"
-        elif callname == 'clone':
-            print "call_clone_callback(env, pc);"
-        elif callname == 'do_mmap2':
-            print "call_mmap_callback(env, pc);"
-        elif callname == 'sys_prctl':
-            print "call_prctl_callback(env, pc);"
-        print "finish_syscall();"
-        print "break;"
-    print "default:"
-    print "record_syscall(\"UNKNOWN\");"
-    print "}"
-        
+        print "{ %s, %s, %s, {%s}, {%s}, {%s}, %s }," % (callno, c_string(callname),
+            c_string(types), ", ".join(regs), ", ".join(regs_hi), ", ".join(names),
+            callbacks.get(callname, "0"))
+    print "};"
@@ -0,0 +1,232 @@
+# /* PANDABEGINCOMMENT
+# *
+# * Authors:
+# *  Tim Leek               tleek@ll.mit.edu
+# *  Ryan Whelan            rwhelan@ll.mit.edu
+# *  Joshua Hodosh          josh.hodosh@ll.mit.edu
+# *  Michael Zhivich        mzhivich@ll.mit.edu
+# *  Brendan Dolan-Gavitt   brendandg@gatech.edu
+# *
+# * This work is licensed under the terms of the GNU GPL, version 2.
+# * See the COPYING file in the top-level directory.
+# *
+#PANDAENDCOMMENT */
+
+"""
+Build the i386 or x86_64 Linux syscall prototype list (the input to
+android_syscall_parser.py) from the kernel's syscall numbers and signatures.
+
+Numbers come from an asm/unistd_32.h or asm/unistd_64.h header. Signatures
+come from one or more sources, searched in order: the kernel's
+include/linux/syscalls.h ("asmlinkage" declarations) or an existing
+prototype list such as android_arm_prototypes.txt. x86 specific calls, and
+calls whose entry point doesn't match their name, are handled below.
+Calls with no known signature are output with an empty argument list.
+
+usage: python createX86Prototypes.py <32|64> <asm/unistd_NN.h> <signatures>... > linux_x86[_64]_prototypes.txt
+   eg: python createX86Prototypes.py 32 /usr/include/x86_64-linux-gnu/asm/unistd_32.h \\
+           linux/include/linux/syscalls.h > linux_x86_prototypes.txt
+"""
+
+import re
+import sys
+
+bits = sys.argv[1]
+numsource = sys.argv[2]
+sigsources = sys.argv[3:]
+
+# Not implemented on x86 (sys_ni_syscall in the kernel's syscall tables)
+unimplemented = set(['break', 'stty', 'gtty', 'ftime', 'prof', 'lock', 'mpx',
+    'ulimit', 'profil', 'idle', 'afs_syscall', 'getpmsg', 'putpmsg', 'vserver',
+    'create_module', 'get_kernel_syms', 'query_module', 'nfsservctl',
+    'tuxcall', 'security', 'epoll_ctl_old', 'epoll_wait_old'])
+
+# Entry points that aren't sys_<name>
+entry_points = {
+    '_llseek': 'sys_llseek',
+    '_newselect': 'sys_select',
+    '_sysctl': 'sys_sysctl',
+    'umount2': 'sys_umount',
+    'ugetrlimit': 'sys_getrlimit',
+    'stat': 'sys_newstat',
+    'lstat': 'sys_newlstat',
+    'fstat': 'sys_newfstat',
+    'uname': 'sys_newuname',
+    'fstatat64': 'sys_fstatat64',
+    'sync_file_range': 'sys_sync_file_range',
+}
+
+signatures = {}
+
+# x86 specific, or not in older syscalls.h
+signatures['sys_waitpid'] = 'long sys_waitpid(pid_t pid, int __user *stat_addr, int options);'
+signatures['sys_time'] = 'long sys_time(time_t __user *tloc);'
+signatures['sys_stime'] = 'long sys_stime(time_t __user *tptr);'
+signatures['sys_alarm'] = 'long sys_alarm(unsigned int seconds);'
+signatures['sys_utime'] = 'long sys_utime(char __user *filename, struct utimbuf __user *times);'
+signatures['sys_signal'] = 'unsigned long sys_signal(int sig, void __user *handler);'
+signatures['sys_oldumount'] = 'long sys_oldumount(char __user *name);'
+signatures['sys_sgetmask'] = 'long sys_sgetmask(void);'
+signatures['sys_ssetmask'] = 'long sys_ssetmask(int newmask);'
+signatures['old_readdir'] = 'long old_readdir(unsigned int fd, struct old_linux_dirent __user *dirent, unsigned int count);'
+signatures['sys_ioperm'] = 'long sys_ioperm(unsigned long from, unsigned long num, int on);'
+signatures['sys_iopl'] = 'long sys_iopl(unsigned int level);'
+signatures['sys_socketcall'] = 'long sys_socketcall(int call, unsigned long __user *args);'
+signatures['sys_ipc'] = 'long sys_ipc(unsigned int call, int first, unsigned long second, unsigned long third, void __user *ptr, long fifth);'
+signatures['sys_stat'] = 'long sys_stat(char __user *filename, struct __old_kernel_stat __user *statbuf);'
+signatures['sys_lstat'] = 'long sys_lstat(char __user *filename, struct __old_kernel_stat __user *statbuf);'
+signatures['sys_fstat'] = 'long sys_fstat(unsigned int fd, struct __old_kernel_stat __user *statbuf);'
+signatures['sys_olduname'] = 'long sys_olduname(struct oldold_utsname __user *name);'
+signatures['sys_uname'] = 'long sys_uname(struct old_utsname __user *name);'
+signatures['sys_vm86old'] = 'int sys_vm86old(struct vm86_struct __user *user_vm86);'
+signatures['sys_vm86'] = 'int sys_vm86(unsigned long cmd, unsigned long arg);'
+signatures['sys_modify_ldt'] = 'int sys_modify_ldt(int func, void __user *ptr, unsigned long bytecount);'
+signatures['sys_mremap'] = 'unsigned long sys_mremap(unsigned long addr, unsigned long old_len, unsigned long new_len, unsigned long flags, unsigned long new_addr);'
+signatures['sys_sigreturn'] = 'long sys_sigreturn(void);'
+signatures['sys_rt_sigreturn'] = 'long sys_rt_sigreturn(void);'
+signatures['sys_sigaltstack'] = 'long sys_sigaltstack(const stack_t __user *uss, stack_t __user *uoss);'
+signatures['sys_mmap_pgoff'] = 'long sys_mmap_pgoff(unsigned long addr, unsigned long len, unsigned long prot, unsigned long flags, unsigned long fd, unsigned long pgoff);'
+signatures['sys_set_thread_area'] = 'int sys_set_thread_area(struct user_desc __user *u_info);'
+signatures['sys_get_thread_area'] = 'int sys_get_thread_area(struct user_desc __user *u_info);'
+signatures['sys_fadvise64'] = 'long sys_fadvise64(int fd, loff_t offset, size_t len, int advice);'
+signatures['sys_fadvise64_64'] = 'long sys_fadvise64_64(int fd, loff_t offset, loff_t len, int advice);'
+signatures['sys_arch_prctl'] = 'long sys_arch_prctl(int code, unsigned long addr);'
+signatures['sys_fork'] = 'long sys_fork(void);'
+signatures['sys_vfork'] = 'long sys_vfork(void);'
+signatures['sys_execve'] = 'long sys_execve(const char __user *filename, char *const argv[], char *const envp[]);'
+signatures['sys_migrate_pages'] = 'long sys_migrate_pages(pid_t pid, unsigned long maxnode, const unsigned long __user *from, const unsigned long __user *to);'
+signatures['sys_pselect6'] = 'long sys_pselect6(int n, fd_set __user *inp, fd_set __user *outp, fd_set __user *exp, struct timespec __user *tsp, void __user *sig);'
+signatures['sys_ppoll'] = 'long sys_ppoll(struct pollfd __user *ufds, unsigned int nfds, struct timespec __user *tsp, const sigset_t __user *sigmask, size_t sigsetsize);'
+signatures['sys_sync_file_range'] = 'long sys_sync_file_range(int fd, loff_t offset, loff_t nbytes, unsigned int flags);'
+signatures['sys_epoll_pwait'] = 'long sys_epoll_pwait(int epfd, struct epoll_event __user *events, int maxevents, int timeout, const sigset_t __user *sigmask, size_t sigsetsize);'
+signatures['sys_accept4'] = 'long sys_accept4(int fd, struct sockaddr __user *upeer_sockaddr, int __user *upeer_addrlen, int flags);'
+signatures['sys_preadv'] = 'long sys_preadv(unsigned long fd, const struct iovec __user *vec, unsigned long vlen, unsigned long pos_l, unsigned long pos_h);'
+signatures['sys_pwritev'] = 'long sys_pwritev(unsigned long fd, const struct iovec __user *vec, unsigned long vlen, unsigned long pos_l, unsigned long pos_h);'
+signatures['sys_rt_tgsigqueueinfo'] = 'long sys_rt_tgsigqueueinfo(pid_t tgid, pid_t pid, int sig, siginfo_t __user *uinfo);'
+signatures['sys_perf_event_open'] = 'long sys_perf_event_open(struct perf_event_attr __user *attr_uptr, pid_t pid, int cpu, int group_fd, unsigned long flags);'
+signatures['sys_recvmmsg'] = 'long sys_recvmmsg(int fd, struct mmsghdr __user *msg, unsigned int vlen, unsigned flags, struct timespec __user *timeout);'
+signatures['sys_fanotify_init'] = 'long sys_fanotify_init(unsigned int flags, unsigned int event_f_flags);'
+signatures['sys_fanotify_mark'] = 'long sys_fanotify_mark(int fanotify_fd, unsigned int flags, u64 mask, int fd, const char __user *pathname);'
+signatures['sys_prlimit64'] = 'long sys_prlimit64(pid_t pid, unsigned int resource, const struct rlimit64 __user *new_rlim, struct rlimit64 __user *old_rlim);'
+signatures['sys_name_to_handle_at'] = 'long sys_name_to_handle_at(int dfd, const char __user *name, struct file_handle __user *handle, int __user *mnt_id, int flag);'
+signatures['sys_open_by_handle_at'] = 'long sys_open_by_handle_at(int mountdirfd, struct file_handle __user *handle, int flags);'
+signatures['sys_clock_adjtime'] = 'long sys_clock_adjtime(clockid_t which_clock, struct timex __user *tx);'
+signatures['sys_syncfs'] = 'long sys_syncfs(int fd);'
+signatures['sys_sendmmsg'] = 'long sys_sendmmsg(int fd, struct mmsghdr __user *msg, unsigned int vlen, unsigned flags);'
+signatures['sys_setns'] = 'long sys_setns(int fd, int nstype);'
+signatures['sys_process_vm_readv'] = 'long sys_process_vm_readv(pid_t pid, const struct iovec __user *lvec, unsigned long liovcnt, const struct iovec __user *rvec, unsigned long riovcnt, unsigned long flags);'
+signatures['sys_process_vm_writev'] = 'long sys_process_vm_writev(pid_t pid, const struct iovec __user *lvec, unsigned long liovcnt, const struct iovec __user *rvec, unsigned long riovcnt, unsigned long flags);'
+signatures['sys_kcmp'] = 'long sys_kcmp(pid_t pid1, pid_t pid2, int type, unsigned long idx1, unsigned long idx2);'
+signatures['sys_finit_module'] = 'long sys_finit_module(int fd, const char __user *uargs, int flags);'
+signatures['sys_sched_setattr'] = 'long sys_sched_setattr(pid_t pid, struct sched_attr __user *attr, unsigned int flags);'
+signatures['sys_sched_getattr'] = 'long sys_sched_getattr(pid_t pid, struct sched_attr __user *attr, unsigned int size, unsigned int flags);'
+signatures['sys_renameat2'] = 'long sys_renameat2(int olddfd, const char __user *oldname, int newdfd, const char __user *newname, unsigned int flags);'
+signatures['sys_seccomp'] = 'long sys_seccomp(unsigned int op, unsigned int flags, void __user *uargs);'
+signatures['sys_getrandom'] = 'long sys_getrandom(char __user *buf, size_t count, unsigned int flags);'
+signatures['sys_memfd_create'] = 'long sys_memfd_create(const char __user *uname_ptr, unsigned int flags);'
+signatures['sys_kexec_file_load'] = 'long sys_kexec_file_load(int kernel_fd, int initrd_fd, unsigned long cmdline_len, const char __user *cmdline_ptr, unsigned long flags);'
+signatures['sys_bpf'] = 'long sys_bpf(int cmd, union bpf_attr __user *attr, unsigned int size);'
+signatures['sys_execveat'] = 'long sys_execveat(int dfd, const char __user *filename, char *const argv[], char *const envp[], int flags);'
+signatures['sys_userfaultfd'] = 'long sys_userfaultfd(int flags);'
+signatures['sys_membarrier'] = 'long sys_membarrier(int cmd, int flags);'
+signatures['sys_mlock2'] = 'long sys_mlock2(unsigned long start, size_t len, int flags);'
+signatures['sys_copy_file_range'] = 'long sys_copy_file_range(int fd_in, loff_t __user *off_in, int fd_out, loff_t __user *off_out, size_t len, unsigned int flags);'
+signatures['sys_preadv2'] = 'long sys_preadv2(unsigned long fd, const struct iovec __user *vec, unsigned long vlen, unsigned long pos_l, unsigned long pos_h, int flags);'
+signatures['sys_pwritev2'] = 'long sys_pwritev2(unsigned long fd, const struct iovec __user *vec, unsigned long vlen, unsigned long pos_l, unsigned long pos_h, int flags);'
+signatures['sys_pkey_mprotect'] = 'long sys_pkey_mprotect(unsigned long start, size_t len, unsigned long prot, int pkey);'
+signatures['sys_pkey_alloc'] = 'long sys_pkey_alloc(unsigned long flags, unsigned long init_val);'
+signatures['sys_pkey_free'] = 'long sys_pkey_free(int pkey);'
+signatures['sys_statx'] = 'long sys_statx(int dfd, const char __user *path, unsigned flags, unsigned mask, struct statx __user *buffer);'
+signatures['sys_rseq'] = 'long sys_rseq(struct rseq __user *rseq, u32 rseq_len, int flags, u32 sig);'
+signatures['sys_pidfd_send_signal'] = 'long sys_pidfd_send_signal(int pidfd, int sig, siginfo_t __user *info, unsigned int flags);'
+signatures['sys_pidfd_open'] = 'long sys_pidfd_open(pid_t pid, unsigned int flags);'
+signatures['sys_clone3'] = 'long sys_clone3(struct clone_args __user *uargs, size_t size);'
+signatures['sys_close_range'] = 'long sys_close_range(unsigned int fd, unsigned int max_fd, unsigned int flags);'
+signatures['sys_openat2'] = 'long sys_openat2(int dfd, const char __user *filename, struct open_how __user *how, size_t size);'
+signatures['sys_faccessat2'] = 'long sys_faccessat2(int dfd, const char __user *filename, int mode, int flags);'
+signatures['sys_newfstatat'] = 'long sys_newfstatat(int dfd, const char __user *filename, struct stat __user *statbuf, int flag);'
+
+if bits == '32':
+    # The old calls keep the original numbers, with 16 bit uids; the *32
+    # calls are the ones with full size uids.
+    entry_points.update({
+        'oldstat': 'sys_stat',
+        'oldlstat': 'sys_lstat',
+        'oldfstat': 'sys_fstat',
+        'oldolduname': 'sys_olduname',
+        'olduname': 'sys_uname',
+        'umount': 'sys_oldumount',
+        'readdir': 'old_readdir',
+        'mmap': 'old_mmap',
+        'select': 'old_select',
+        'mmap2': 'sys_mmap_pgoff',
+    })
+    signatures['old_mmap'] = 'long old_mmap(struct mmap_arg_struct __user *arg);'
+    signatures['old_select'] = 'long old_select(struct sel_arg_struct __user *arg);'
+    signatures['sys_clone'] = 'long sys_clone(unsigned long clone_flags, unsigned long newsp, int __user *parent_tidptr, unsigned long tls, int __user *child_tidptr);'
+else:
+    signatures['sys_mmap'] = 'long sys_mmap(unsigned long addr, unsigned long len, unsigned long prot, unsigned long flags, unsigned long fd, unsigned long off);'
+    signatures['sys_clone'] = 'long sys_clone(unsigned long clone_flags, unsigned long newsp, int __user *parent_tidptr, int __user *child_tidptr, unsigned long tls);'
+
+namere = re.compile("\W(\w+)\(")
+protore = re.compile("\d+ (.+) (\w+)\((.*)\);")
+found = {}
+for source in sigsources:
+    with open(source) as sigfile:
+        inone = False
+        signature = None
+        for line in sigfile:
+            line = line.strip()
+            proto = protore.match(line)
+            if proto:
+                # existing prototype list
+                signature = line.split(" ", 1)[1]
+                callname = proto.group(2)
+            elif line.startswith('asmlinkage') and line.endswith(';'):
+                # one liner
+                signature = line.split(" ", 1)[1]
+                callname = namere.search(signature).group(1)
+            elif line.startswith('asmlinkage'):
+                signature = line.split(" ", 1)[1]
+                inone = True
+                continue
+            elif inone:
+                signature += line
+                if not line.endswith(';'):
+                    continue
+                callname = namere.search(signature).group(1)
+                inone = False
+            else:
+                continue
+            if callname not in found:
+                found[callname] = signature.replace('\n', ' ')
+# The hand written ones win over whatever the sources had
+found.update(signatures)
+
+numbers = []
+with open(numsource) as nums:
+    nrre = re.compile("#define __NR_(\w+)\s+(\d+)")
+    for line in nums:
+        nr = nrre.match(line)
+        if nr:
+            numbers.append((int(nr.group(2)), nr.group(1)))
+
+names = set(name for callno, name in numbers)
+for callno, name in sorted(numbers):
+    if name in unimplemented:
+        continue
+    candidates = []
+    if name in entry_points:
+        candidates.append(entry_points[name])
+    if bits == '32' and name + '32' in names:
+        # lchown, getuid, ... take 16 bit uids
+        candidates.append('sys_' + name + '16')
+    if bits == '32' and name.endswith('32'):
+        candidates.append('sys_' + name[:-2])
+    candidates += ['sys_' + name, name]
+    for c in candidates:
+        if c in found:
+            print callno, found[c]
+            break
+    else:
+        print "%d long sys_%s();" % (callno, name)
@@ -0,0 +1,860 @@
+/* PANDABEGINCOMMENT
+ * 
+ * Authors:
+ *  Tim Leek               tleek@ll.mit.edu
+ *  Ryan Whelan            rwhelan@ll.mit.edu
+ *  Joshua Hodosh          josh.hodosh@ll.mit.edu
+ *  Michael Zhivich        mzhivich@ll.mit.edu
+ *  Brendan Dolan-Gavitt   brendandg@gatech.edu
+ * 
+ * This work is licensed under the terms of the GNU GPL, version 2. 
+ * See the COPYING file in the top-level directory. 
+ * 
+PANDAENDCOMMENT */
+// Generated by android_syscall_parser.py from linux_x86_prototypes.txt
+static const syscall_prototype syscall_prototypes_x86[] = {
+// 0 long sys_restart_syscall ['void']
+{ 0, "sys_restart_syscall", "", {}, {}, {}, 0 },
+// 1 long sys_exit ['int error_code']
+{ 1, "sys_exit", "4", {3}, {0xff}, {"int error_code"}, 0 },
+// 2 long sys_fork ['void']
+{ 2, "sys_fork", "", {}, {}, {}, 0 },
+// 3 long sys_read ['unsigned int fd', ' char __user *buf', ' size_t count']
+{ 3, "sys_read", "4p4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"unsigned int fd", " char __user *buf", " size_t count"}, 0 },
+// 4 long sys_write ['unsigned int fd', ' const char __user *buf', 'size_t count']
+{ 4, "sys_write", "4p4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"unsigned int fd", " const char __user *buf", "size_t count"}, 0 },
+// 5 long sys_open ['const char __user *filename', 'int flags', ' int mode']
+{ 5, "sys_open", "s44", {3, 1, 2}, {0xff, 0xff, 0xff}, {"const char __user *filename", "int flags", " int mode"}, 0 },
+// 6 long sys_close ['unsigned int fd']
+{ 6, "sys_close", "4", {3}, {0xff}, {"unsigned int fd"}, 0 },
+// 7 long sys_waitpid ['pid_t pid', ' int __user *stat_addr', ' int options']
+{ 7, "sys_waitpid", "4p4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"pid_t pid", " int __user *stat_addr", " int options"}, 0 },
+// 8 long sys_creat ['const char __user *pathname', ' int mode']
+{ 8, "sys_creat", "s4", {3, 1}, {0xff, 0xff}, {"const char __user *pathname", " int mode"}, 0 },
+// 9 long sys_link ['const char __user *oldname', 'const char __user *newname']
+{ 9, "sys_link", "ss", {3, 1}, {0xff, 0xff}, {"const char __user *oldname", "const char __user *newname"}, 0 },
+// 10 long sys_unlink ['const char __user *pathname']
+{ 10, "sys_unlink", "s", {3}, {0xff}, {"const char __user *pathname"}, 0 },
+// 11 long sys_execve ['const char __user *filename', ' char *const argv[]', ' char *const envp[]']
+{ 11, "sys_execve", "spp", {3, 1, 2}, {0xff, 0xff, 0xff}, {"const char __user *filename", " char *const argv[]", " char *const envp[]"}, 0 },
+// 12 long sys_chdir ['const char __user *filename']
+{ 12, "sys_chdir", "s", {3}, {0xff}, {"const char __user *filename"}, 0 },
+// 13 long sys_time ['time_t __user *tloc']
+{ 13, "sys_time", "p", {3}, {0xff}, {"time_t __user *tloc"}, 0 },
+// 14 long sys_mknod ['const char __user *filename', ' int mode', 'unsigned dev']
+{ 14, "sys_mknod", "s44", {3, 1, 2}, {0xff, 0xff, 0xff}, {"const char __user *filename", " int mode", "unsigned dev"}, 0 },
+// 15 long sys_chmod ['const char __user *filename', ' mode_t mode']
+{ 15, "sys_chmod", "s4", {3, 1}, {0xff, 0xff}, {"const char __user *filename", " mode_t mode"}, 0 },
+// 16 long sys_lchown16 ['const char __user *filename', 'old_uid_t user', ' old_gid_t group']
+{ 16, "sys_lchown16", "s44", {3, 1, 2}, {0xff, 0xff, 0xff}, {"const char __user *filename", "old_uid_t user", " old_gid_t group"}, 0 },
+// 18 long sys_stat ['char __user *filename', ' struct __old_kernel_stat __user *statbuf']
+{ 18, "sys_stat", "sp", {3, 1}, {0xff, 0xff}, {"char __user *filename", " struct __old_kernel_stat __user *statbuf"}, 0 },
+// 19 long sys_lseek ['unsigned int fd', ' off_t offset', 'unsigned int origin']
+{ 19, "sys_lseek", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"unsigned int fd", " off_t offset", "unsigned int origin"}, 0 },
+// 20 long sys_getpid ['void']
+{ 20, "sys_getpid", "", {}, {}, {}, 0 },
+// 21 long sys_mount ['char __user *dev_name', ' char __user *dir_name', 'char __user *type', ' unsigned long flags', 'void __user *data']
+{ 21, "sys_mount", "sss4p", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"char __user *dev_name", " char __user *dir_name", "char __user *type", " unsigned long flags", "void __user *data"}, 0 },
+// 22 long sys_oldumount ['char __user *name']
+{ 22, "sys_oldumount", "s", {3}, {0xff}, {"char __user *name"}, 0 },
+// 23 long sys_setuid16 ['old_uid_t uid']
+{ 23, "sys_setuid16", "4", {3}, {0xff}, {"old_uid_t uid"}, 0 },
+// 24 long sys_getuid16 ['void']
+{ 24, "sys_getuid16", "", {}, {}, {}, 0 },
+// 25 long sys_stime ['time_t __user *tptr']
+{ 25, "sys_stime", "p", {3}, {0xff}, {"time_t __user *tptr"}, 0 },
+// 26 long sys_ptrace ['long request', ' long pid', ' long addr', ' long data']
+{ 26, "sys_ptrace", "4444", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"long request", " long pid", " long addr", " long data"}, 0 },
+// 27 long sys_alarm ['unsigned int seconds']
+{ 27, "sys_alarm", "4", {3}, {0xff}, {"unsigned int seconds"}, 0 },
+// 28 long sys_fstat ['unsigned int fd', ' struct __old_kernel_stat __user *statbuf']
+{ 28, "sys_fstat", "4p", {3, 1}, {0xff, 0xff}, {"unsigned int fd", " struct __old_kernel_stat __user *statbuf"}, 0 },
+// 29 long sys_pause ['void']
+{ 29, "sys_pause", "", {}, {}, {}, 0 },
+// 30 long sys_utime ['char __user *filename', ' struct utimbuf __user *times']
+{ 30, "sys_utime", "sp", {3, 1}, {0xff, 0xff}, {"char __user *filename", " struct utimbuf __user *times"}, 0 },
+// 33 long sys_access ['const char __user *filename', ' int mode']
+{ 33, "sys_access", "s4", {3, 1}, {0xff, 0xff}, {"const char __user *filename", " int mode"}, 0 },
+// 34 long sys_nice ['int increment']
+{ 34, "sys_nice", "4", {3}, {0xff}, {"int increment"}, 0 },
+// 36 long sys_sync ['void']
+{ 36, "sys_sync", "", {}, {}, {}, 0 },
+// 37 long sys_kill ['int pid', ' int sig']
+{ 37, "sys_kill", "44", {3, 1}, {0xff, 0xff}, {"int pid", " int sig"}, 0 },
+// 38 long sys_rename ['const char __user *oldname', 'const char __user *newname']
+{ 38, "sys_rename", "ss", {3, 1}, {0xff, 0xff}, {"const char __user *oldname", "const char __user *newname"}, 0 },
+// 39 long sys_mkdir ['const char __user *pathname', ' int mode']
+{ 39, "sys_mkdir", "s4", {3, 1}, {0xff, 0xff}, {"const char __user *pathname", " int mode"}, 0 },
+// 40 long sys_rmdir ['const char __user *pathname']
+{ 40, "sys_rmdir", "s", {3}, {0xff}, {"const char __user *pathname"}, 0 },
+// 41 long sys_dup ['unsigned int fildes']
+{ 41, "sys_dup", "4", {3}, {0xff}, {"unsigned int fildes"}, 0 },
+// 42 long sys_pipe ['int __user *']
+{ 42, "sys_pipe", "p", {3}, {0xff}, {"int __user *"}, 0 },
+// 43 long sys_times ['struct tms __user *tbuf']
+{ 43, "sys_times", "p", {3}, {0xff}, {"struct tms __user *tbuf"}, 0 },
+// 45 long sys_brk ['unsigned long brk']
+{ 45, "sys_brk", "4", {3}, {0xff}, {"unsigned long brk"}, 0 },
+// 46 long sys_setgid16 ['old_gid_t gid']
+{ 46, "sys_setgid16", "4", {3}, {0xff}, {"old_gid_t gid"}, 0 },
+// 47 long sys_getgid16 ['void']
+{ 47, "sys_getgid16", "", {}, {}, {}, 0 },
+// 48 unsigned long sys_signal ['int sig', ' void __user *handler']
+{ 48, "sys_signal", "4p", {3, 1}, {0xff, 0xff}, {"int sig", " void __user *handler"}, 0 },
+// 49 long sys_geteuid16 ['void']
+{ 49, "sys_geteuid16", "", {}, {}, {}, 0 },
+// 50 long sys_getegid16 ['void']
+{ 50, "sys_getegid16", "", {}, {}, {}, 0 },
+// 51 long sys_acct ['const char __user *name']
+{ 51, "sys_acct", "s", {3}, {0xff}, {"const char __user *name"}, 0 },
+// 52 long sys_umount ['char __user *name', ' int flags']
+{ 52, "sys_umount", "s4", {3, 1}, {0xff, 0xff}, {"char __user *name", " int flags"}, 0 },
+// 54 long sys_ioctl ['unsigned int fd', ' unsigned int cmd', 'unsigned long arg']
+{ 54, "sys_ioctl", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"unsigned int fd", " unsigned int cmd", "unsigned long arg"}, 0 },
+// 55 long sys_fcntl ['unsigned int fd', ' unsigned int cmd', ' unsigned long arg']
+{ 55, "sys_fcntl", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"unsigned int fd", " unsigned int cmd", " unsigned long arg"}, 0 },
+// 57 long sys_setpgid ['pid_t pid', ' pid_t pgid']
+{ 57, "sys_setpgid", "44", {3, 1}, {0xff, 0xff}, {"pid_t pid", " pid_t pgid"}, 0 },
+// 59 long sys_olduname ['struct oldold_utsname __user *name']
+{ 59, "sys_olduname", "p", {3}, {0xff}, {"struct oldold_utsname __user *name"}, 0 },
+// 60 long sys_umask ['int mask']
+{ 60, "sys_umask", "4", {3}, {0xff}, {"int mask"}, 0 },
+// 61 long sys_chroot ['const char __user *filename']
+{ 61, "sys_chroot", "s", {3}, {0xff}, {"const char __user *filename"}, 0 },
+// 62 long sys_ustat ['unsigned dev', ' struct ustat __user *ubuf']
+{ 62, "sys_ustat", "4p", {3, 1}, {0xff, 0xff}, {"unsigned dev", " struct ustat __user *ubuf"}, 0 },
+// 63 long sys_dup2 ['unsigned int oldfd', ' unsigned int newfd']
+{ 63, "sys_dup2", "44", {3, 1}, {0xff, 0xff}, {"unsigned int oldfd", " unsigned int newfd"}, 0 },
+// 64 long sys_getppid ['void']
+{ 64, "sys_getppid", "", {}, {}, {}, 0 },
+// 65 long sys_getpgrp ['void']
+{ 65, "sys_getpgrp", "", {}, {}, {}, 0 },
+// 66 long sys_setsid ['void']
+{ 66, "sys_setsid", "", {}, {}, {}, 0 },
+// 67 int sigaction ['int sig', ' const struct old_sigaction __user *act', ' struct old_sigaction __user *oact']
+{ 67, "sigaction", "4pp", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int sig", " const struct old_sigaction __user *act", " struct old_sigaction __user *oact"}, 0 },
+// 68 long sys_sgetmask ['void']
+{ 68, "sys_sgetmask", "", {}, {}, {}, 0 },
+// 69 long sys_ssetmask ['int newmask']
+{ 69, "sys_ssetmask", "4", {3}, {0xff}, {"int newmask"}, 0 },
+// 70 long sys_setreuid16 ['old_uid_t ruid', ' old_uid_t euid']
+{ 70, "sys_setreuid16", "44", {3, 1}, {0xff, 0xff}, {"old_uid_t ruid", " old_uid_t euid"}, 0 },
+// 71 long sys_setregid16 ['old_gid_t rgid', ' old_gid_t egid']
+{ 71, "sys_setregid16", "44", {3, 1}, {0xff, 0xff}, {"old_gid_t rgid", " old_gid_t egid"}, 0 },
+// 72 long sigsuspend ['int restart', ' unsigned long oldmask', ' old_sigset_t mask']
+{ 72, "sigsuspend", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int restart", " unsigned long oldmask", " old_sigset_t mask"}, 0 },
+// 73 long sys_sigpending ['old_sigset_t __user *set']
+{ 73, "sys_sigpending", "p", {3}, {0xff}, {"old_sigset_t __user *set"}, 0 },
+// 74 long sys_sethostname ['char __user *name', ' int len']
+{ 74, "sys_sethostname", "s4", {3, 1}, {0xff, 0xff}, {"char __user *name", " int len"}, 0 },
+// 75 long sys_setrlimit ['unsigned int resource', 'struct rlimit __user *rlim']
+{ 75, "sys_setrlimit", "4p", {3, 1}, {0xff, 0xff}, {"unsigned int resource", "struct rlimit __user *rlim"}, 0 },
+// 76 long sys_getrlimit ['unsigned int resource', 'struct rlimit __user *rlim']
+{ 76, "sys_getrlimit", "4p", {3, 1}, {0xff, 0xff}, {"unsigned int resource", "struct rlimit __user *rlim"}, 0 },
+// 77 long sys_getrusage ['int who', ' struct rusage __user *ru']
+{ 77, "sys_getrusage", "4p", {3, 1}, {0xff, 0xff}, {"int who", " struct rusage __user *ru"}, 0 },
+// 78 long sys_gettimeofday ['struct timeval __user *tv', 'struct timezone __user *tz']
+{ 78, "sys_gettimeofday", "pp", {3, 1}, {0xff, 0xff}, {"struct timeval __user *tv", "struct timezone __user *tz"}, 0 },
+// 79 long sys_settimeofday ['struct timeval __user *tv', 'struct timezone __user *tz']
+{ 79, "sys_settimeofday", "pp", {3, 1}, {0xff, 0xff}, {"struct timeval __user *tv", "struct timezone __user *tz"}, 0 },
+// 80 long sys_getgroups16 ['int gidsetsize', ' old_gid_t __user *grouplist']
+{ 80, "sys_getgroups16", "4p", {3, 1}, {0xff, 0xff}, {"int gidsetsize", " old_gid_t __user *grouplist"}, 0 },
+// 81 long sys_setgroups16 ['int gidsetsize', ' old_gid_t __user *grouplist']
+{ 81, "sys_setgroups16", "4p", {3, 1}, {0xff, 0xff}, {"int gidsetsize", " old_gid_t __user *grouplist"}, 0 },
+// 82 long old_select ['struct sel_arg_struct __user *arg']
+{ 82, "old_select", "p", {3}, {0xff}, {"struct sel_arg_struct __user *arg"}, 0 },
+// 83 long sys_symlink ['const char __user *old', ' const char __user *new']
+{ 83, "sys_symlink", "ss", {3, 1}, {0xff, 0xff}, {"const char __user *old", " const char __user *new"}, 0 },
+// 84 long sys_lstat ['char __user *filename', ' struct __old_kernel_stat __user *statbuf']
+{ 84, "sys_lstat", "sp", {3, 1}, {0xff, 0xff}, {"char __user *filename", " struct __old_kernel_stat __user *statbuf"}, 0 },
+// 85 long sys_readlink ['const char __user *path', 'char __user *buf', ' int bufsiz']
+{ 85, "sys_readlink", "sp4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"const char __user *path", "char __user *buf", " int bufsiz"}, 0 },
+// 86 long sys_uselib ['const char __user *library']
+{ 86, "sys_uselib", "s", {3}, {0xff}, {"const char __user *library"}, 0 },
+// 87 long sys_swapon ['const char __user *specialfile', ' int swap_flags']
+{ 87, "sys_swapon", "s4", {3, 1}, {0xff, 0xff}, {"const char __user *specialfile", " int swap_flags"}, 0 },
+// 88 long sys_reboot ['int magic1', ' int magic2', ' unsigned int cmd', 'void __user *arg']
+{ 88, "sys_reboot", "444p", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int magic1", " int magic2", " unsigned int cmd", "void __user *arg"}, 0 },
+// 89 long old_readdir ['unsigned int fd', ' struct old_linux_dirent __user *dirent', ' unsigned int count']
+{ 89, "old_readdir", "4p4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"unsigned int fd", " struct old_linux_dirent __user *dirent", " unsigned int count"}, 0 },
+// 90 long old_mmap ['struct mmap_arg_struct __user *arg']
+{ 90, "old_mmap", "p", {3}, {0xff}, {"struct mmap_arg_struct __user *arg"}, 0 },
+// 91 long sys_munmap ['unsigned long addr', ' size_t len']
+{ 91, "sys_munmap", "44", {3, 1}, {0xff, 0xff}, {"unsigned long addr", " size_t len"}, 0 },
+// 92 long sys_truncate ['const char __user *path', 'unsigned long length']
+{ 92, "sys_truncate", "s4", {3, 1}, {0xff, 0xff}, {"const char __user *path", "unsigned long length"}, 0 },
+// 93 long sys_ftruncate ['unsigned int fd', ' unsigned long length']
+{ 93, "sys_ftruncate", "44", {3, 1}, {0xff, 0xff}, {"unsigned int fd", " unsigned long length"}, 0 },
+// 94 long sys_fchmod ['unsigned int fd', ' mode_t mode']
+{ 94, "sys_fchmod", "44", {3, 1}, {0xff, 0xff}, {"unsigned int fd", " mode_t mode"}, 0 },
+// 95 long sys_fchown16 ['unsigned int fd', ' old_uid_t user', ' old_gid_t group']
+{ 95, "sys_fchown16", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"unsigned int fd", " old_uid_t user", " old_gid_t group"}, 0 },
+// 96 long sys_getpriority ['int which', ' int who']
+{ 96, "sys_getpriority", "44", {3, 1}, {0xff, 0xff}, {"int which", " int who"}, 0 },
+// 97 long sys_setpriority ['int which', ' int who', ' int niceval']
+{ 97, "sys_setpriority", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int which", " int who", " int niceval"}, 0 },
+// 99 long sys_statfs ['const char __user * path', 'struct statfs __user *buf']
+{ 99, "sys_statfs", "sp", {3, 1}, {0xff, 0xff}, {"const char __user * path", "struct statfs __user *buf"}, 0 },
+// 100 long sys_fstatfs ['unsigned int fd', ' struct statfs __user *buf']
+{ 100, "sys_fstatfs", "4p", {3, 1}, {0xff, 0xff}, {"unsigned int fd", " struct statfs __user *buf"}, 0 },
+// 101 long sys_ioperm ['unsigned long from', ' unsigned long num', ' int on']
+{ 101, "sys_ioperm", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"unsigned long from", " unsigned long num", " int on"}, 0 },
+// 102 long sys_socketcall ['int call', ' unsigned long __user *args']
+{ 102, "sys_socketcall", "4p", {3, 1}, {0xff, 0xff}, {"int call", " unsigned long __user *args"}, 0 },
+// 103 long sys_syslog ['int type', ' char __user *buf', ' int len']
+{ 103, "sys_syslog", "4p4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int type", " char __user *buf", " int len"}, 0 },
+// 104 long sys_setitimer ['int which', 'struct itimerval __user *value', 'struct itimerval __user *ovalue']
+{ 104, "sys_setitimer", "4pp", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int which", "struct itimerval __user *value", "struct itimerval __user *ovalue"}, 0 },
+// 105 long sys_getitimer ['int which', ' struct itimerval __user *value']
+{ 105, "sys_getitimer", "4p", {3, 1}, {0xff, 0xff}, {"int which", " struct itimerval __user *value"}, 0 },
+// 106 long sys_newstat ['char __user *filename', 'struct stat __user *statbuf']
+{ 106, "sys_newstat", "sp", {3, 1}, {0xff, 0xff}, {"char __user *filename", "struct stat __user *statbuf"}, 0 },
+// 107 long sys_newlstat ['char __user *filename', 'struct stat __user *statbuf']
+{ 107, "sys_newlstat", "sp", {3, 1}, {0xff, 0xff}, {"char __user *filename", "struct stat __user *statbuf"}, 0 },
+// 108 long sys_newfstat ['unsigned int fd', ' struct stat __user *statbuf']
+{ 108, "sys_newfstat", "4p", {3, 1}, {0xff, 0xff}, {"unsigned int fd", " struct stat __user *statbuf"}, 0 },
+// 109 long sys_uname ['struct old_utsname __user *name']
+{ 109, "sys_uname", "p", {3}, {0xff}, {"struct old_utsname __user *name"}, 0 },
+// 110 long sys_iopl ['unsigned int level']
+{ 110, "sys_iopl", "4", {3}, {0xff}, {"unsigned int level"}, 0 },
+// 111 long sys_vhangup ['void']
+{ 111, "sys_vhangup", "", {}, {}, {}, 0 },
+// 113 int sys_vm86old ['struct vm86_struct __user *user_vm86']
+{ 113, "sys_vm86old", "p", {3}, {0xff}, {"struct vm86_struct __user *user_vm86"}, 0 },
+// 114 long sys_wait4 ['pid_t pid', ' int __user *stat_addr', 'int options', ' struct rusage __user *ru']
+{ 114, "sys_wait4", "4p4p", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"pid_t pid", " int __user *stat_addr", "int options", " struct rusage __user *ru"}, 0 },
+// 115 long sys_swapoff ['const char __user *specialfile']
+{ 115, "sys_swapoff", "s", {3}, {0xff}, {"const char __user *specialfile"}, 0 },
+// 116 long sys_sysinfo ['struct sysinfo __user *info']
+{ 116, "sys_sysinfo", "p", {3}, {0xff}, {"struct sysinfo __user *info"}, 0 },
+// 117 long sys_ipc ['unsigned int call', ' int first', ' unsigned long second', ' unsigned long third', ' void __user *ptr', ' long fifth']
+{ 117, "sys_ipc", "4444p4", {3, 1, 2, 6, 7, 5}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"unsigned int call", " int first", " unsigned long second", " unsigned long third", " void __user *ptr", " long fifth"}, 0 },
+// 118 long sys_fsync ['unsigned int fd']
+{ 118, "sys_fsync", "4", {3}, {0xff}, {"unsigned int fd"}, 0 },
+// 119 long sys_sigreturn ['void']
+{ 119, "sys_sigreturn", "", {}, {}, {}, 0 },
+// 120 long sys_clone ['unsigned long clone_flags', ' unsigned long newsp', ' int __user *parent_tidptr', ' unsigned long tls', ' int __user *child_tidptr']
+{ 120, "sys_clone", "44p4p", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"unsigned long clone_flags", " unsigned long newsp", " int __user *parent_tidptr", " unsigned long tls", " int __user *child_tidptr"}, 0 },
+// 121 long sys_setdomainname ['char __user *name', ' int len']
+{ 121, "sys_setdomainname", "s4", {3, 1}, {0xff, 0xff}, {"char __user *name", " int len"}, 0 },
+// 122 long sys_newuname ['struct new_utsname __user *name']
+{ 122, "sys_newuname", "p", {3}, {0xff}, {"struct new_utsname __user *name"}, 0 },
+// 123 int sys_modify_ldt ['int func', ' void __user *ptr', ' unsigned long bytecount']
+{ 123, "sys_modify_ldt", "4p4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int func", " void __user *ptr", " unsigned long bytecount"}, 0 },
+// 124 long sys_adjtimex ['struct timex __user *txc_p']
+{ 124, "sys_adjtimex", "p", {3}, {0xff}, {"struct timex __user *txc_p"}, 0 },
+// 125 long sys_mprotect ['unsigned long start', ' size_t len', 'unsigned long prot']
+{ 125, "sys_mprotect", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"unsigned long start", " size_t len", "unsigned long prot"}, 0 },
+// 126 long sys_sigprocmask ['int how', ' old_sigset_t __user *set', 'old_sigset_t __user *oset']
+{ 126, "sys_sigprocmask", "4pp", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int how", " old_sigset_t __user *set", "old_sigset_t __user *oset"}, 0 },
+// 128 long sys_init_module ['void __user *umod', ' unsigned long len', 'const char __user *uargs']
+{ 128, "sys_init_module", "p4s", {3, 1, 2}, {0xff, 0xff, 0xff}, {"void __user *umod", " unsigned long len", "const char __user *uargs"}, 0 },
+// 129 long sys_delete_module ['const char __user *name_user', 'unsigned int flags']
+{ 129, "sys_delete_module", "s4", {3, 1}, {0xff, 0xff}, {"const char __user *name_user", "unsigned int flags"}, 0 },
+// 131 long sys_quotactl ['unsigned int cmd', ' const char __user *special', 'qid_t id', ' void __user *addr']
+{ 131, "sys_quotactl", "4s4p", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"unsigned int cmd", " const char __user *special", "qid_t id", " void __user *addr"}, 0 },
+// 132 long sys_getpgid ['pid_t pid']
+{ 132, "sys_getpgid", "4", {3}, {0xff}, {"pid_t pid"}, 0 },
+// 133 long sys_fchdir ['unsigned int fd']
+{ 133, "sys_fchdir", "4", {3}, {0xff}, {"unsigned int fd"}, 0 },
+// 134 long sys_bdflush ['int func', ' long data']
+{ 134, "sys_bdflush", "44", {3, 1}, {0xff, 0xff}, {"int func", " long data"}, 0 },
+// 135 long sys_sysfs ['int option', 'unsigned long arg1', ' unsigned long arg2']
+{ 135, "sys_sysfs", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int option", "unsigned long arg1", " unsigned long arg2"}, 0 },
+// 136 long sys_personality ['u_long personality']
+{ 136, "sys_personality", "4", {3}, {0xff}, {"u_long personality"}, 0 },
+// 138 long sys_setfsuid16 ['old_uid_t uid']
+{ 138, "sys_setfsuid16", "4", {3}, {0xff}, {"old_uid_t uid"}, 0 },
+// 139 long sys_setfsgid16 ['old_gid_t gid']
+{ 139, "sys_setfsgid16", "4", {3}, {0xff}, {"old_gid_t gid"}, 0 },
+// 140 long sys_llseek ['unsigned int fd', ' unsigned long offset_high', 'unsigned long offset_low', ' loff_t __user *result', 'unsigned int origin']
+{ 140, "sys_llseek", "444p4", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"unsigned int fd", " unsigned long offset_high", "unsigned long offset_low", " loff_t __user *result", "unsigned int origin"}, 0 },
+// 141 long sys_getdents ['unsigned int fd', 'struct linux_dirent __user *dirent', 'unsigned int count']
+{ 141, "sys_getdents", "4p4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"unsigned int fd", "struct linux_dirent __user *dirent", "unsigned int count"}, 0 },
+// 142 long sys_select ['int n', ' fd_set __user *inp', ' fd_set __user *outp', 'fd_set __user *exp', ' struct timeval __user *tvp']
+{ 142, "sys_select", "4pppp", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int n", " fd_set __user *inp", " fd_set __user *outp", "fd_set __user *exp", " struct timeval __user *tvp"}, 0 },
+// 143 long sys_flock ['unsigned int fd', ' unsigned int cmd']
+{ 143, "sys_flock", "44", {3, 1}, {0xff, 0xff}, {"unsigned int fd", " unsigned int cmd"}, 0 },
+// 144 long sys_msync ['unsigned long start', ' size_t len', ' int flags']
+{ 144, "sys_msync", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"unsigned long start", " size_t len", " int flags"}, 0 },
+// 145 long sys_readv ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen']
+{ 145, "sys_readv", "4p4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"unsigned long fd", "const struct iovec __user *vec", "unsigned long vlen"}, 0 },
+// 146 long sys_writev ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen']
+{ 146, "sys_writev", "4p4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"unsigned long fd", "const struct iovec __user *vec", "unsigned long vlen"}, 0 },
+// 147 long sys_getsid ['pid_t pid']
+{ 147, "sys_getsid", "4", {3}, {0xff}, {"pid_t pid"}, 0 },
+// 148 long sys_fdatasync ['unsigned int fd']
+{ 148, "sys_fdatasync", "4", {3}, {0xff}, {"unsigned int fd"}, 0 },
+// 149 long sys_sysctl ['struct __sysctl_args __user *args']
+{ 149, "sys_sysctl", "p", {3}, {0xff}, {"struct __sysctl_args __user *args"}, 0 },
+// 150 long sys_mlock ['unsigned long start', ' size_t len']
+{ 150, "sys_mlock", "44", {3, 1}, {0xff, 0xff}, {"unsigned long start", " size_t len"}, 0 },
+// 151 long sys_munlock ['unsigned long start', ' size_t len']
+{ 151, "sys_munlock", "44", {3, 1}, {0xff, 0xff}, {"unsigned long start", " size_t len"}, 0 },
+// 152 long sys_mlockall ['int flags']
+{ 152, "sys_mlockall", "4", {3}, {0xff}, {"int flags"}, 0 },
+// 153 long sys_munlockall ['void']
+{ 153, "sys_munlockall", "", {}, {}, {}, 0 },
+// 154 long sys_sched_setparam ['pid_t pid', 'struct sched_param __user *param']
+{ 154, "sys_sched_setparam", "4p", {3, 1}, {0xff, 0xff}, {"pid_t pid", "struct sched_param __user *param"}, 0 },
+// 155 long sys_sched_getparam ['pid_t pid', 'struct sched_param __user *param']
+{ 155, "sys_sched_getparam", "4p", {3, 1}, {0xff, 0xff}, {"pid_t pid", "struct sched_param __user *param"}, 0 },
+// 156 long sys_sched_setscheduler ['pid_t pid', ' int policy', 'struct sched_param __user *param']
+{ 156, "sys_sched_setscheduler", "44p", {3, 1, 2}, {0xff, 0xff, 0xff}, {"pid_t pid", " int policy", "struct sched_param __user *param"}, 0 },
+// 157 long sys_sched_getscheduler ['pid_t pid']
+{ 157, "sys_sched_getscheduler", "4", {3}, {0xff}, {"pid_t pid"}, 0 },
+// 158 long sys_sched_yield ['void']
+{ 158, "sys_sched_yield", "", {}, {}, {}, 0 },
+// 159 long sys_sched_get_priority_max ['int policy']
+{ 159, "sys_sched_get_priority_max", "4", {3}, {0xff}, {"int policy"}, 0 },
+// 160 long sys_sched_get_priority_min ['int policy']
+{ 160, "sys_sched_get_priority_min", "4", {3}, {0xff}, {"int policy"}, 0 },
+// 161 long sys_sched_rr_get_interval ['pid_t pid', 'struct timespec __user *interval']
+{ 161, "sys_sched_rr_get_interval", "4p", {3, 1}, {0xff, 0xff}, {"pid_t pid", "struct timespec __user *interval"}, 0 },
+// 162 long sys_nanosleep ['struct timespec __user *rqtp', ' struct timespec __user *rmtp']
+{ 162, "sys_nanosleep", "pp", {3, 1}, {0xff, 0xff}, {"struct timespec __user *rqtp", " struct timespec __user *rmtp"}, 0 },
+// 163 unsigned long sys_mremap ['unsigned long addr', ' unsigned long old_len', ' unsigned long new_len', ' unsigned long flags', ' unsigned long new_addr']
+{ 163, "sys_mremap", "44444", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"unsigned long addr", " unsigned long old_len", " unsigned long new_len", " unsigned long flags", " unsigned long new_addr"}, 0 },
+// 164 long sys_setresuid16 ['old_uid_t ruid', ' old_uid_t euid', ' old_uid_t suid']
+{ 164, "sys_setresuid16", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"old_uid_t ruid", " old_uid_t euid", " old_uid_t suid"}, 0 },
+// 165 long sys_getresuid16 ['old_uid_t __user *ruid', 'old_uid_t __user *euid', ' old_uid_t __user *suid']
+{ 165, "sys_getresuid16", "ppp", {3, 1, 2}, {0xff, 0xff, 0xff}, {"old_uid_t __user *ruid", "old_uid_t __user *euid", " old_uid_t __user *suid"}, 0 },
+// 166 int sys_vm86 ['unsigned long cmd', ' unsigned long arg']
+{ 166, "sys_vm86", "44", {3, 1}, {0xff, 0xff}, {"unsigned long cmd", " unsigned long arg"}, 0 },
+// 168 long sys_poll ['struct pollfd __user *ufds', ' unsigned int nfds', 'long timeout']
+{ 168, "sys_poll", "p44", {3, 1, 2}, {0xff, 0xff, 0xff}, {"struct pollfd __user *ufds", " unsigned int nfds", "long timeout"}, 0 },
+// 170 long sys_setresgid16 ['old_gid_t rgid', ' old_gid_t egid', ' old_gid_t sgid']
+{ 170, "sys_setresgid16", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"old_gid_t rgid", " old_gid_t egid", " old_gid_t sgid"}, 0 },
+// 171 long sys_getresgid16 ['old_gid_t __user *rgid', 'old_gid_t __user *egid', ' old_gid_t __user *sgid']
+{ 171, "sys_getresgid16", "ppp", {3, 1, 2}, {0xff, 0xff, 0xff}, {"old_gid_t __user *rgid", "old_gid_t __user *egid", " old_gid_t __user *sgid"}, 0 },
+// 172 long sys_prctl ['int option', ' unsigned long arg2', ' unsigned long arg3', 'unsigned long arg4', ' unsigned long arg5']
+{ 172, "sys_prctl", "44444", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int option", " unsigned long arg2", " unsigned long arg3", "unsigned long arg4", " unsigned long arg5"}, SYSCALL_CB_PRCTL },
+// 173 long sys_rt_sigreturn ['void']
+{ 173, "sys_rt_sigreturn", "", {}, {}, {}, 0 },
+// 174 long rt_sigaction ['int sig', ' const struct sigaction __user * act', ' struct sigaction __user * oact', '  size_t sigsetsize']
+{ 174, "rt_sigaction", "4pp4", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int sig", " const struct sigaction __user * act", " struct sigaction __user * oact", "  size_t sigsetsize"}, 0 },
+// 175 long sys_rt_sigprocmask ['int how', ' sigset_t __user *set', 'sigset_t __user *oset', ' size_t sigsetsize']
+{ 175, "sys_rt_sigprocmask", "4pp4", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int how", " sigset_t __user *set", "sigset_t __user *oset", " size_t sigsetsize"}, 0 },
+// 176 long sys_rt_sigpending ['sigset_t __user *set', ' size_t sigsetsize']
+{ 176, "sys_rt_sigpending", "p4", {3, 1}, {0xff, 0xff}, {"sigset_t __user *set", " size_t sigsetsize"}, 0 },
+// 177 long sys_rt_sigtimedwait ['const sigset_t __user *uthese', 'siginfo_t __user *uinfo', 'const struct timespec __user *uts', 'size_t sigsetsize']
+{ 177, "sys_rt_sigtimedwait", "ppp4", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"const sigset_t __user *uthese", "siginfo_t __user *uinfo", "const struct timespec __user *uts", "size_t sigsetsize"}, 0 },
+// 178 long sys_rt_sigqueueinfo ['int pid', ' int sig', ' siginfo_t __user *uinfo']
+{ 178, "sys_rt_sigqueueinfo", "44p", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int pid", " int sig", " siginfo_t __user *uinfo"}, 0 },
+// 179 int sys_rt_sigsuspend ['sigset_t __user *unewset', ' size_t sigsetsize']
+{ 179, "sys_rt_sigsuspend", "p4", {3, 1}, {0xff, 0xff}, {"sigset_t __user *unewset", " size_t sigsetsize"}, 0 },
+// 180 long sys_pread64 ['unsigned int fd', ' char __user *buf', 'size_t count', ' loff_t pos']
+{ 180, "sys_pread64", "4p48", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 7}, {"unsigned int fd", " char __user *buf", "size_t count", " loff_t pos"}, 0 },
+// 181 long sys_pwrite64 ['unsigned int fd', ' const char __user *buf', 'size_t count', ' loff_t pos']
+{ 181, "sys_pwrite64", "4p48", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 7}, {"unsigned int fd", " const char __user *buf", "size_t count", " loff_t pos"}, 0 },
+// 182 long sys_chown16 ['const char __user *filename', 'old_uid_t user', ' old_gid_t group']
+{ 182, "sys_chown16", "s44", {3, 1, 2}, {0xff, 0xff, 0xff}, {"const char __user *filename", "old_uid_t user", " old_gid_t group"}, 0 },
+// 183 long sys_getcwd ['char __user *buf', ' unsigned long size']
+{ 183, "sys_getcwd", "p4", {3, 1}, {0xff, 0xff}, {"char __user *buf", " unsigned long size"}, 0 },
+// 184 long sys_capget ['cap_user_header_t header', 'cap_user_data_t dataptr']
+{ 184, "sys_capget", "pp", {3, 1}, {0xff, 0xff}, {"cap_user_header_t header", "cap_user_data_t dataptr"}, 0 },
+// 185 long sys_capset ['cap_user_header_t header', 'const cap_user_data_t data']
+{ 185, "sys_capset", "pp", {3, 1}, {0xff, 0xff}, {"cap_user_header_t header", "const cap_user_data_t data"}, 0 },
+// 186 long sys_sigaltstack ['const stack_t __user *uss', ' stack_t __user *uoss']
+{ 186, "sys_sigaltstack", "pp", {3, 1}, {0xff, 0xff}, {"const stack_t __user *uss", " stack_t __user *uoss"}, 0 },
+// 187 long sys_sendfile ['int out_fd', ' int in_fd', 'off_t __user *offset', ' size_t count']
+{ 187, "sys_sendfile", "44p4", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int out_fd", " int in_fd", "off_t __user *offset", " size_t count"}, 0 },
+// 190 long sys_vfork ['void']
+{ 190, "sys_vfork", "", {}, {}, {}, 0 },
+// 191 long sys_getrlimit ['unsigned int resource', 'struct rlimit __user *rlim']
+{ 191, "sys_getrlimit", "4p", {3, 1}, {0xff, 0xff}, {"unsigned int resource", "struct rlimit __user *rlim"}, 0 },
+// 192 long sys_mmap_pgoff ['unsigned long addr', ' unsigned long len', ' unsigned long prot', ' unsigned long flags', ' unsigned long fd', ' unsigned long pgoff']
+{ 192, "sys_mmap_pgoff", "444444", {3, 1, 2, 6, 7, 5}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"unsigned long addr", " unsigned long len", " unsigned long prot", " unsigned long flags", " unsigned long fd", " unsigned long pgoff"}, 0 },
+// 193 long sys_truncate64 ['const char __user *path', ' loff_t length']
+{ 193, "sys_truncate64", "s8", {3, 1}, {0xff, 2}, {"const char __user *path", " loff_t length"}, 0 },
+// 194 long sys_ftruncate64 ['unsigned int fd', ' loff_t length']
+{ 194, "sys_ftruncate64", "48", {3, 1}, {0xff, 2}, {"unsigned int fd", " loff_t length"}, 0 },
+// 195 long sys_stat64 ['char __user *filename', 'struct stat64 __user *statbuf']
+{ 195, "sys_stat64", "sp", {3, 1}, {0xff, 0xff}, {"char __user *filename", "struct stat64 __user *statbuf"}, 0 },
+// 196 long sys_lstat64 ['char __user *filename', 'struct stat64 __user *statbuf']
+{ 196, "sys_lstat64", "sp", {3, 1}, {0xff, 0xff}, {"char __user *filename", "struct stat64 __user *statbuf"}, 0 },
+// 197 long sys_fstat64 ['unsigned long fd', ' struct stat64 __user *statbuf']
+{ 197, "sys_fstat64", "4p", {3, 1}, {0xff, 0xff}, {"unsigned long fd", " struct stat64 __user *statbuf"}, 0 },
+// 198 long sys_lchown ['const char __user *filename', 'uid_t user', ' gid_t group']
+{ 198, "sys_lchown", "s44", {3, 1, 2}, {0xff, 0xff, 0xff}, {"const char __user *filename", "uid_t user", " gid_t group"}, 0 },
+// 199 long sys_getuid ['void']
+{ 199, "sys_getuid", "", {}, {}, {}, 0 },
+// 200 long sys_getgid ['void']
+{ 200, "sys_getgid", "", {}, {}, {}, 0 },
+// 201 long sys_geteuid ['void']
+{ 201, "sys_geteuid", "", {}, {}, {}, 0 },
+// 202 long sys_getegid ['void']
+{ 202, "sys_getegid", "", {}, {}, {}, 0 },
+// 203 long sys_setreuid ['uid_t ruid', ' uid_t euid']
+{ 203, "sys_setreuid", "44", {3, 1}, {0xff, 0xff}, {"uid_t ruid", " uid_t euid"}, 0 },
+// 204 long sys_setregid ['gid_t rgid', ' gid_t egid']
+{ 204, "sys_setregid", "44", {3, 1}, {0xff, 0xff}, {"gid_t rgid", " gid_t egid"}, 0 },
+// 205 long sys_getgroups ['int gidsetsize', ' gid_t __user *grouplist']
+{ 205, "sys_getgroups", "4p", {3, 1}, {0xff, 0xff}, {"int gidsetsize", " gid_t __user *grouplist"}, 0 },
+// 206 long sys_setgroups ['int gidsetsize', ' gid_t __user *grouplist']
+{ 206, "sys_setgroups", "4p", {3, 1}, {0xff, 0xff}, {"int gidsetsize", " gid_t __user *grouplist"}, 0 },
+// 207 long sys_fchown ['unsigned int fd', ' uid_t user', ' gid_t group']
+{ 207, "sys_fchown", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"unsigned int fd", " uid_t user", " gid_t group"}, 0 },
+// 208 long sys_setresuid ['uid_t ruid', ' uid_t euid', ' uid_t suid']
+{ 208, "sys_setresuid", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"uid_t ruid", " uid_t euid", " uid_t suid"}, 0 },
+// 209 long sys_getresuid ['uid_t __user *ruid', ' uid_t __user *euid', ' uid_t __user *suid']
+{ 209, "sys_getresuid", "ppp", {3, 1, 2}, {0xff, 0xff, 0xff}, {"uid_t __user *ruid", " uid_t __user *euid", " uid_t __user *suid"}, 0 },
+// 210 long sys_setresgid ['gid_t rgid', ' gid_t egid', ' gid_t sgid']
+{ 210, "sys_setresgid", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"gid_t rgid", " gid_t egid", " gid_t sgid"}, 0 },
+// 211 long sys_getresgid ['gid_t __user *rgid', ' gid_t __user *egid', ' gid_t __user *sgid']
+{ 211, "sys_getresgid", "ppp", {3, 1, 2}, {0xff, 0xff, 0xff}, {"gid_t __user *rgid", " gid_t __user *egid", " gid_t __user *sgid"}, 0 },
+// 212 long sys_chown ['const char __user *filename', 'uid_t user', ' gid_t group']
+{ 212, "sys_chown", "s44", {3, 1, 2}, {0xff, 0xff, 0xff}, {"const char __user *filename", "uid_t user", " gid_t group"}, 0 },
+// 213 long sys_setuid ['uid_t uid']
+{ 213, "sys_setuid", "4", {3}, {0xff}, {"uid_t uid"}, 0 },
+// 214 long sys_setgid ['gid_t gid']
+{ 214, "sys_setgid", "4", {3}, {0xff}, {"gid_t gid"}, 0 },
+// 215 long sys_setfsuid ['uid_t uid']
+{ 215, "sys_setfsuid", "4", {3}, {0xff}, {"uid_t uid"}, 0 },
+// 216 long sys_setfsgid ['gid_t gid']
+{ 216, "sys_setfsgid", "4", {3}, {0xff}, {"gid_t gid"}, 0 },
+// 217 long sys_pivot_root ['const char __user *new_root', 'const char __user *put_old']
+{ 217, "sys_pivot_root", "ss", {3, 1}, {0xff, 0xff}, {"const char __user *new_root", "const char __user *put_old"}, 0 },
+// 218 long sys_mincore ['unsigned long start', ' size_t len', 'unsigned char __user * vec']
+{ 218, "sys_mincore", "44s", {3, 1, 2}, {0xff, 0xff, 0xff}, {"unsigned long start", " size_t len", "unsigned char __user * vec"}, 0 },
+// 219 long sys_madvise ['unsigned long start', ' size_t len', ' int behavior']
+{ 219, "sys_madvise", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"unsigned long start", " size_t len", " int behavior"}, 0 },
+// 220 long sys_getdents64 ['unsigned int fd', 'struct linux_dirent64 __user *dirent', 'unsigned int count']
+{ 220, "sys_getdents64", "4p4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"unsigned int fd", "struct linux_dirent64 __user *dirent", "unsigned int count"}, 0 },
+// 221 long sys_fcntl64 ['unsigned int fd', 'unsigned int cmd', ' unsigned long arg']
+{ 221, "sys_fcntl64", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"unsigned int fd", "unsigned int cmd", " unsigned long arg"}, 0 },
+// 224 long sys_gettid ['void']
+{ 224, "sys_gettid", "", {}, {}, {}, 0 },
+// 225 long sys_readahead ['int fd', ' loff_t offset', ' size_t count']
+{ 225, "sys_readahead", "484", {3, 1, 6}, {0xff, 2, 0xff}, {"int fd", " loff_t offset", " size_t count"}, 0 },
+// 226 long sys_setxattr ['const char __user *path', ' const char __user *name', 'const void __user *value', ' size_t size', ' int flags']
+{ 226, "sys_setxattr", "ssp44", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"const char __user *path", " const char __user *name", "const void __user *value", " size_t size", " int flags"}, 0 },
+// 227 long sys_lsetxattr ['const char __user *path', ' const char __user *name', 'const void __user *value', ' size_t size', ' int flags']
+{ 227, "sys_lsetxattr", "ssp44", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"const char __user *path", " const char __user *name", "const void __user *value", " size_t size", " int flags"}, 0 },
+// 228 long sys_fsetxattr ['int fd', ' const char __user *name', 'const void __user *value', ' size_t size', ' int flags']
+{ 228, "sys_fsetxattr", "4sp44", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int fd", " const char __user *name", "const void __user *value", " size_t size", " int flags"}, 0 },
+// 229 long sys_getxattr ['const char __user *path', ' const char __user *name', 'void __user *value', ' size_t size']
+{ 229, "sys_getxattr", "ssp4", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"const char __user *path", " const char __user *name", "void __user *value", " size_t size"}, 0 },
+// 230 long sys_lgetxattr ['const char __user *path', ' const char __user *name', 'void __user *value', ' size_t size']
+{ 230, "sys_lgetxattr", "ssp4", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"const char __user *path", " const char __user *name", "void __user *value", " size_t size"}, 0 },
+// 231 long sys_fgetxattr ['int fd', ' const char __user *name', 'void __user *value', ' size_t size']
+{ 231, "sys_fgetxattr", "4sp4", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int fd", " const char __user *name", "void __user *value", " size_t size"}, 0 },
+// 232 long sys_listxattr ['const char __user *path', ' char __user *list', 'size_t size']
+{ 232, "sys_listxattr", "ss4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"const char __user *path", " char __user *list", "size_t size"}, 0 },
+// 233 long sys_llistxattr ['const char __user *path', ' char __user *list', 'size_t size']
+{ 233, "sys_llistxattr", "ss4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"const char __user *path", " char __user *list", "size_t size"}, 0 },
+// 234 long sys_flistxattr ['int fd', ' char __user *list', ' size_t size']
+{ 234, "sys_flistxattr", "4s4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int fd", " char __user *list", " size_t size"}, 0 },
+// 235 long sys_removexattr ['const char __user *path', 'const char __user *name']
+{ 235, "sys_removexattr", "ss", {3, 1}, {0xff, 0xff}, {"const char __user *path", "const char __user *name"}, 0 },
+// 236 long sys_lremovexattr ['const char __user *path', 'const char __user *name']
+{ 236, "sys_lremovexattr", "ss", {3, 1}, {0xff, 0xff}, {"const char __user *path", "const char __user *name"}, 0 },
+// 237 long sys_fremovexattr ['int fd', ' const char __user *name']
+{ 237, "sys_fremovexattr", "4s", {3, 1}, {0xff, 0xff}, {"int fd", " const char __user *name"}, 0 },
+// 238 long sys_tkill ['int pid', ' int sig']
+{ 238, "sys_tkill", "44", {3, 1}, {0xff, 0xff}, {"int pid", " int sig"}, 0 },
+// 239 long sys_sendfile64 ['int out_fd', ' int in_fd', 'loff_t __user *offset', ' size_t count']
+{ 239, "sys_sendfile64", "44p4", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int out_fd", " int in_fd", "loff_t __user *offset", " size_t count"}, 0 },
+// 240 long sys_futex ['u32 __user *uaddr', ' int op', ' u32 val', 'struct timespec __user *utime', ' u32 __user *uaddr2', 'u32 val3']
+{ 240, "sys_futex", "p44pp4", {3, 1, 2, 6, 7, 5}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"u32 __user *uaddr", " int op", " u32 val", "struct timespec __user *utime", " u32 __user *uaddr2", "u32 val3"}, 0 },
+// 241 long sys_sched_setaffinity ['pid_t pid', ' unsigned int len', 'unsigned long __user *user_mask_ptr']
+{ 241, "sys_sched_setaffinity", "44p", {3, 1, 2}, {0xff, 0xff, 0xff}, {"pid_t pid", " unsigned int len", "unsigned long __user *user_mask_ptr"}, 0 },
+// 242 long sys_sched_getaffinity ['pid_t pid', ' unsigned int len', 'unsigned long __user *user_mask_ptr']
+{ 242, "sys_sched_getaffinity", "44p", {3, 1, 2}, {0xff, 0xff, 0xff}, {"pid_t pid", " unsigned int len", "unsigned long __user *user_mask_ptr"}, 0 },
+// 243 int sys_set_thread_area ['struct user_desc __user *u_info']
+{ 243, "sys_set_thread_area", "p", {3}, {0xff}, {"struct user_desc __user *u_info"}, 0 },
+// 244 int sys_get_thread_area ['struct user_desc __user *u_info']
+{ 244, "sys_get_thread_area", "p", {3}, {0xff}, {"struct user_desc __user *u_info"}, 0 },
+// 245 long sys_io_setup ['unsigned nr_reqs', ' aio_context_t __user *ctx']
+{ 245, "sys_io_setup", "4p", {3, 1}, {0xff, 0xff}, {"unsigned nr_reqs", " aio_context_t __user *ctx"}, 0 },
+// 246 long sys_io_destroy ['aio_context_t ctx']
+{ 246, "sys_io_destroy", "4", {3}, {0xff}, {"aio_context_t ctx"}, 0 },
+// 247 long sys_io_getevents ['aio_context_t ctx_id', 'long min_nr', 'long nr', 'struct io_event __user *events', 'struct timespec __user *timeout']
+{ 247, "sys_io_getevents", "444pp", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"aio_context_t ctx_id", "long min_nr", "long nr", "struct io_event __user *events", "struct timespec __user *timeout"}, 0 },
+// 248 long sys_io_submit ['aio_context_t', ' long', 'struct iocb __user * __user *']
+{ 248, "sys_io_submit", "44p", {3, 1, 2}, {0xff, 0xff, 0xff}, {"aio_context_t", " long", "struct iocb __user * __user *"}, 0 },
+// 249 long sys_io_cancel ['aio_context_t ctx_id', ' struct iocb __user *iocb', 'struct io_event __user *result']
+{ 249, "sys_io_cancel", "4pp", {3, 1, 2}, {0xff, 0xff, 0xff}, {"aio_context_t ctx_id", " struct iocb __user *iocb", "struct io_event __user *result"}, 0 },
+// 250 long sys_fadvise64 ['int fd', ' loff_t offset', ' size_t len', ' int advice']
+{ 250, "sys_fadvise64", "4844", {3, 1, 6, 7}, {0xff, 2, 0xff, 0xff}, {"int fd", " loff_t offset", " size_t len", " int advice"}, 0 },
+// 252 long sys_exit_group ['int error_code']
+{ 252, "sys_exit_group", "4", {3}, {0xff}, {"int error_code"}, 0 },
+// 253 long sys_lookup_dcookie ['u64 cookie64', ' char __user *buf', ' size_t len']
+{ 253, "sys_lookup_dcookie", "8p4", {3, 2, 6}, {1, 0xff, 0xff}, {"u64 cookie64", " char __user *buf", " size_t len"}, 0 },
+// 254 long sys_epoll_create ['int size']
+{ 254, "sys_epoll_create", "4", {3}, {0xff}, {"int size"}, 0 },
+// 255 long sys_epoll_ctl ['int epfd', ' int op', ' int fd', 'struct epoll_event __user *event']
+{ 255, "sys_epoll_ctl", "444p", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int epfd", " int op", " int fd", "struct epoll_event __user *event"}, 0 },
+// 256 long sys_epoll_wait ['int epfd', ' struct epoll_event __user *events', 'int maxevents', ' int timeout']
+{ 256, "sys_epoll_wait", "4p44", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int epfd", " struct epoll_event __user *events", "int maxevents", " int timeout"}, 0 },
+// 257 long sys_remap_file_pages ['unsigned long start', ' unsigned long size', 'unsigned long prot', ' unsigned long pgoff', 'unsigned long flags']
+{ 257, "sys_remap_file_pages", "44444", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"unsigned long start", " unsigned long size", "unsigned long prot", " unsigned long pgoff", "unsigned long flags"}, 0 },
+// 258 long sys_set_tid_address ['int __user *tidptr']
+{ 258, "sys_set_tid_address", "p", {3}, {0xff}, {"int __user *tidptr"}, 0 },
+// 259 long sys_timer_create ['clockid_t which_clock', 'struct sigevent __user *timer_event_spec', 'timer_t __user * created_timer_id']
+{ 259, "sys_timer_create", "4pp", {3, 1, 2}, {0xff, 0xff, 0xff}, {"clockid_t which_clock", "struct sigevent __user *timer_event_spec", "timer_t __user * created_timer_id"}, 0 },
+// 260 long sys_timer_settime ['timer_t timer_id', ' int flags', 'const struct itimerspec __user *new_setting', 'struct itimerspec __user *old_setting']
+{ 260, "sys_timer_settime", "44pp", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"timer_t timer_id", " int flags", "const struct itimerspec __user *new_setting", "struct itimerspec __user *old_setting"}, 0 },
+// 261 long sys_timer_gettime ['timer_t timer_id', 'struct itimerspec __user *setting']
+{ 261, "sys_timer_gettime", "4p", {3, 1}, {0xff, 0xff}, {"timer_t timer_id", "struct itimerspec __user *setting"}, 0 },
+// 262 long sys_timer_getoverrun ['timer_t timer_id']
+{ 262, "sys_timer_getoverrun", "4", {3}, {0xff}, {"timer_t timer_id"}, 0 },
+// 263 long sys_timer_delete ['timer_t timer_id']
+{ 263, "sys_timer_delete", "4", {3}, {0xff}, {"timer_t timer_id"}, 0 },
+// 264 long sys_clock_settime ['clockid_t which_clock', 'const struct timespec __user *tp']
+{ 264, "sys_clock_settime", "4p", {3, 1}, {0xff, 0xff}, {"clockid_t which_clock", "const struct timespec __user *tp"}, 0 },
+// 265 long sys_clock_gettime ['clockid_t which_clock', 'struct timespec __user *tp']
+{ 265, "sys_clock_gettime", "4p", {3, 1}, {0xff, 0xff}, {"clockid_t which_clock", "struct timespec __user *tp"}, 0 },
+// 266 long sys_clock_getres ['clockid_t which_clock', 'struct timespec __user *tp']
+{ 266, "sys_clock_getres", "4p", {3, 1}, {0xff, 0xff}, {"clockid_t which_clock", "struct timespec __user *tp"}, 0 },
+// 267 long sys_clock_nanosleep ['clockid_t which_clock', ' int flags', 'const struct timespec __user *rqtp', 'struct timespec __user *rmtp']
+{ 267, "sys_clock_nanosleep", "44pp", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"clockid_t which_clock", " int flags", "const struct timespec __user *rqtp", "struct timespec __user *rmtp"}, 0 },
+// 268 long sys_statfs64 ['const char __user *path', ' size_t sz', 'struct statfs64 __user *buf']
+{ 268, "sys_statfs64", "s4p", {3, 1, 2}, {0xff, 0xff, 0xff}, {"const char __user *path", " size_t sz", "struct statfs64 __user *buf"}, 0 },
+// 269 long sys_fstatfs64 ['unsigned int fd', ' size_t sz', 'struct statfs64 __user *buf']
+{ 269, "sys_fstatfs64", "44p", {3, 1, 2}, {0xff, 0xff, 0xff}, {"unsigned int fd", " size_t sz", "struct statfs64 __user *buf"}, 0 },
+// 270 long sys_tgkill ['int tgid', ' int pid', ' int sig']
+{ 270, "sys_tgkill", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int tgid", " int pid", " int sig"}, 0 },
+// 271 long sys_utimes ['char __user *filename', 'struct timeval __user *utimes']
+{ 271, "sys_utimes", "sp", {3, 1}, {0xff, 0xff}, {"char __user *filename", "struct timeval __user *utimes"}, 0 },
+// 272 long sys_fadvise64_64 ['int fd', ' loff_t offset', ' loff_t len', ' int advice']
+{ 272, "sys_fadvise64_64", "4884", {3, 1, 6, 5}, {0xff, 2, 7, 0xff}, {"int fd", " loff_t offset", " loff_t len", " int advice"}, 0 },
+// 274 long sys_mbind ['unsigned long start', ' unsigned long len', 'unsigned long mode', 'unsigned long __user *nmask', 'unsigned long maxnode', 'unsigned flags']
+{ 274, "sys_mbind", "444p44", {3, 1, 2, 6, 7, 5}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"unsigned long start", " unsigned long len", "unsigned long mode", "unsigned long __user *nmask", "unsigned long maxnode", "unsigned flags"}, 0 },
+// 275 long sys_get_mempolicy ['int __user *policy', 'unsigned long __user *nmask', 'unsigned long maxnode', 'unsigned long addr', ' unsigned long flags']
+{ 275, "sys_get_mempolicy", "pp444", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int __user *policy", "unsigned long __user *nmask", "unsigned long maxnode", "unsigned long addr", " unsigned long flags"}, 0 },
+// 276 long sys_set_mempolicy ['int mode', ' unsigned long __user *nmask', 'unsigned long maxnode']
+{ 276, "sys_set_mempolicy", "4p4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int mode", " unsigned long __user *nmask", "unsigned long maxnode"}, 0 },
+// 277 long sys_mq_open ['const char __user *name', ' int oflag', ' mode_t mode', ' struct mq_attr __user *attr']
+{ 277, "sys_mq_open", "s44p", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"const char __user *name", " int oflag", " mode_t mode", " struct mq_attr __user *attr"}, 0 },
+// 278 long sys_mq_unlink ['const char __user *name']
+{ 278, "sys_mq_unlink", "s", {3}, {0xff}, {"const char __user *name"}, 0 },
+// 279 long sys_mq_timedsend ['mqd_t mqdes', ' const char __user *msg_ptr', ' size_t msg_len', ' unsigned int msg_prio', ' const struct timespec __user *abs_timeout']
+{ 279, "sys_mq_timedsend", "4s44p", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"mqd_t mqdes", " const char __user *msg_ptr", " size_t msg_len", " unsigned int msg_prio", " const struct timespec __user *abs_timeout"}, 0 },
+// 280 long sys_mq_timedreceive ['mqd_t mqdes', ' char __user *msg_ptr', ' size_t msg_len', ' unsigned int __user *msg_prio', ' const struct timespec __user *abs_timeout']
+{ 280, "sys_mq_timedreceive", "4s4pp", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"mqd_t mqdes", " char __user *msg_ptr", " size_t msg_len", " unsigned int __user *msg_prio", " const struct timespec __user *abs_timeout"}, 0 },
+// 281 long sys_mq_notify ['mqd_t mqdes', ' const struct sigevent __user *notification']
+{ 281, "sys_mq_notify", "4p", {3, 1}, {0xff, 0xff}, {"mqd_t mqdes", " const struct sigevent __user *notification"}, 0 },
+// 282 long sys_mq_getsetattr ['mqd_t mqdes', ' const struct mq_attr __user *mqstat', ' struct mq_attr __user *omqstat']
+{ 282, "sys_mq_getsetattr", "4pp", {3, 1, 2}, {0xff, 0xff, 0xff}, {"mqd_t mqdes", " const struct mq_attr __user *mqstat", " struct mq_attr __user *omqstat"}, 0 },
+// 283 long sys_kexec_load ['unsigned long entry', ' unsigned long nr_segments', 'struct kexec_segment __user *segments', 'unsigned long flags']
+{ 283, "sys_kexec_load", "44p4", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"unsigned long entry", " unsigned long nr_segments", "struct kexec_segment __user *segments", "unsigned long flags"}, 0 },
+// 284 long sys_waitid ['int which', ' pid_t pid', 'struct siginfo __user *infop', 'int options', ' struct rusage __user *ru']
+{ 284, "sys_waitid", "44p4p", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int which", " pid_t pid", "struct siginfo __user *infop", "int options", " struct rusage __user *ru"}, 0 },
+// 286 long sys_add_key ['const char __user *_type', 'const char __user *_description', 'const void __user *_payload', 'size_t plen', 'key_serial_t destringid']
+{ 286, "sys_add_key", "ssp44", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"const char __user *_type", "const char __user *_description", "const void __user *_payload", "size_t plen", "key_serial_t destringid"}, 0 },
+// 287 long sys_request_key ['const char __user *_type', 'const char __user *_description', 'const char __user *_callout_info', 'key_serial_t destringid']
+{ 287, "sys_request_key", "sss4", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"const char __user *_type", "const char __user *_description", "const char __user *_callout_info", "key_serial_t destringid"}, 0 },
+// 288 long sys_keyctl ['int cmd', ' unsigned long arg2', ' unsigned long arg3', 'unsigned long arg4', ' unsigned long arg5']
+{ 288, "sys_keyctl", "44444", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int cmd", " unsigned long arg2", " unsigned long arg3", "unsigned long arg4", " unsigned long arg5"}, 0 },
+// 289 long sys_ioprio_set ['int which', ' int who', ' int ioprio']
+{ 289, "sys_ioprio_set", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int which", " int who", " int ioprio"}, 0 },
+// 290 long sys_ioprio_get ['int which', ' int who']
+{ 290, "sys_ioprio_get", "44", {3, 1}, {0xff, 0xff}, {"int which", " int who"}, 0 },
+// 291 long sys_inotify_init ['void']
+{ 291, "sys_inotify_init", "", {}, {}, {}, 0 },
+// 292 long sys_inotify_add_watch ['int fd', ' const char __user *path', 'u32 mask']
+{ 292, "sys_inotify_add_watch", "4s4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int fd", " const char __user *path", "u32 mask"}, 0 },
+// 293 long sys_inotify_rm_watch ['int fd', ' __s32 wd']
+{ 293, "sys_inotify_rm_watch", "44", {3, 1}, {0xff, 0xff}, {"int fd", " __s32 wd"}, 0 },
+// 294 long sys_migrate_pages ['pid_t pid', ' unsigned long maxnode', ' const unsigned long __user *from', ' const unsigned long __user *to']
+{ 294, "sys_migrate_pages", "44pp", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"pid_t pid", " unsigned long maxnode", " const unsigned long __user *from", " const unsigned long __user *to"}, 0 },
+// 295 long sys_openat ['int dfd', ' const char __user *filename', ' int flags', 'int mode']
+{ 295, "sys_openat", "4s44", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int dfd", " const char __user *filename", " int flags", "int mode"}, 0 },
+// 296 long sys_mkdirat ['int dfd', ' const char __user * pathname', ' int mode']
+{ 296, "sys_mkdirat", "4s4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int dfd", " const char __user * pathname", " int mode"}, 0 },
+// 297 long sys_mknodat ['int dfd', ' const char __user * filename', ' int mode', 'unsigned dev']
+{ 297, "sys_mknodat", "4s44", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int dfd", " const char __user * filename", " int mode", "unsigned dev"}, 0 },
+// 298 long sys_fchownat ['int dfd', ' const char __user *filename', ' uid_t user', 'gid_t group', ' int flag']
+{ 298, "sys_fchownat", "4s444", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int dfd", " const char __user *filename", " uid_t user", "gid_t group", " int flag"}, 0 },
+// 299 long sys_futimesat ['int dfd', ' char __user *filename', 'struct timeval __user *utimes']
+{ 299, "sys_futimesat", "4sp", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int dfd", " char __user *filename", "struct timeval __user *utimes"}, 0 },
+// 300 long sys_fstatat64 ['int dfd', ' char __user *filename', 'struct stat64 __user *statbuf', ' int flag']
+{ 300, "sys_fstatat64", "4sp4", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int dfd", " char __user *filename", "struct stat64 __user *statbuf", " int flag"}, 0 },
+// 301 long sys_unlinkat ['int dfd', ' const char __user * pathname', ' int flag']
+{ 301, "sys_unlinkat", "4s4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int dfd", " const char __user * pathname", " int flag"}, 0 },
+// 302 long sys_renameat ['int olddfd', ' const char __user * oldname', 'int newdfd', ' const char __user * newname']
+{ 302, "sys_renameat", "4s4s", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int olddfd", " const char __user * oldname", "int newdfd", " const char __user * newname"}, 0 },
+// 303 long sys_linkat ['int olddfd', ' const char __user *oldname', 'int newdfd', ' const char __user *newname', ' int flags']
+{ 303, "sys_linkat", "4s4s4", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int olddfd", " const char __user *oldname", "int newdfd", " const char __user *newname", " int flags"}, 0 },
+// 304 long sys_symlinkat ['const char __user * oldname', 'int newdfd', ' const char __user * newname']
+{ 304, "sys_symlinkat", "s4s", {3, 1, 2}, {0xff, 0xff, 0xff}, {"const char __user * oldname", "int newdfd", " const char __user * newname"}, 0 },
+// 305 long sys_readlinkat ['int dfd', ' const char __user *path', ' char __user *buf', 'int bufsiz']
+{ 305, "sys_readlinkat", "4sp4", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int dfd", " const char __user *path", " char __user *buf", "int bufsiz"}, 0 },
+// 306 long sys_fchmodat ['int dfd', ' const char __user * filename', 'mode_t mode']
+{ 306, "sys_fchmodat", "4s4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int dfd", " const char __user * filename", "mode_t mode"}, 0 },
+// 307 long sys_faccessat ['int dfd', ' const char __user *filename', ' int mode']
+{ 307, "sys_faccessat", "4s4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int dfd", " const char __user *filename", " int mode"}, 0 },
+// 308 long sys_pselect6 ['int n', ' fd_set __user *inp', ' fd_set __user *outp', ' fd_set __user *exp', ' struct timespec __user *tsp', ' void __user *sig']
+{ 308, "sys_pselect6", "4ppppp", {3, 1, 2, 6, 7, 5}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"int n", " fd_set __user *inp", " fd_set __user *outp", " fd_set __user *exp", " struct timespec __user *tsp", " void __user *sig"}, 0 },
+// 309 long sys_ppoll ['struct pollfd __user *ufds', ' unsigned int nfds', ' struct timespec __user *tsp', ' const sigset_t __user *sigmask', ' size_t sigsetsize']
+{ 309, "sys_ppoll", "p4pp4", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"struct pollfd __user *ufds", " unsigned int nfds", " struct timespec __user *tsp", " const sigset_t __user *sigmask", " size_t sigsetsize"}, 0 },
+// 310 long sys_unshare ['unsigned long unshare_flags']
+{ 310, "sys_unshare", "4", {3}, {0xff}, {"unsigned long unshare_flags"}, 0 },
+// 311 long sys_set_robust_list ['struct robust_list_head __user *head', 'size_t len']
+{ 311, "sys_set_robust_list", "p4", {3, 1}, {0xff, 0xff}, {"struct robust_list_head __user *head", "size_t len"}, 0 },
+// 312 long sys_get_robust_list ['int pid', 'struct robust_list_head __user * __user *head_ptr', 'size_t __user *len_ptr']
+{ 312, "sys_get_robust_list", "4pp", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int pid", "struct robust_list_head __user * __user *head_ptr", "size_t __user *len_ptr"}, 0 },
+// 313 long sys_splice ['int fd_in', ' loff_t __user *off_in', 'int fd_out', ' loff_t __user *off_out', 'size_t len', ' unsigned int flags']
+{ 313, "sys_splice", "4p4p44", {3, 1, 2, 6, 7, 5}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"int fd_in", " loff_t __user *off_in", "int fd_out", " loff_t __user *off_out", "size_t len", " unsigned int flags"}, 0 },
+// 314 long sys_sync_file_range ['int fd', ' loff_t offset', ' loff_t nbytes', ' unsigned int flags']
+{ 314, "sys_sync_file_range", "4884", {3, 1, 6, 5}, {0xff, 2, 7, 0xff}, {"int fd", " loff_t offset", " loff_t nbytes", " unsigned int flags"}, 0 },
+// 315 long sys_tee ['int fdin', ' int fdout', ' size_t len', ' unsigned int flags']
+{ 315, "sys_tee", "4444", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int fdin", " int fdout", " size_t len", " unsigned int flags"}, 0 },
+// 316 long sys_vmsplice ['int fd', ' const struct iovec __user *iov', 'unsigned long nr_segs', ' unsigned int flags']
+{ 316, "sys_vmsplice", "4p44", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int fd", " const struct iovec __user *iov", "unsigned long nr_segs", " unsigned int flags"}, 0 },
+// 317 long sys_move_pages ['pid_t pid', ' unsigned long nr_pages', 'const void __user * __user *pages', 'const int __user *nodes', 'int __user *status', 'int flags']
+{ 317, "sys_move_pages", "44ppp4", {3, 1, 2, 6, 7, 5}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"pid_t pid", " unsigned long nr_pages", "const void __user * __user *pages", "const int __user *nodes", "int __user *status", "int flags"}, 0 },
+// 318 long sys_getcpu ['unsigned __user *cpu', ' unsigned __user *node', ' struct getcpu_cache __user *cache']
+{ 318, "sys_getcpu", "ppp", {3, 1, 2}, {0xff, 0xff, 0xff}, {"unsigned __user *cpu", " unsigned __user *node", " struct getcpu_cache __user *cache"}, 0 },
+// 319 long sys_epoll_pwait ['int epfd', ' struct epoll_event __user *events', ' int maxevents', ' int timeout', ' const sigset_t __user *sigmask', ' size_t sigsetsize']
+{ 319, "sys_epoll_pwait", "4p44p4", {3, 1, 2, 6, 7, 5}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"int epfd", " struct epoll_event __user *events", " int maxevents", " int timeout", " const sigset_t __user *sigmask", " size_t sigsetsize"}, 0 },
+// 320 long sys_utimensat ['int dfd', ' char __user *filename', 'struct timespec __user *utimes', ' int flags']
+{ 320, "sys_utimensat", "4sp4", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int dfd", " char __user *filename", "struct timespec __user *utimes", " int flags"}, 0 },
+// 321 long sys_signalfd ['int ufd', ' sigset_t __user *user_mask', ' size_t sizemask']
+{ 321, "sys_signalfd", "4p4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int ufd", " sigset_t __user *user_mask", " size_t sizemask"}, 0 },
+// 322 long sys_timerfd_create ['int clockid', ' int flags']
+{ 322, "sys_timerfd_create", "44", {3, 1}, {0xff, 0xff}, {"int clockid", " int flags"}, 0 },
+// 323 long sys_eventfd ['unsigned int count']
+{ 323, "sys_eventfd", "4", {3}, {0xff}, {"unsigned int count"}, 0 },
+// 324 long sys_fallocate ['int fd', ' int mode', ' loff_t offset', ' loff_t len']
+{ 324, "sys_fallocate", "4488", {3, 1, 2, 7}, {0xff, 0xff, 6, 5}, {"int fd", " int mode", " loff_t offset", " loff_t len"}, 0 },
+// 325 long sys_timerfd_settime ['int ufd', ' int flags', 'const struct itimerspec __user *utmr', 'struct itimerspec __user *otmr']
+{ 325, "sys_timerfd_settime", "44pp", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int ufd", " int flags", "const struct itimerspec __user *utmr", "struct itimerspec __user *otmr"}, 0 },
+// 326 long sys_timerfd_gettime ['int ufd', ' struct itimerspec __user *otmr']
+{ 326, "sys_timerfd_gettime", "4p", {3, 1}, {0xff, 0xff}, {"int ufd", " struct itimerspec __user *otmr"}, 0 },
+// 327 long sys_signalfd4 ['int ufd', ' sigset_t __user *user_mask', ' size_t sizemask', ' int flags']
+{ 327, "sys_signalfd4", "4p44", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int ufd", " sigset_t __user *user_mask", " size_t sizemask", " int flags"}, 0 },
+// 328 long sys_eventfd2 ['unsigned int count', ' int flags']
+{ 328, "sys_eventfd2", "44", {3, 1}, {0xff, 0xff}, {"unsigned int count", " int flags"}, 0 },
+// 329 long sys_epoll_create1 ['int flags']
+{ 329, "sys_epoll_create1", "4", {3}, {0xff}, {"int flags"}, 0 },
+// 330 long sys_dup3 ['unsigned int oldfd', ' unsigned int newfd', ' int flags']
+{ 330, "sys_dup3", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"unsigned int oldfd", " unsigned int newfd", " int flags"}, 0 },
+// 331 long sys_pipe2 ['int __user *', ' int']
+{ 331, "sys_pipe2", "p4", {3, 1}, {0xff, 0xff}, {"int __user *", " int"}, 0 },
+// 332 long sys_inotify_init1 ['int flags']
+{ 332, "sys_inotify_init1", "4", {3}, {0xff}, {"int flags"}, 0 },
+// 333 long sys_preadv ['unsigned long fd', ' const struct iovec __user *vec', ' unsigned long vlen', ' unsigned long pos_l', ' unsigned long pos_h']
+{ 333, "sys_preadv", "4p444", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"unsigned long fd", " const struct iovec __user *vec", " unsigned long vlen", " unsigned long pos_l", " unsigned long pos_h"}, 0 },
+// 334 long sys_pwritev ['unsigned long fd', ' const struct iovec __user *vec', ' unsigned long vlen', ' unsigned long pos_l', ' unsigned long pos_h']
+{ 334, "sys_pwritev", "4p444", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"unsigned long fd", " const struct iovec __user *vec", " unsigned long vlen", " unsigned long pos_l", " unsigned long pos_h"}, 0 },
+// 335 long sys_rt_tgsigqueueinfo ['pid_t tgid', ' pid_t pid', ' int sig', ' siginfo_t __user *uinfo']
+{ 335, "sys_rt_tgsigqueueinfo", "444p", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"pid_t tgid", " pid_t pid", " int sig", " siginfo_t __user *uinfo"}, 0 },
+// 336 long sys_perf_event_open ['struct perf_event_attr __user *attr_uptr', ' pid_t pid', ' int cpu', ' int group_fd', ' unsigned long flags']
+{ 336, "sys_perf_event_open", "p4444", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"struct perf_event_attr __user *attr_uptr", " pid_t pid", " int cpu", " int group_fd", " unsigned long flags"}, 0 },
+// 337 long sys_recvmmsg ['int fd', ' struct mmsghdr __user *msg', ' unsigned int vlen', ' unsigned flags', ' struct timespec __user *timeout']
+{ 337, "sys_recvmmsg", "4p44p", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int fd", " struct mmsghdr __user *msg", " unsigned int vlen", " unsigned flags", " struct timespec __user *timeout"}, 0 },
+// 338 long sys_fanotify_init ['unsigned int flags', ' unsigned int event_f_flags']
+{ 338, "sys_fanotify_init", "44", {3, 1}, {0xff, 0xff}, {"unsigned int flags", " unsigned int event_f_flags"}, 0 },
+// 339 long sys_fanotify_mark ['int fanotify_fd', ' unsigned int flags', ' u64 mask', ' int fd', ' const char __user *pathname']
+{ 339, "sys_fanotify_mark", "4484s", {3, 1, 2, 7, 5}, {0xff, 0xff, 6, 0xff, 0xff}, {"int fanotify_fd", " unsigned int flags", " u64 mask", " int fd", " const char __user *pathname"}, 0 },
+// 340 long sys_prlimit64 ['pid_t pid', ' unsigned int resource', ' const struct rlimit64 __user *new_rlim', ' struct rlimit64 __user *old_rlim']
+{ 340, "sys_prlimit64", "44pp", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"pid_t pid", " unsigned int resource", " const struct rlimit64 __user *new_rlim", " struct rlimit64 __user *old_rlim"}, 0 },
+// 341 long sys_name_to_handle_at ['int dfd', ' const char __user *name', ' struct file_handle __user *handle', ' int __user *mnt_id', ' int flag']
+{ 341, "sys_name_to_handle_at", "4spp4", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int dfd", " const char __user *name", " struct file_handle __user *handle", " int __user *mnt_id", " int flag"}, 0 },
+// 342 long sys_open_by_handle_at ['int mountdirfd', ' struct file_handle __user *handle', ' int flags']
+{ 342, "sys_open_by_handle_at", "4p4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int mountdirfd", " struct file_handle __user *handle", " int flags"}, 0 },
+// 343 long sys_clock_adjtime ['clockid_t which_clock', ' struct timex __user *tx']
+{ 343, "sys_clock_adjtime", "4p", {3, 1}, {0xff, 0xff}, {"clockid_t which_clock", " struct timex __user *tx"}, 0 },
+// 344 long sys_syncfs ['int fd']
+{ 344, "sys_syncfs", "4", {3}, {0xff}, {"int fd"}, 0 },
+// 345 long sys_sendmmsg ['int fd', ' struct mmsghdr __user *msg', ' unsigned int vlen', ' unsigned flags']
+{ 345, "sys_sendmmsg", "4p44", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int fd", " struct mmsghdr __user *msg", " unsigned int vlen", " unsigned flags"}, 0 },
+// 346 long sys_setns ['int fd', ' int nstype']
+{ 346, "sys_setns", "44", {3, 1}, {0xff, 0xff}, {"int fd", " int nstype"}, 0 },
+// 347 long sys_process_vm_readv ['pid_t pid', ' const struct iovec __user *lvec', ' unsigned long liovcnt', ' const struct iovec __user *rvec', ' unsigned long riovcnt', ' unsigned long flags']
+{ 347, "sys_process_vm_readv", "4p4p44", {3, 1, 2, 6, 7, 5}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"pid_t pid", " const struct iovec __user *lvec", " unsigned long liovcnt", " const struct iovec __user *rvec", " unsigned long riovcnt", " unsigned long flags"}, 0 },
+// 348 long sys_process_vm_writev ['pid_t pid', ' const struct iovec __user *lvec', ' unsigned long liovcnt', ' const struct iovec __user *rvec', ' unsigned long riovcnt', ' unsigned long flags']
+{ 348, "sys_process_vm_writev", "4p4p44", {3, 1, 2, 6, 7, 5}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"pid_t pid", " const struct iovec __user *lvec", " unsigned long liovcnt", " const struct iovec __user *rvec", " unsigned long riovcnt", " unsigned long flags"}, 0 },
+// 349 long sys_kcmp ['pid_t pid1', ' pid_t pid2', ' int type', ' unsigned long idx1', ' unsigned long idx2']
+{ 349, "sys_kcmp", "44444", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"pid_t pid1", " pid_t pid2", " int type", " unsigned long idx1", " unsigned long idx2"}, 0 },
+// 350 long sys_finit_module ['int fd', ' const char __user *uargs', ' int flags']
+{ 350, "sys_finit_module", "4s4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int fd", " const char __user *uargs", " int flags"}, 0 },
+// 351 long sys_sched_setattr ['pid_t pid', ' struct sched_attr __user *attr', ' unsigned int flags']
+{ 351, "sys_sched_setattr", "4p4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"pid_t pid", " struct sched_attr __user *attr", " unsigned int flags"}, 0 },
+// 352 long sys_sched_getattr ['pid_t pid', ' struct sched_attr __user *attr', ' unsigned int size', ' unsigned int flags']
+{ 352, "sys_sched_getattr", "4p44", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"pid_t pid", " struct sched_attr __user *attr", " unsigned int size", " unsigned int flags"}, 0 },
+// 353 long sys_renameat2 ['int olddfd', ' const char __user *oldname', ' int newdfd', ' const char __user *newname', ' unsigned int flags']
+{ 353, "sys_renameat2", "4s4s4", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int olddfd", " const char __user *oldname", " int newdfd", " const char __user *newname", " unsigned int flags"}, 0 },
+// 354 long sys_seccomp ['unsigned int op', ' unsigned int flags', ' void __user *uargs']
+{ 354, "sys_seccomp", "44p", {3, 1, 2}, {0xff, 0xff, 0xff}, {"unsigned int op", " unsigned int flags", " void __user *uargs"}, 0 },
+// 355 long sys_getrandom ['char __user *buf', ' size_t count', ' unsigned int flags']
+{ 355, "sys_getrandom", "p44", {3, 1, 2}, {0xff, 0xff, 0xff}, {"char __user *buf", " size_t count", " unsigned int flags"}, 0 },
+// 356 long sys_memfd_create ['const char __user *uname_ptr', ' unsigned int flags']
+{ 356, "sys_memfd_create", "s4", {3, 1}, {0xff, 0xff}, {"const char __user *uname_ptr", " unsigned int flags"}, 0 },
+// 357 long sys_bpf ['int cmd', ' union bpf_attr __user *attr', ' unsigned int size']
+{ 357, "sys_bpf", "4p4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int cmd", " union bpf_attr __user *attr", " unsigned int size"}, 0 },
+// 358 long sys_execveat ['int dfd', ' const char __user *filename', ' char *const argv[]', ' char *const envp[]', ' int flags']
+{ 358, "sys_execveat", "4spp4", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int dfd", " const char __user *filename", " char *const argv[]", " char *const envp[]", " int flags"}, 0 },
+// 359 long sys_socket ['int', ' int', ' int']
+{ 359, "sys_socket", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int", " int", " int"}, 0 },
+// 360 long sys_socketpair ['int', ' int', ' int', ' int __user *']
+{ 360, "sys_socketpair", "444p", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int", " int", " int", " int __user *"}, 0 },
+// 361 long sys_bind ['int', ' struct sockaddr __user *', ' int']
+{ 361, "sys_bind", "4p4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int", " struct sockaddr __user *", " int"}, 0 },
+// 362 long sys_connect ['int', ' struct sockaddr __user *', ' int']
+{ 362, "sys_connect", "4p4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int", " struct sockaddr __user *", " int"}, 0 },
+// 363 long sys_listen ['int', ' int']
+{ 363, "sys_listen", "44", {3, 1}, {0xff, 0xff}, {"int", " int"}, 0 },
+// 364 long sys_accept4 ['int fd', ' struct sockaddr __user *upeer_sockaddr', ' int __user *upeer_addrlen', ' int flags']
+{ 364, "sys_accept4", "4pp4", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int fd", " struct sockaddr __user *upeer_sockaddr", " int __user *upeer_addrlen", " int flags"}, 0 },
+// 365 long sys_getsockopt ['int fd', ' int level', ' int optname', 'char __user *optval', ' int __user *optlen']
+{ 365, "sys_getsockopt", "444sp", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int fd", " int level", " int optname", "char __user *optval", " int __user *optlen"}, 0 },
+// 366 long sys_setsockopt ['int fd', ' int level', ' int optname', 'char __user *optval', ' int optlen']
+{ 366, "sys_setsockopt", "444s4", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int fd", " int level", " int optname", "char __user *optval", " int optlen"}, 0 },
+// 367 long sys_getsockname ['int', ' struct sockaddr __user *', ' int __user *']
+{ 367, "sys_getsockname", "4pp", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int", " struct sockaddr __user *", " int __user *"}, 0 },
+// 368 long sys_getpeername ['int', ' struct sockaddr __user *', ' int __user *']
+{ 368, "sys_getpeername", "4pp", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int", " struct sockaddr __user *", " int __user *"}, 0 },
+// 369 long sys_sendto ['int', ' void __user *', ' size_t', ' unsigned', 'struct sockaddr __user *', ' int']
+{ 369, "sys_sendto", "4p44p4", {3, 1, 2, 6, 7, 5}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"int", " void __user *", " size_t", " unsigned", "struct sockaddr __user *", " int"}, 0 },
+// 370 long sys_sendmsg ['int fd', ' struct msghdr __user *msg', ' unsigned flags']
+{ 370, "sys_sendmsg", "4p4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int fd", " struct msghdr __user *msg", " unsigned flags"}, 0 },
+// 371 long sys_recvfrom ['int', ' void __user *', ' size_t', ' unsigned', 'struct sockaddr __user *', ' int __user *']
+{ 371, "sys_recvfrom", "4p44pp", {3, 1, 2, 6, 7, 5}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"int", " void __user *", " size_t", " unsigned", "struct sockaddr __user *", " int __user *"}, 0 },
+// 372 long sys_recvmsg ['int fd', ' struct msghdr __user *msg', ' unsigned flags']
+{ 372, "sys_recvmsg", "4p4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int fd", " struct msghdr __user *msg", " unsigned flags"}, 0 },
+// 373 long sys_shutdown ['int', ' int']
+{ 373, "sys_shutdown", "44", {3, 1}, {0xff, 0xff}, {"int", " int"}, 0 },
+// 374 long sys_userfaultfd ['int flags']
+{ 374, "sys_userfaultfd", "4", {3}, {0xff}, {"int flags"}, 0 },
+// 375 long sys_membarrier ['int cmd', ' int flags']
+{ 375, "sys_membarrier", "44", {3, 1}, {0xff, 0xff}, {"int cmd", " int flags"}, 0 },
+// 376 long sys_mlock2 ['unsigned long start', ' size_t len', ' int flags']
+{ 376, "sys_mlock2", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"unsigned long start", " size_t len", " int flags"}, 0 },
+// 377 long sys_copy_file_range ['int fd_in', ' loff_t __user *off_in', ' int fd_out', ' loff_t __user *off_out', ' size_t len', ' unsigned int flags']
+{ 377, "sys_copy_file_range", "4p4p44", {3, 1, 2, 6, 7, 5}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"int fd_in", " loff_t __user *off_in", " int fd_out", " loff_t __user *off_out", " size_t len", " unsigned int flags"}, 0 },
+// 378 long sys_preadv2 ['unsigned long fd', ' const struct iovec __user *vec', ' unsigned long vlen', ' unsigned long pos_l', ' unsigned long pos_h', ' int flags']
+{ 378, "sys_preadv2", "4p4444", {3, 1, 2, 6, 7, 5}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"unsigned long fd", " const struct iovec __user *vec", " unsigned long vlen", " unsigned long pos_l", " unsigned long pos_h", " int flags"}, 0 },
+// 379 long sys_pwritev2 ['unsigned long fd', ' const struct iovec __user *vec', ' unsigned long vlen', ' unsigned long pos_l', ' unsigned long pos_h', ' int flags']
+{ 379, "sys_pwritev2", "4p4444", {3, 1, 2, 6, 7, 5}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"unsigned long fd", " const struct iovec __user *vec", " unsigned long vlen", " unsigned long pos_l", " unsigned long pos_h", " int flags"}, 0 },
+// 380 long sys_pkey_mprotect ['unsigned long start', ' size_t len', ' unsigned long prot', ' int pkey']
+{ 380, "sys_pkey_mprotect", "4444", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"unsigned long start", " size_t len", " unsigned long prot", " int pkey"}, 0 },
+// 381 long sys_pkey_alloc ['unsigned long flags', ' unsigned long init_val']
+{ 381, "sys_pkey_alloc", "44", {3, 1}, {0xff, 0xff}, {"unsigned long flags", " unsigned long init_val"}, 0 },
+// 382 long sys_pkey_free ['int pkey']
+{ 382, "sys_pkey_free", "4", {3}, {0xff}, {"int pkey"}, 0 },
+// 383 long sys_statx ['int dfd', ' const char __user *path', ' unsigned flags', ' unsigned mask', ' struct statx __user *buffer']
+{ 383, "sys_statx", "4s44p", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int dfd", " const char __user *path", " unsigned flags", " unsigned mask", " struct statx __user *buffer"}, 0 },
+// 384 long sys_arch_prctl ['int code', ' unsigned long addr']
+{ 384, "sys_arch_prctl", "44", {3, 1}, {0xff, 0xff}, {"int code", " unsigned long addr"}, 0 },
+// 385 long sys_io_pgetevents ['']
+{ 385, "sys_io_pgetevents", "", {}, {}, {}, 0 },
+// 386 long sys_rseq ['struct rseq __user *rseq', ' u32 rseq_len', ' int flags', ' u32 sig']
+{ 386, "sys_rseq", "p444", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"struct rseq __user *rseq", " u32 rseq_len", " int flags", " u32 sig"}, 0 },
+// 393 long sys_semget ['key_t key', ' int nsems', ' int semflg']
+{ 393, "sys_semget", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"key_t key", " int nsems", " int semflg"}, 0 },
+// 394 long sys_semctl ['int semid', ' int semnum', ' int cmd', ' union semun arg']
+{ 394, "sys_semctl", "4444", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int semid", " int semnum", " int cmd", " union semun arg"}, 0 },
+// 395 long sys_shmget ['key_t key', ' size_t size', ' int flag']
+{ 395, "sys_shmget", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"key_t key", " size_t size", " int flag"}, 0 },
+// 396 long sys_shmctl ['int shmid', ' int cmd', ' struct shmid_ds __user *buf']
+{ 396, "sys_shmctl", "44p", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int shmid", " int cmd", " struct shmid_ds __user *buf"}, 0 },
+// 397 long sys_shmat ['int shmid', ' char __user *shmaddr', ' int shmflg']
+{ 397, "sys_shmat", "4s4", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int shmid", " char __user *shmaddr", " int shmflg"}, 0 },
+// 398 long sys_shmdt ['char __user *shmaddr']
+{ 398, "sys_shmdt", "s", {3}, {0xff}, {"char __user *shmaddr"}, 0 },
+// 399 long sys_msgget ['key_t key', ' int msgflg']
+{ 399, "sys_msgget", "44", {3, 1}, {0xff, 0xff}, {"key_t key", " int msgflg"}, 0 },
+// 400 long sys_msgsnd ['int msqid', ' struct msgbuf __user *msgp', 'size_t msgsz', ' int msgflg']
+{ 400, "sys_msgsnd", "4p44", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int msqid", " struct msgbuf __user *msgp", "size_t msgsz", " int msgflg"}, 0 },
+// 401 long sys_msgrcv ['int msqid', ' struct msgbuf __user *msgp', 'size_t msgsz', ' long msgtyp', ' int msgflg']
+{ 401, "sys_msgrcv", "4p444", {3, 1, 2, 6, 7}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int msqid", " struct msgbuf __user *msgp", "size_t msgsz", " long msgtyp", " int msgflg"}, 0 },
+// 402 long sys_msgctl ['int msqid', ' int cmd', ' struct msqid_ds __user *buf']
+{ 402, "sys_msgctl", "44p", {3, 1, 2}, {0xff, 0xff, 0xff}, {"int msqid", " int cmd", " struct msqid_ds __user *buf"}, 0 },
+// 403 long sys_clock_gettime64 ['']
+{ 403, "sys_clock_gettime64", "", {}, {}, {}, 0 },
+// 404 long sys_clock_settime64 ['']
+{ 404, "sys_clock_settime64", "", {}, {}, {}, 0 },
+// 405 long sys_clock_adjtime64 ['']
+{ 405, "sys_clock_adjtime64", "", {}, {}, {}, 0 },
+// 406 long sys_clock_getres_time64 ['']
+{ 406, "sys_clock_getres_time64", "", {}, {}, {}, 0 },
+// 407 long sys_clock_nanosleep_time64 ['']
+{ 407, "sys_clock_nanosleep_time64", "", {}, {}, {}, 0 },
+// 408 long sys_timer_gettime64 ['']
+{ 408, "sys_timer_gettime64", "", {}, {}, {}, 0 },
+// 409 long sys_timer_settime64 ['']
+{ 409, "sys_timer_settime64", "", {}, {}, {}, 0 },
+// 410 long sys_timerfd_gettime64 ['']
+{ 410, "sys_timerfd_gettime64", "", {}, {}, {}, 0 },
+// 411 long sys_timerfd_settime64 ['']
+{ 411, "sys_timerfd_settime64", "", {}, {}, {}, 0 },
+// 412 long sys_utimensat_time64 ['']
+{ 412, "sys_utimensat_time64", "", {}, {}, {}, 0 },
+// 413 long sys_pselect6_time64 ['']
+{ 413, "sys_pselect6_time64", "", {}, {}, {}, 0 },
+// 414 long sys_ppoll_time64 ['']
+{ 414, "sys_ppoll_time64", "", {}, {}, {}, 0 },
+// 416 long sys_io_pgetevents_time64 ['']
+{ 416, "sys_io_pgetevents_time64", "", {}, {}, {}, 0 },
+// 417 long sys_recvmmsg_time64 ['']
+{ 417, "sys_recvmmsg_time64", "", {}, {}, {}, 0 },
+// 418 long sys_mq_timedsend_time64 ['']
+{ 418, "sys_mq_timedsend_time64", "", {}, {}, {}, 0 },
+// 419 long sys_mq_timedreceive_time64 ['']
+{ 419, "sys_mq_timedreceive_time64", "", {}, {}, {}, 0 },
+// 420 long sys_semtimedop_time64 ['']
+{ 420, "sys_semtimedop_time64", "", {}, {}, {}, 0 },
+// 421 long sys_rt_sigtimedwait_time64 ['']
+{ 421, "sys_rt_sigtimedwait_time64", "", {}, {}, {}, 0 },
+// 422 long sys_futex_time64 ['']
+{ 422, "sys_futex_time64", "", {}, {}, {}, 0 },
+// 423 long sys_sched_rr_get_interval_time64 ['']
+{ 423, "sys_sched_rr_get_interval_time64", "", {}, {}, {}, 0 },
+// 424 long sys_pidfd_send_signal ['int pidfd', ' int sig', ' siginfo_t __user *info', ' unsigned int flags']
+{ 424, "sys_pidfd_send_signal", "44p4", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int pidfd", " int sig", " siginfo_t __user *info", " unsigned int flags"}, 0 },
+// 425 long sys_io_uring_setup ['']
+{ 425, "sys_io_uring_setup", "", {}, {}, {}, 0 },
+// 426 long sys_io_uring_enter ['']
+{ 426, "sys_io_uring_enter", "", {}, {}, {}, 0 },
+// 427 long sys_io_uring_register ['']
+{ 427, "sys_io_uring_register", "", {}, {}, {}, 0 },
+// 428 long sys_open_tree ['']
+{ 428, "sys_open_tree", "", {}, {}, {}, 0 },
+// 429 long sys_move_mount ['']
+{ 429, "sys_move_mount", "", {}, {}, {}, 0 },
+// 430 long sys_fsopen ['']
+{ 430, "sys_fsopen", "", {}, {}, {}, 0 },
+// 431 long sys_fsconfig ['']
+{ 431, "sys_fsconfig", "", {}, {}, {}, 0 },
+// 432 long sys_fsmount ['']
+{ 432, "sys_fsmount", "", {}, {}, {}, 0 },
+// 433 long sys_fspick ['']
+{ 433, "sys_fspick", "", {}, {}, {}, 0 },
+// 434 long sys_pidfd_open ['pid_t pid', ' unsigned int flags']
+{ 434, "sys_pidfd_open", "44", {3, 1}, {0xff, 0xff}, {"pid_t pid", " unsigned int flags"}, 0 },
+// 435 long sys_clone3 ['struct clone_args __user *uargs', ' size_t size']
+{ 435, "sys_clone3", "p4", {3, 1}, {0xff, 0xff}, {"struct clone_args __user *uargs", " size_t size"}, 0 },
+// 436 long sys_close_range ['unsigned int fd', ' unsigned int max_fd', ' unsigned int flags']
+{ 436, "sys_close_range", "444", {3, 1, 2}, {0xff, 0xff, 0xff}, {"unsigned int fd", " unsigned int max_fd", " unsigned int flags"}, 0 },
+// 437 long sys_openat2 ['int dfd', ' const char __user *filename', ' struct open_how __user *how', ' size_t size']
+{ 437, "sys_openat2", "4sp4", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int dfd", " const char __user *filename", " struct open_how __user *how", " size_t size"}, 0 },
+// 438 long sys_pidfd_getfd ['']
+{ 438, "sys_pidfd_getfd", "", {}, {}, {}, 0 },
+// 439 long sys_faccessat2 ['int dfd', ' const char __user *filename', ' int mode', ' int flags']
+{ 439, "sys_faccessat2", "4s44", {3, 1, 2, 6}, {0xff, 0xff, 0xff, 0xff}, {"int dfd", " const char __user *filename", " int mode", " int flags"}, 0 },
+// 440 long sys_process_madvise ['']
+{ 440, "sys_process_madvise", "", {}, {}, {}, 0 },
+// 441 long sys_epoll_pwait2 ['']
+{ 441, "sys_epoll_pwait2", "", {}, {}, {}, 0 },
+// 442 long sys_mount_setattr ['']
+{ 442, "sys_mount_setattr", "", {}, {}, {}, 0 },
+// 443 long sys_quotactl_fd ['']
+{ 443, "sys_quotactl_fd", "", {}, {}, {}, 0 },
+// 444 long sys_landlock_create_ruleset ['']
+{ 444, "sys_landlock_create_ruleset", "", {}, {}, {}, 0 },
+// 445 long sys_landlock_add_rule ['']
+{ 445, "sys_landlock_add_rule", "", {}, {}, {}, 0 },
+// 446 long sys_landlock_restrict_self ['']
+{ 446, "sys_landlock_restrict_self", "", {}, {}, {}, 0 },
+// 447 long sys_memfd_secret ['']
+{ 447, "sys_memfd_secret", "", {}, {}, {}, 0 },
+// 448 long sys_process_mrelease ['']
+{ 448, "sys_process_mrelease", "", {}, {}, {}, 0 },
+// 449 long sys_futex_waitv ['']
+{ 449, "sys_futex_waitv", "", {}, {}, {}, 0 },
+// 450 long sys_set_mempolicy_home_node ['']
+{ 450, "sys_set_mempolicy_home_node", "", {}, {}, {}, 0 },
+};
@@ -0,0 +1,716 @@
+/* PANDABEGINCOMMENT
+ * 
+ * Authors:
+ *  Tim Leek               tleek@ll.mit.edu
+ *  Ryan Whelan            rwhelan@ll.mit.edu
+ *  Joshua Hodosh          josh.hodosh@ll.mit.edu
+ *  Michael Zhivich        mzhivich@ll.mit.edu
+ *  Brendan Dolan-Gavitt   brendandg@gatech.edu
+ * 
+ * This work is licensed under the terms of the GNU GPL, version 2. 
+ * See the COPYING file in the top-level directory. 
+ * 
+PANDAENDCOMMENT */
+// Generated by android_syscall_parser.py from linux_x86_64_prototypes.txt
+static const syscall_prototype syscall_prototypes_x86_64[] = {
+// 0 long sys_read ['unsigned int fd', ' char __user *buf', ' size_t count']
+{ 0, "sys_read", "4p4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"unsigned int fd", " char __user *buf", " size_t count"}, 0 },
+// 1 long sys_write ['unsigned int fd', ' const char __user *buf', 'size_t count']
+{ 1, "sys_write", "4p4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"unsigned int fd", " const char __user *buf", "size_t count"}, 0 },
+// 2 long sys_open ['const char __user *filename', 'int flags', ' int mode']
+{ 2, "sys_open", "s44", {7, 6, 2}, {0xff, 0xff, 0xff}, {"const char __user *filename", "int flags", " int mode"}, 0 },
+// 3 long sys_close ['unsigned int fd']
+{ 3, "sys_close", "4", {7}, {0xff}, {"unsigned int fd"}, 0 },
+// 4 long sys_newstat ['char __user *filename', 'struct stat __user *statbuf']
+{ 4, "sys_newstat", "sp", {7, 6}, {0xff, 0xff}, {"char __user *filename", "struct stat __user *statbuf"}, 0 },
+// 5 long sys_newfstat ['unsigned int fd', ' struct stat __user *statbuf']
+{ 5, "sys_newfstat", "4p", {7, 6}, {0xff, 0xff}, {"unsigned int fd", " struct stat __user *statbuf"}, 0 },
+// 6 long sys_newlstat ['char __user *filename', 'struct stat __user *statbuf']
+{ 6, "sys_newlstat", "sp", {7, 6}, {0xff, 0xff}, {"char __user *filename", "struct stat __user *statbuf"}, 0 },
+// 7 long sys_poll ['struct pollfd __user *ufds', ' unsigned int nfds', 'long timeout']
+{ 7, "sys_poll", "p44", {7, 6, 2}, {0xff, 0xff, 0xff}, {"struct pollfd __user *ufds", " unsigned int nfds", "long timeout"}, 0 },
+// 8 long sys_lseek ['unsigned int fd', ' off_t offset', 'unsigned int origin']
+{ 8, "sys_lseek", "444", {7, 6, 2}, {0xff, 0xff, 0xff}, {"unsigned int fd", " off_t offset", "unsigned int origin"}, 0 },
+// 9 long sys_mmap ['unsigned long addr', ' unsigned long len', ' unsigned long prot', ' unsigned long flags', ' unsigned long fd', ' unsigned long off']
+{ 9, "sys_mmap", "444444", {7, 6, 2, 10, 8, 9}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"unsigned long addr", " unsigned long len", " unsigned long prot", " unsigned long flags", " unsigned long fd", " unsigned long off"}, 0 },
+// 10 long sys_mprotect ['unsigned long start', ' size_t len', 'unsigned long prot']
+{ 10, "sys_mprotect", "444", {7, 6, 2}, {0xff, 0xff, 0xff}, {"unsigned long start", " size_t len", "unsigned long prot"}, 0 },
+// 11 long sys_munmap ['unsigned long addr', ' size_t len']
+{ 11, "sys_munmap", "44", {7, 6}, {0xff, 0xff}, {"unsigned long addr", " size_t len"}, 0 },
+// 12 long sys_brk ['unsigned long brk']
+{ 12, "sys_brk", "4", {7}, {0xff}, {"unsigned long brk"}, 0 },
+// 13 long rt_sigaction ['int sig', ' const struct sigaction __user * act', ' struct sigaction __user * oact', '  size_t sigsetsize']
+{ 13, "rt_sigaction", "4pp4", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int sig", " const struct sigaction __user * act", " struct sigaction __user * oact", "  size_t sigsetsize"}, 0 },
+// 14 long sys_rt_sigprocmask ['int how', ' sigset_t __user *set', 'sigset_t __user *oset', ' size_t sigsetsize']
+{ 14, "sys_rt_sigprocmask", "4pp4", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int how", " sigset_t __user *set", "sigset_t __user *oset", " size_t sigsetsize"}, 0 },
+// 15 long sys_rt_sigreturn ['void']
+{ 15, "sys_rt_sigreturn", "", {}, {}, {}, 0 },
+// 16 long sys_ioctl ['unsigned int fd', ' unsigned int cmd', 'unsigned long arg']
+{ 16, "sys_ioctl", "444", {7, 6, 2}, {0xff, 0xff, 0xff}, {"unsigned int fd", " unsigned int cmd", "unsigned long arg"}, 0 },
+// 17 long sys_pread64 ['unsigned int fd', ' char __user *buf', 'size_t count', ' loff_t pos']
+{ 17, "sys_pread64", "4p48", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"unsigned int fd", " char __user *buf", "size_t count", " loff_t pos"}, 0 },
+// 18 long sys_pwrite64 ['unsigned int fd', ' const char __user *buf', 'size_t count', ' loff_t pos']
+{ 18, "sys_pwrite64", "4p48", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"unsigned int fd", " const char __user *buf", "size_t count", " loff_t pos"}, 0 },
+// 19 long sys_readv ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen']
+{ 19, "sys_readv", "4p4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"unsigned long fd", "const struct iovec __user *vec", "unsigned long vlen"}, 0 },
+// 20 long sys_writev ['unsigned long fd', 'const struct iovec __user *vec', 'unsigned long vlen']
+{ 20, "sys_writev", "4p4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"unsigned long fd", "const struct iovec __user *vec", "unsigned long vlen"}, 0 },
+// 21 long sys_access ['const char __user *filename', ' int mode']
+{ 21, "sys_access", "s4", {7, 6}, {0xff, 0xff}, {"const char __user *filename", " int mode"}, 0 },
+// 22 long sys_pipe ['int __user *']
+{ 22, "sys_pipe", "p", {7}, {0xff}, {"int __user *"}, 0 },
+// 23 long sys_select ['int n', ' fd_set __user *inp', ' fd_set __user *outp', 'fd_set __user *exp', ' struct timeval __user *tvp']
+{ 23, "sys_select", "4pppp", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int n", " fd_set __user *inp", " fd_set __user *outp", "fd_set __user *exp", " struct timeval __user *tvp"}, 0 },
+// 24 long sys_sched_yield ['void']
+{ 24, "sys_sched_yield", "", {}, {}, {}, 0 },
+// 25 unsigned long sys_mremap ['unsigned long addr', ' unsigned long old_len', ' unsigned long new_len', ' unsigned long flags', ' unsigned long new_addr']
+{ 25, "sys_mremap", "44444", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"unsigned long addr", " unsigned long old_len", " unsigned long new_len", " unsigned long flags", " unsigned long new_addr"}, 0 },
+// 26 long sys_msync ['unsigned long start', ' size_t len', ' int flags']
+{ 26, "sys_msync", "444", {7, 6, 2}, {0xff, 0xff, 0xff}, {"unsigned long start", " size_t len", " int flags"}, 0 },
+// 27 long sys_mincore ['unsigned long start', ' size_t len', 'unsigned char __user * vec']
+{ 27, "sys_mincore", "44s", {7, 6, 2}, {0xff, 0xff, 0xff}, {"unsigned long start", " size_t len", "unsigned char __user * vec"}, 0 },
+// 28 long sys_madvise ['unsigned long start', ' size_t len', ' int behavior']
+{ 28, "sys_madvise", "444", {7, 6, 2}, {0xff, 0xff, 0xff}, {"unsigned long start", " size_t len", " int behavior"}, 0 },
+// 29 long sys_shmget ['key_t key', ' size_t size', ' int flag']
+{ 29, "sys_shmget", "444", {7, 6, 2}, {0xff, 0xff, 0xff}, {"key_t key", " size_t size", " int flag"}, 0 },
+// 30 long sys_shmat ['int shmid', ' char __user *shmaddr', ' int shmflg']
+{ 30, "sys_shmat", "4s4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int shmid", " char __user *shmaddr", " int shmflg"}, 0 },
+// 31 long sys_shmctl ['int shmid', ' int cmd', ' struct shmid_ds __user *buf']
+{ 31, "sys_shmctl", "44p", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int shmid", " int cmd", " struct shmid_ds __user *buf"}, 0 },
+// 32 long sys_dup ['unsigned int fildes']
+{ 32, "sys_dup", "4", {7}, {0xff}, {"unsigned int fildes"}, 0 },
+// 33 long sys_dup2 ['unsigned int oldfd', ' unsigned int newfd']
+{ 33, "sys_dup2", "44", {7, 6}, {0xff, 0xff}, {"unsigned int oldfd", " unsigned int newfd"}, 0 },
+// 34 long sys_pause ['void']
+{ 34, "sys_pause", "", {}, {}, {}, 0 },
+// 35 long sys_nanosleep ['struct timespec __user *rqtp', ' struct timespec __user *rmtp']
+{ 35, "sys_nanosleep", "pp", {7, 6}, {0xff, 0xff}, {"struct timespec __user *rqtp", " struct timespec __user *rmtp"}, 0 },
+// 36 long sys_getitimer ['int which', ' struct itimerval __user *value']
+{ 36, "sys_getitimer", "4p", {7, 6}, {0xff, 0xff}, {"int which", " struct itimerval __user *value"}, 0 },
+// 37 long sys_alarm ['unsigned int seconds']
+{ 37, "sys_alarm", "4", {7}, {0xff}, {"unsigned int seconds"}, 0 },
+// 38 long sys_setitimer ['int which', 'struct itimerval __user *value', 'struct itimerval __user *ovalue']
+{ 38, "sys_setitimer", "4pp", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int which", "struct itimerval __user *value", "struct itimerval __user *ovalue"}, 0 },
+// 39 long sys_getpid ['void']
+{ 39, "sys_getpid", "", {}, {}, {}, 0 },
+// 40 long sys_sendfile ['int out_fd', ' int in_fd', 'off_t __user *offset', ' size_t count']
+{ 40, "sys_sendfile", "44p4", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int out_fd", " int in_fd", "off_t __user *offset", " size_t count"}, 0 },
+// 41 long sys_socket ['int', ' int', ' int']
+{ 41, "sys_socket", "444", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int", " int", " int"}, 0 },
+// 42 long sys_connect ['int', ' struct sockaddr __user *', ' int']
+{ 42, "sys_connect", "4p4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int", " struct sockaddr __user *", " int"}, 0 },
+// 43 long sys_accept ['int', ' struct sockaddr __user *', ' int __user *']
+{ 43, "sys_accept", "4pp", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int", " struct sockaddr __user *", " int __user *"}, 0 },
+// 44 long sys_sendto ['int', ' void __user *', ' size_t', ' unsigned', 'struct sockaddr __user *', ' int']
+{ 44, "sys_sendto", "4p44p4", {7, 6, 2, 10, 8, 9}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"int", " void __user *", " size_t", " unsigned", "struct sockaddr __user *", " int"}, 0 },
+// 45 long sys_recvfrom ['int', ' void __user *', ' size_t', ' unsigned', 'struct sockaddr __user *', ' int __user *']
+{ 45, "sys_recvfrom", "4p44pp", {7, 6, 2, 10, 8, 9}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"int", " void __user *", " size_t", " unsigned", "struct sockaddr __user *", " int __user *"}, 0 },
+// 46 long sys_sendmsg ['int fd', ' struct msghdr __user *msg', ' unsigned flags']
+{ 46, "sys_sendmsg", "4p4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int fd", " struct msghdr __user *msg", " unsigned flags"}, 0 },
+// 47 long sys_recvmsg ['int fd', ' struct msghdr __user *msg', ' unsigned flags']
+{ 47, "sys_recvmsg", "4p4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int fd", " struct msghdr __user *msg", " unsigned flags"}, 0 },
+// 48 long sys_shutdown ['int', ' int']
+{ 48, "sys_shutdown", "44", {7, 6}, {0xff, 0xff}, {"int", " int"}, 0 },
+// 49 long sys_bind ['int', ' struct sockaddr __user *', ' int']
+{ 49, "sys_bind", "4p4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int", " struct sockaddr __user *", " int"}, 0 },
+// 50 long sys_listen ['int', ' int']
+{ 50, "sys_listen", "44", {7, 6}, {0xff, 0xff}, {"int", " int"}, 0 },
+// 51 long sys_getsockname ['int', ' struct sockaddr __user *', ' int __user *']
+{ 51, "sys_getsockname", "4pp", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int", " struct sockaddr __user *", " int __user *"}, 0 },
+// 52 long sys_getpeername ['int', ' struct sockaddr __user *', ' int __user *']
+{ 52, "sys_getpeername", "4pp", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int", " struct sockaddr __user *", " int __user *"}, 0 },
+// 53 long sys_socketpair ['int', ' int', ' int', ' int __user *']
+{ 53, "sys_socketpair", "444p", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int", " int", " int", " int __user *"}, 0 },
+// 54 long sys_setsockopt ['int fd', ' int level', ' int optname', 'char __user *optval', ' int optlen']
+{ 54, "sys_setsockopt", "444s4", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int fd", " int level", " int optname", "char __user *optval", " int optlen"}, 0 },
+// 55 long sys_getsockopt ['int fd', ' int level', ' int optname', 'char __user *optval', ' int __user *optlen']
+{ 55, "sys_getsockopt", "444sp", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int fd", " int level", " int optname", "char __user *optval", " int __user *optlen"}, 0 },
+// 56 long sys_clone ['unsigned long clone_flags', ' unsigned long newsp', ' int __user *parent_tidptr', ' int __user *child_tidptr', ' unsigned long tls']
+{ 56, "sys_clone", "44pp4", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"unsigned long clone_flags", " unsigned long newsp", " int __user *parent_tidptr", " int __user *child_tidptr", " unsigned long tls"}, 0 },
+// 57 long sys_fork ['void']
+{ 57, "sys_fork", "", {}, {}, {}, 0 },
+// 58 long sys_vfork ['void']
+{ 58, "sys_vfork", "", {}, {}, {}, 0 },
+// 59 long sys_execve ['const char __user *filename', ' char *const argv[]', ' char *const envp[]']
+{ 59, "sys_execve", "spp", {7, 6, 2}, {0xff, 0xff, 0xff}, {"const char __user *filename", " char *const argv[]", " char *const envp[]"}, 0 },
+// 60 long sys_exit ['int error_code']
+{ 60, "sys_exit", "4", {7}, {0xff}, {"int error_code"}, 0 },
+// 61 long sys_wait4 ['pid_t pid', ' int __user *stat_addr', 'int options', ' struct rusage __user *ru']
+{ 61, "sys_wait4", "4p4p", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"pid_t pid", " int __user *stat_addr", "int options", " struct rusage __user *ru"}, 0 },
+// 62 long sys_kill ['int pid', ' int sig']
+{ 62, "sys_kill", "44", {7, 6}, {0xff, 0xff}, {"int pid", " int sig"}, 0 },
+// 63 long sys_newuname ['struct new_utsname __user *name']
+{ 63, "sys_newuname", "p", {7}, {0xff}, {"struct new_utsname __user *name"}, 0 },
+// 64 long sys_semget ['key_t key', ' int nsems', ' int semflg']
+{ 64, "sys_semget", "444", {7, 6, 2}, {0xff, 0xff, 0xff}, {"key_t key", " int nsems", " int semflg"}, 0 },
+// 65 long sys_semop ['int semid', ' struct sembuf __user *sops', 'unsigned nsops']
+{ 65, "sys_semop", "4p4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int semid", " struct sembuf __user *sops", "unsigned nsops"}, 0 },
+// 66 long sys_semctl ['int semid', ' int semnum', ' int cmd', ' union semun arg']
+{ 66, "sys_semctl", "4444", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int semid", " int semnum", " int cmd", " union semun arg"}, 0 },
+// 67 long sys_shmdt ['char __user *shmaddr']
+{ 67, "sys_shmdt", "s", {7}, {0xff}, {"char __user *shmaddr"}, 0 },
+// 68 long sys_msgget ['key_t key', ' int msgflg']
+{ 68, "sys_msgget", "44", {7, 6}, {0xff, 0xff}, {"key_t key", " int msgflg"}, 0 },
+// 69 long sys_msgsnd ['int msqid', ' struct msgbuf __user *msgp', 'size_t msgsz', ' int msgflg']
+{ 69, "sys_msgsnd", "4p44", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int msqid", " struct msgbuf __user *msgp", "size_t msgsz", " int msgflg"}, 0 },
+// 70 long sys_msgrcv ['int msqid', ' struct msgbuf __user *msgp', 'size_t msgsz', ' long msgtyp', ' int msgflg']
+{ 70, "sys_msgrcv", "4p444", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int msqid", " struct msgbuf __user *msgp", "size_t msgsz", " long msgtyp", " int msgflg"}, 0 },
+// 71 long sys_msgctl ['int msqid', ' int cmd', ' struct msqid_ds __user *buf']
+{ 71, "sys_msgctl", "44p", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int msqid", " int cmd", " struct msqid_ds __user *buf"}, 0 },
+// 72 long sys_fcntl ['unsigned int fd', ' unsigned int cmd', ' unsigned long arg']
+{ 72, "sys_fcntl", "444", {7, 6, 2}, {0xff, 0xff, 0xff}, {"unsigned int fd", " unsigned int cmd", " unsigned long arg"}, 0 },
+// 73 long sys_flock ['unsigned int fd', ' unsigned int cmd']
+{ 73, "sys_flock", "44", {7, 6}, {0xff, 0xff}, {"unsigned int fd", " unsigned int cmd"}, 0 },
+// 74 long sys_fsync ['unsigned int fd']
+{ 74, "sys_fsync", "4", {7}, {0xff}, {"unsigned int fd"}, 0 },
+// 75 long sys_fdatasync ['unsigned int fd']
+{ 75, "sys_fdatasync", "4", {7}, {0xff}, {"unsigned int fd"}, 0 },
+// 76 long sys_truncate ['const char __user *path', 'unsigned long length']
+{ 76, "sys_truncate", "s4", {7, 6}, {0xff, 0xff}, {"const char __user *path", "unsigned long length"}, 0 },
+// 77 long sys_ftruncate ['unsigned int fd', ' unsigned long length']
+{ 77, "sys_ftruncate", "44", {7, 6}, {0xff, 0xff}, {"unsigned int fd", " unsigned long length"}, 0 },
+// 78 long sys_getdents ['unsigned int fd', 'struct linux_dirent __user *dirent', 'unsigned int count']
+{ 78, "sys_getdents", "4p4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"unsigned int fd", "struct linux_dirent __user *dirent", "unsigned int count"}, 0 },
+// 79 long sys_getcwd ['char __user *buf', ' unsigned long size']
+{ 79, "sys_getcwd", "p4", {7, 6}, {0xff, 0xff}, {"char __user *buf", " unsigned long size"}, 0 },
+// 80 long sys_chdir ['const char __user *filename']
+{ 80, "sys_chdir", "s", {7}, {0xff}, {"const char __user *filename"}, 0 },
+// 81 long sys_fchdir ['unsigned int fd']
+{ 81, "sys_fchdir", "4", {7}, {0xff}, {"unsigned int fd"}, 0 },
+// 82 long sys_rename ['const char __user *oldname', 'const char __user *newname']
+{ 82, "sys_rename", "ss", {7, 6}, {0xff, 0xff}, {"const char __user *oldname", "const char __user *newname"}, 0 },
+// 83 long sys_mkdir ['const char __user *pathname', ' int mode']
+{ 83, "sys_mkdir", "s4", {7, 6}, {0xff, 0xff}, {"const char __user *pathname", " int mode"}, 0 },
+// 84 long sys_rmdir ['const char __user *pathname']
+{ 84, "sys_rmdir", "s", {7}, {0xff}, {"const char __user *pathname"}, 0 },
+// 85 long sys_creat ['const char __user *pathname', ' int mode']
+{ 85, "sys_creat", "s4", {7, 6}, {0xff, 0xff}, {"const char __user *pathname", " int mode"}, 0 },
+// 86 long sys_link ['const char __user *oldname', 'const char __user *newname']
+{ 86, "sys_link", "ss", {7, 6}, {0xff, 0xff}, {"const char __user *oldname", "const char __user *newname"}, 0 },
+// 87 long sys_unlink ['const char __user *pathname']
+{ 87, "sys_unlink", "s", {7}, {0xff}, {"const char __user *pathname"}, 0 },
+// 88 long sys_symlink ['const char __user *old', ' const char __user *new']
+{ 88, "sys_symlink", "ss", {7, 6}, {0xff, 0xff}, {"const char __user *old", " const char __user *new"}, 0 },
+// 89 long sys_readlink ['const char __user *path', 'char __user *buf', ' int bufsiz']
+{ 89, "sys_readlink", "sp4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"const char __user *path", "char __user *buf", " int bufsiz"}, 0 },
+// 90 long sys_chmod ['const char __user *filename', ' mode_t mode']
+{ 90, "sys_chmod", "s4", {7, 6}, {0xff, 0xff}, {"const char __user *filename", " mode_t mode"}, 0 },
+// 91 long sys_fchmod ['unsigned int fd', ' mode_t mode']
+{ 91, "sys_fchmod", "44", {7, 6}, {0xff, 0xff}, {"unsigned int fd", " mode_t mode"}, 0 },
+// 92 long sys_chown ['const char __user *filename', 'uid_t user', ' gid_t group']
+{ 92, "sys_chown", "s44", {7, 6, 2}, {0xff, 0xff, 0xff}, {"const char __user *filename", "uid_t user", " gid_t group"}, 0 },
+// 93 long sys_fchown ['unsigned int fd', ' uid_t user', ' gid_t group']
+{ 93, "sys_fchown", "444", {7, 6, 2}, {0xff, 0xff, 0xff}, {"unsigned int fd", " uid_t user", " gid_t group"}, 0 },
+// 94 long sys_lchown ['const char __user *filename', 'uid_t user', ' gid_t group']
+{ 94, "sys_lchown", "s44", {7, 6, 2}, {0xff, 0xff, 0xff}, {"const char __user *filename", "uid_t user", " gid_t group"}, 0 },
+// 95 long sys_umask ['int mask']
+{ 95, "sys_umask", "4", {7}, {0xff}, {"int mask"}, 0 },
+// 96 long sys_gettimeofday ['struct timeval __user *tv', 'struct timezone __user *tz']
+{ 96, "sys_gettimeofday", "pp", {7, 6}, {0xff, 0xff}, {"struct timeval __user *tv", "struct timezone __user *tz"}, 0 },
+// 97 long sys_getrlimit ['unsigned int resource', 'struct rlimit __user *rlim']
+{ 97, "sys_getrlimit", "4p", {7, 6}, {0xff, 0xff}, {"unsigned int resource", "struct rlimit __user *rlim"}, 0 },
+// 98 long sys_getrusage ['int who', ' struct rusage __user *ru']
+{ 98, "sys_getrusage", "4p", {7, 6}, {0xff, 0xff}, {"int who", " struct rusage __user *ru"}, 0 },
+// 99 long sys_sysinfo ['struct sysinfo __user *info']
+{ 99, "sys_sysinfo", "p", {7}, {0xff}, {"struct sysinfo __user *info"}, 0 },
+// 100 long sys_times ['struct tms __user *tbuf']
+{ 100, "sys_times", "p", {7}, {0xff}, {"struct tms __user *tbuf"}, 0 },
+// 101 long sys_ptrace ['long request', ' long pid', ' long addr', ' long data']
+{ 101, "sys_ptrace", "4444", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"long request", " long pid", " long addr", " long data"}, 0 },
+// 102 long sys_getuid ['void']
+{ 102, "sys_getuid", "", {}, {}, {}, 0 },
+// 103 long sys_syslog ['int type', ' char __user *buf', ' int len']
+{ 103, "sys_syslog", "4p4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int type", " char __user *buf", " int len"}, 0 },
+// 104 long sys_getgid ['void']
+{ 104, "sys_getgid", "", {}, {}, {}, 0 },
+// 105 long sys_setuid ['uid_t uid']
+{ 105, "sys_setuid", "4", {7}, {0xff}, {"uid_t uid"}, 0 },
+// 106 long sys_setgid ['gid_t gid']
+{ 106, "sys_setgid", "4", {7}, {0xff}, {"gid_t gid"}, 0 },
+// 107 long sys_geteuid ['void']
+{ 107, "sys_geteuid", "", {}, {}, {}, 0 },
+// 108 long sys_getegid ['void']
+{ 108, "sys_getegid", "", {}, {}, {}, 0 },
+// 109 long sys_setpgid ['pid_t pid', ' pid_t pgid']
+{ 109, "sys_setpgid", "44", {7, 6}, {0xff, 0xff}, {"pid_t pid", " pid_t pgid"}, 0 },
+// 110 long sys_getppid ['void']
+{ 110, "sys_getppid", "", {}, {}, {}, 0 },
+// 111 long sys_getpgrp ['void']
+{ 111, "sys_getpgrp", "", {}, {}, {}, 0 },
+// 112 long sys_setsid ['void']
+{ 112, "sys_setsid", "", {}, {}, {}, 0 },
+// 113 long sys_setreuid ['uid_t ruid', ' uid_t euid']
+{ 113, "sys_setreuid", "44", {7, 6}, {0xff, 0xff}, {"uid_t ruid", " uid_t euid"}, 0 },
+// 114 long sys_setregid ['gid_t rgid', ' gid_t egid']
+{ 114, "sys_setregid", "44", {7, 6}, {0xff, 0xff}, {"gid_t rgid", " gid_t egid"}, 0 },
+// 115 long sys_getgroups ['int gidsetsize', ' gid_t __user *grouplist']
+{ 115, "sys_getgroups", "4p", {7, 6}, {0xff, 0xff}, {"int gidsetsize", " gid_t __user *grouplist"}, 0 },
+// 116 long sys_setgroups ['int gidsetsize', ' gid_t __user *grouplist']
+{ 116, "sys_setgroups", "4p", {7, 6}, {0xff, 0xff}, {"int gidsetsize", " gid_t __user *grouplist"}, 0 },
+// 117 long sys_setresuid ['uid_t ruid', ' uid_t euid', ' uid_t suid']
+{ 117, "sys_setresuid", "444", {7, 6, 2}, {0xff, 0xff, 0xff}, {"uid_t ruid", " uid_t euid", " uid_t suid"}, 0 },
+// 118 long sys_getresuid ['uid_t __user *ruid', ' uid_t __user *euid', ' uid_t __user *suid']
+{ 118, "sys_getresuid", "ppp", {7, 6, 2}, {0xff, 0xff, 0xff}, {"uid_t __user *ruid", " uid_t __user *euid", " uid_t __user *suid"}, 0 },
+// 119 long sys_setresgid ['gid_t rgid', ' gid_t egid', ' gid_t sgid']
+{ 119, "sys_setresgid", "444", {7, 6, 2}, {0xff, 0xff, 0xff}, {"gid_t rgid", " gid_t egid", " gid_t sgid"}, 0 },
+// 120 long sys_getresgid ['gid_t __user *rgid', ' gid_t __user *egid', ' gid_t __user *sgid']
+{ 120, "sys_getresgid", "ppp", {7, 6, 2}, {0xff, 0xff, 0xff}, {"gid_t __user *rgid", " gid_t __user *egid", " gid_t __user *sgid"}, 0 },
+// 121 long sys_getpgid ['pid_t pid']
+{ 121, "sys_getpgid", "4", {7}, {0xff}, {"pid_t pid"}, 0 },
+// 122 long sys_setfsuid ['uid_t uid']
+{ 122, "sys_setfsuid", "4", {7}, {0xff}, {"uid_t uid"}, 0 },
+// 123 long sys_setfsgid ['gid_t gid']
+{ 123, "sys_setfsgid", "4", {7}, {0xff}, {"gid_t gid"}, 0 },
+// 124 long sys_getsid ['pid_t pid']
+{ 124, "sys_getsid", "4", {7}, {0xff}, {"pid_t pid"}, 0 },
+// 125 long sys_capget ['cap_user_header_t header', 'cap_user_data_t dataptr']
+{ 125, "sys_capget", "pp", {7, 6}, {0xff, 0xff}, {"cap_user_header_t header", "cap_user_data_t dataptr"}, 0 },
+// 126 long sys_capset ['cap_user_header_t header', 'const cap_user_data_t data']
+{ 126, "sys_capset", "pp", {7, 6}, {0xff, 0xff}, {"cap_user_header_t header", "const cap_user_data_t data"}, 0 },
+// 127 long sys_rt_sigpending ['sigset_t __user *set', ' size_t sigsetsize']
+{ 127, "sys_rt_sigpending", "p4", {7, 6}, {0xff, 0xff}, {"sigset_t __user *set", " size_t sigsetsize"}, 0 },
+// 128 long sys_rt_sigtimedwait ['const sigset_t __user *uthese', 'siginfo_t __user *uinfo', 'const struct timespec __user *uts', 'size_t sigsetsize']
+{ 128, "sys_rt_sigtimedwait", "ppp4", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"const sigset_t __user *uthese", "siginfo_t __user *uinfo", "const struct timespec __user *uts", "size_t sigsetsize"}, 0 },
+// 129 long sys_rt_sigqueueinfo ['int pid', ' int sig', ' siginfo_t __user *uinfo']
+{ 129, "sys_rt_sigqueueinfo", "44p", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int pid", " int sig", " siginfo_t __user *uinfo"}, 0 },
+// 130 int sys_rt_sigsuspend ['sigset_t __user *unewset', ' size_t sigsetsize']
+{ 130, "sys_rt_sigsuspend", "p4", {7, 6}, {0xff, 0xff}, {"sigset_t __user *unewset", " size_t sigsetsize"}, 0 },
+// 131 long sys_sigaltstack ['const stack_t __user *uss', ' stack_t __user *uoss']
+{ 131, "sys_sigaltstack", "pp", {7, 6}, {0xff, 0xff}, {"const stack_t __user *uss", " stack_t __user *uoss"}, 0 },
+// 132 long sys_utime ['char __user *filename', ' struct utimbuf __user *times']
+{ 132, "sys_utime", "sp", {7, 6}, {0xff, 0xff}, {"char __user *filename", " struct utimbuf __user *times"}, 0 },
+// 133 long sys_mknod ['const char __user *filename', ' int mode', 'unsigned dev']
+{ 133, "sys_mknod", "s44", {7, 6, 2}, {0xff, 0xff, 0xff}, {"const char __user *filename", " int mode", "unsigned dev"}, 0 },
+// 134 long sys_uselib ['const char __user *library']
+{ 134, "sys_uselib", "s", {7}, {0xff}, {"const char __user *library"}, 0 },
+// 135 long sys_personality ['u_long personality']
+{ 135, "sys_personality", "4", {7}, {0xff}, {"u_long personality"}, 0 },
+// 136 long sys_ustat ['unsigned dev', ' struct ustat __user *ubuf']
+{ 136, "sys_ustat", "4p", {7, 6}, {0xff, 0xff}, {"unsigned dev", " struct ustat __user *ubuf"}, 0 },
+// 137 long sys_statfs ['const char __user * path', 'struct statfs __user *buf']
+{ 137, "sys_statfs", "sp", {7, 6}, {0xff, 0xff}, {"const char __user * path", "struct statfs __user *buf"}, 0 },
+// 138 long sys_fstatfs ['unsigned int fd', ' struct statfs __user *buf']
+{ 138, "sys_fstatfs", "4p", {7, 6}, {0xff, 0xff}, {"unsigned int fd", " struct statfs __user *buf"}, 0 },
+// 139 long sys_sysfs ['int option', 'unsigned long arg1', ' unsigned long arg2']
+{ 139, "sys_sysfs", "444", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int option", "unsigned long arg1", " unsigned long arg2"}, 0 },
+// 140 long sys_getpriority ['int which', ' int who']
+{ 140, "sys_getpriority", "44", {7, 6}, {0xff, 0xff}, {"int which", " int who"}, 0 },
+// 141 long sys_setpriority ['int which', ' int who', ' int niceval']
+{ 141, "sys_setpriority", "444", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int which", " int who", " int niceval"}, 0 },
+// 142 long sys_sched_setparam ['pid_t pid', 'struct sched_param __user *param']
+{ 142, "sys_sched_setparam", "4p", {7, 6}, {0xff, 0xff}, {"pid_t pid", "struct sched_param __user *param"}, 0 },
+// 143 long sys_sched_getparam ['pid_t pid', 'struct sched_param __user *param']
+{ 143, "sys_sched_getparam", "4p", {7, 6}, {0xff, 0xff}, {"pid_t pid", "struct sched_param __user *param"}, 0 },
+// 144 long sys_sched_setscheduler ['pid_t pid', ' int policy', 'struct sched_param __user *param']
+{ 144, "sys_sched_setscheduler", "44p", {7, 6, 2}, {0xff, 0xff, 0xff}, {"pid_t pid", " int policy", "struct sched_param __user *param"}, 0 },
+// 145 long sys_sched_getscheduler ['pid_t pid']
+{ 145, "sys_sched_getscheduler", "4", {7}, {0xff}, {"pid_t pid"}, 0 },
+// 146 long sys_sched_get_priority_max ['int policy']
+{ 146, "sys_sched_get_priority_max", "4", {7}, {0xff}, {"int policy"}, 0 },
+// 147 long sys_sched_get_priority_min ['int policy']
+{ 147, "sys_sched_get_priority_min", "4", {7}, {0xff}, {"int policy"}, 0 },
+// 148 long sys_sched_rr_get_interval ['pid_t pid', 'struct timespec __user *interval']
+{ 148, "sys_sched_rr_get_interval", "4p", {7, 6}, {0xff, 0xff}, {"pid_t pid", "struct timespec __user *interval"}, 0 },
+// 149 long sys_mlock ['unsigned long start', ' size_t len']
+{ 149, "sys_mlock", "44", {7, 6}, {0xff, 0xff}, {"unsigned long start", " size_t len"}, 0 },
+// 150 long sys_munlock ['unsigned long start', ' size_t len']
+{ 150, "sys_munlock", "44", {7, 6}, {0xff, 0xff}, {"unsigned long start", " size_t len"}, 0 },
+// 151 long sys_mlockall ['int flags']
+{ 151, "sys_mlockall", "4", {7}, {0xff}, {"int flags"}, 0 },
+// 152 long sys_munlockall ['void']
+{ 152, "sys_munlockall", "", {}, {}, {}, 0 },
+// 153 long sys_vhangup ['void']
+{ 153, "sys_vhangup", "", {}, {}, {}, 0 },
+// 154 int sys_modify_ldt ['int func', ' void __user *ptr', ' unsigned long bytecount']
+{ 154, "sys_modify_ldt", "4p4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int func", " void __user *ptr", " unsigned long bytecount"}, 0 },
+// 155 long sys_pivot_root ['const char __user *new_root', 'const char __user *put_old']
+{ 155, "sys_pivot_root", "ss", {7, 6}, {0xff, 0xff}, {"const char __user *new_root", "const char __user *put_old"}, 0 },
+// 156 long sys_sysctl ['struct __sysctl_args __user *args']
+{ 156, "sys_sysctl", "p", {7}, {0xff}, {"struct __sysctl_args __user *args"}, 0 },
+// 157 long sys_prctl ['int option', ' unsigned long arg2', ' unsigned long arg3', 'unsigned long arg4', ' unsigned long arg5']
+{ 157, "sys_prctl", "44444", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int option", " unsigned long arg2", " unsigned long arg3", "unsigned long arg4", " unsigned long arg5"}, SYSCALL_CB_PRCTL },
+// 158 long sys_arch_prctl ['int code', ' unsigned long addr']
+{ 158, "sys_arch_prctl", "44", {7, 6}, {0xff, 0xff}, {"int code", " unsigned long addr"}, 0 },
+// 159 long sys_adjtimex ['struct timex __user *txc_p']
+{ 159, "sys_adjtimex", "p", {7}, {0xff}, {"struct timex __user *txc_p"}, 0 },
+// 160 long sys_setrlimit ['unsigned int resource', 'struct rlimit __user *rlim']
+{ 160, "sys_setrlimit", "4p", {7, 6}, {0xff, 0xff}, {"unsigned int resource", "struct rlimit __user *rlim"}, 0 },
+// 161 long sys_chroot ['const char __user *filename']
+{ 161, "sys_chroot", "s", {7}, {0xff}, {"const char __user *filename"}, 0 },
+// 162 long sys_sync ['void']
+{ 162, "sys_sync", "", {}, {}, {}, 0 },
+// 163 long sys_acct ['const char __user *name']
+{ 163, "sys_acct", "s", {7}, {0xff}, {"const char __user *name"}, 0 },
+// 164 long sys_settimeofday ['struct timeval __user *tv', 'struct timezone __user *tz']
+{ 164, "sys_settimeofday", "pp", {7, 6}, {0xff, 0xff}, {"struct timeval __user *tv", "struct timezone __user *tz"}, 0 },
+// 165 long sys_mount ['char __user *dev_name', ' char __user *dir_name', 'char __user *type', ' unsigned long flags', 'void __user *data']
+{ 165, "sys_mount", "sss4p", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"char __user *dev_name", " char __user *dir_name", "char __user *type", " unsigned long flags", "void __user *data"}, 0 },
+// 166 long sys_umount ['char __user *name', ' int flags']
+{ 166, "sys_umount", "s4", {7, 6}, {0xff, 0xff}, {"char __user *name", " int flags"}, 0 },
+// 167 long sys_swapon ['const char __user *specialfile', ' int swap_flags']
+{ 167, "sys_swapon", "s4", {7, 6}, {0xff, 0xff}, {"const char __user *specialfile", " int swap_flags"}, 0 },
+// 168 long sys_swapoff ['const char __user *specialfile']
+{ 168, "sys_swapoff", "s", {7}, {0xff}, {"const char __user *specialfile"}, 0 },
+// 169 long sys_reboot ['int magic1', ' int magic2', ' unsigned int cmd', 'void __user *arg']
+{ 169, "sys_reboot", "444p", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int magic1", " int magic2", " unsigned int cmd", "void __user *arg"}, 0 },
+// 170 long sys_sethostname ['char __user *name', ' int len']
+{ 170, "sys_sethostname", "s4", {7, 6}, {0xff, 0xff}, {"char __user *name", " int len"}, 0 },
+// 171 long sys_setdomainname ['char __user *name', ' int len']
+{ 171, "sys_setdomainname", "s4", {7, 6}, {0xff, 0xff}, {"char __user *name", " int len"}, 0 },
+// 172 long sys_iopl ['unsigned int level']
+{ 172, "sys_iopl", "4", {7}, {0xff}, {"unsigned int level"}, 0 },
+// 173 long sys_ioperm ['unsigned long from', ' unsigned long num', ' int on']
+{ 173, "sys_ioperm", "444", {7, 6, 2}, {0xff, 0xff, 0xff}, {"unsigned long from", " unsigned long num", " int on"}, 0 },
+// 175 long sys_init_module ['void __user *umod', ' unsigned long len', 'const char __user *uargs']
+{ 175, "sys_init_module", "p4s", {7, 6, 2}, {0xff, 0xff, 0xff}, {"void __user *umod", " unsigned long len", "const char __user *uargs"}, 0 },
+// 176 long sys_delete_module ['const char __user *name_user', 'unsigned int flags']
+{ 176, "sys_delete_module", "s4", {7, 6}, {0xff, 0xff}, {"const char __user *name_user", "unsigned int flags"}, 0 },
+// 179 long sys_quotactl ['unsigned int cmd', ' const char __user *special', 'qid_t id', ' void __user *addr']
+{ 179, "sys_quotactl", "4s4p", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"unsigned int cmd", " const char __user *special", "qid_t id", " void __user *addr"}, 0 },
+// 186 long sys_gettid ['void']
+{ 186, "sys_gettid", "", {}, {}, {}, 0 },
+// 187 long sys_readahead ['int fd', ' loff_t offset', ' size_t count']
+{ 187, "sys_readahead", "484", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int fd", " loff_t offset", " size_t count"}, 0 },
+// 188 long sys_setxattr ['const char __user *path', ' const char __user *name', 'const void __user *value', ' size_t size', ' int flags']
+{ 188, "sys_setxattr", "ssp44", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"const char __user *path", " const char __user *name", "const void __user *value", " size_t size", " int flags"}, 0 },
+// 189 long sys_lsetxattr ['const char __user *path', ' const char __user *name', 'const void __user *value', ' size_t size', ' int flags']
+{ 189, "sys_lsetxattr", "ssp44", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"const char __user *path", " const char __user *name", "const void __user *value", " size_t size", " int flags"}, 0 },
+// 190 long sys_fsetxattr ['int fd', ' const char __user *name', 'const void __user *value', ' size_t size', ' int flags']
+{ 190, "sys_fsetxattr", "4sp44", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int fd", " const char __user *name", "const void __user *value", " size_t size", " int flags"}, 0 },
+// 191 long sys_getxattr ['const char __user *path', ' const char __user *name', 'void __user *value', ' size_t size']
+{ 191, "sys_getxattr", "ssp4", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"const char __user *path", " const char __user *name", "void __user *value", " size_t size"}, 0 },
+// 192 long sys_lgetxattr ['const char __user *path', ' const char __user *name', 'void __user *value', ' size_t size']
+{ 192, "sys_lgetxattr", "ssp4", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"const char __user *path", " const char __user *name", "void __user *value", " size_t size"}, 0 },
+// 193 long sys_fgetxattr ['int fd', ' const char __user *name', 'void __user *value', ' size_t size']
+{ 193, "sys_fgetxattr", "4sp4", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int fd", " const char __user *name", "void __user *value", " size_t size"}, 0 },
+// 194 long sys_listxattr ['const char __user *path', ' char __user *list', 'size_t size']
+{ 194, "sys_listxattr", "ss4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"const char __user *path", " char __user *list", "size_t size"}, 0 },
+// 195 long sys_llistxattr ['const char __user *path', ' char __user *list', 'size_t size']
+{ 195, "sys_llistxattr", "ss4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"const char __user *path", " char __user *list", "size_t size"}, 0 },
+// 196 long sys_flistxattr ['int fd', ' char __user *list', ' size_t size']
+{ 196, "sys_flistxattr", "4s4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int fd", " char __user *list", " size_t size"}, 0 },
+// 197 long sys_removexattr ['const char __user *path', 'const char __user *name']
+{ 197, "sys_removexattr", "ss", {7, 6}, {0xff, 0xff}, {"const char __user *path", "const char __user *name"}, 0 },
+// 198 long sys_lremovexattr ['const char __user *path', 'const char __user *name']
+{ 198, "sys_lremovexattr", "ss", {7, 6}, {0xff, 0xff}, {"const char __user *path", "const char __user *name"}, 0 },
+// 199 long sys_fremovexattr ['int fd', ' const char __user *name']
+{ 199, "sys_fremovexattr", "4s", {7, 6}, {0xff, 0xff}, {"int fd", " const char __user *name"}, 0 },
+// 200 long sys_tkill ['int pid', ' int sig']
+{ 200, "sys_tkill", "44", {7, 6}, {0xff, 0xff}, {"int pid", " int sig"}, 0 },
+// 201 long sys_time ['time_t __user *tloc']
+{ 201, "sys_time", "p", {7}, {0xff}, {"time_t __user *tloc"}, 0 },
+// 202 long sys_futex ['u32 __user *uaddr', ' int op', ' u32 val', 'struct timespec __user *utime', ' u32 __user *uaddr2', 'u32 val3']
+{ 202, "sys_futex", "p44pp4", {7, 6, 2, 10, 8, 9}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"u32 __user *uaddr", " int op", " u32 val", "struct timespec __user *utime", " u32 __user *uaddr2", "u32 val3"}, 0 },
+// 203 long sys_sched_setaffinity ['pid_t pid', ' unsigned int len', 'unsigned long __user *user_mask_ptr']
+{ 203, "sys_sched_setaffinity", "44p", {7, 6, 2}, {0xff, 0xff, 0xff}, {"pid_t pid", " unsigned int len", "unsigned long __user *user_mask_ptr"}, 0 },
+// 204 long sys_sched_getaffinity ['pid_t pid', ' unsigned int len', 'unsigned long __user *user_mask_ptr']
+{ 204, "sys_sched_getaffinity", "44p", {7, 6, 2}, {0xff, 0xff, 0xff}, {"pid_t pid", " unsigned int len", "unsigned long __user *user_mask_ptr"}, 0 },
+// 205 int sys_set_thread_area ['struct user_desc __user *u_info']
+{ 205, "sys_set_thread_area", "p", {7}, {0xff}, {"struct user_desc __user *u_info"}, 0 },
+// 206 long sys_io_setup ['unsigned nr_reqs', ' aio_context_t __user *ctx']
+{ 206, "sys_io_setup", "4p", {7, 6}, {0xff, 0xff}, {"unsigned nr_reqs", " aio_context_t __user *ctx"}, 0 },
+// 207 long sys_io_destroy ['aio_context_t ctx']
+{ 207, "sys_io_destroy", "4", {7}, {0xff}, {"aio_context_t ctx"}, 0 },
+// 208 long sys_io_getevents ['aio_context_t ctx_id', 'long min_nr', 'long nr', 'struct io_event __user *events', 'struct timespec __user *timeout']
+{ 208, "sys_io_getevents", "444pp", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"aio_context_t ctx_id", "long min_nr", "long nr", "struct io_event __user *events", "struct timespec __user *timeout"}, 0 },
+// 209 long sys_io_submit ['aio_context_t', ' long', 'struct iocb __user * __user *']
+{ 209, "sys_io_submit", "44p", {7, 6, 2}, {0xff, 0xff, 0xff}, {"aio_context_t", " long", "struct iocb __user * __user *"}, 0 },
+// 210 long sys_io_cancel ['aio_context_t ctx_id', ' struct iocb __user *iocb', 'struct io_event __user *result']
+{ 210, "sys_io_cancel", "4pp", {7, 6, 2}, {0xff, 0xff, 0xff}, {"aio_context_t ctx_id", " struct iocb __user *iocb", "struct io_event __user *result"}, 0 },
+// 211 int sys_get_thread_area ['struct user_desc __user *u_info']
+{ 211, "sys_get_thread_area", "p", {7}, {0xff}, {"struct user_desc __user *u_info"}, 0 },
+// 212 long sys_lookup_dcookie ['u64 cookie64', ' char __user *buf', ' size_t len']
+{ 212, "sys_lookup_dcookie", "8p4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"u64 cookie64", " char __user *buf", " size_t len"}, 0 },
+// 213 long sys_epoll_create ['int size']
+{ 213, "sys_epoll_create", "4", {7}, {0xff}, {"int size"}, 0 },
+// 216 long sys_remap_file_pages ['unsigned long start', ' unsigned long size', 'unsigned long prot', ' unsigned long pgoff', 'unsigned long flags']
+{ 216, "sys_remap_file_pages", "44444", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"unsigned long start", " unsigned long size", "unsigned long prot", " unsigned long pgoff", "unsigned long flags"}, 0 },
+// 217 long sys_getdents64 ['unsigned int fd', 'struct linux_dirent64 __user *dirent', 'unsigned int count']
+{ 217, "sys_getdents64", "4p4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"unsigned int fd", "struct linux_dirent64 __user *dirent", "unsigned int count"}, 0 },
+// 218 long sys_set_tid_address ['int __user *tidptr']
+{ 218, "sys_set_tid_address", "p", {7}, {0xff}, {"int __user *tidptr"}, 0 },
+// 219 long sys_restart_syscall ['void']
+{ 219, "sys_restart_syscall", "", {}, {}, {}, 0 },
+// 220 long sys_semtimedop ['int semid', ' struct sembuf __user *sops', 'unsigned nsops', 'const struct timespec __user *timeout']
+{ 220, "sys_semtimedop", "4p4p", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int semid", " struct sembuf __user *sops", "unsigned nsops", "const struct timespec __user *timeout"}, 0 },
+// 221 long sys_fadvise64 ['int fd', ' loff_t offset', ' size_t len', ' int advice']
+{ 221, "sys_fadvise64", "4844", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int fd", " loff_t offset", " size_t len", " int advice"}, 0 },
+// 222 long sys_timer_create ['clockid_t which_clock', 'struct sigevent __user *timer_event_spec', 'timer_t __user * created_timer_id']
+{ 222, "sys_timer_create", "4pp", {7, 6, 2}, {0xff, 0xff, 0xff}, {"clockid_t which_clock", "struct sigevent __user *timer_event_spec", "timer_t __user * created_timer_id"}, 0 },
+// 223 long sys_timer_settime ['timer_t timer_id', ' int flags', 'const struct itimerspec __user *new_setting', 'struct itimerspec __user *old_setting']
+{ 223, "sys_timer_settime", "44pp", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"timer_t timer_id", " int flags", "const struct itimerspec __user *new_setting", "struct itimerspec __user *old_setting"}, 0 },
+// 224 long sys_timer_gettime ['timer_t timer_id', 'struct itimerspec __user *setting']
+{ 224, "sys_timer_gettime", "4p", {7, 6}, {0xff, 0xff}, {"timer_t timer_id", "struct itimerspec __user *setting"}, 0 },
+// 225 long sys_timer_getoverrun ['timer_t timer_id']
+{ 225, "sys_timer_getoverrun", "4", {7}, {0xff}, {"timer_t timer_id"}, 0 },
+// 226 long sys_timer_delete ['timer_t timer_id']
+{ 226, "sys_timer_delete", "4", {7}, {0xff}, {"timer_t timer_id"}, 0 },
+// 227 long sys_clock_settime ['clockid_t which_clock', 'const struct timespec __user *tp']
+{ 227, "sys_clock_settime", "4p", {7, 6}, {0xff, 0xff}, {"clockid_t which_clock", "const struct timespec __user *tp"}, 0 },
+// 228 long sys_clock_gettime ['clockid_t which_clock', 'struct timespec __user *tp']
+{ 228, "sys_clock_gettime", "4p", {7, 6}, {0xff, 0xff}, {"clockid_t which_clock", "struct timespec __user *tp"}, 0 },
+// 229 long sys_clock_getres ['clockid_t which_clock', 'struct timespec __user *tp']
+{ 229, "sys_clock_getres", "4p", {7, 6}, {0xff, 0xff}, {"clockid_t which_clock", "struct timespec __user *tp"}, 0 },
+// 230 long sys_clock_nanosleep ['clockid_t which_clock', ' int flags', 'const struct timespec __user *rqtp', 'struct timespec __user *rmtp']
+{ 230, "sys_clock_nanosleep", "44pp", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"clockid_t which_clock", " int flags", "const struct timespec __user *rqtp", "struct timespec __user *rmtp"}, 0 },
+// 231 long sys_exit_group ['int error_code']
+{ 231, "sys_exit_group", "4", {7}, {0xff}, {"int error_code"}, 0 },
+// 232 long sys_epoll_wait ['int epfd', ' struct epoll_event __user *events', 'int maxevents', ' int timeout']
+{ 232, "sys_epoll_wait", "4p44", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int epfd", " struct epoll_event __user *events", "int maxevents", " int timeout"}, 0 },
+// 233 long sys_epoll_ctl ['int epfd', ' int op', ' int fd', 'struct epoll_event __user *event']
+{ 233, "sys_epoll_ctl", "444p", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int epfd", " int op", " int fd", "struct epoll_event __user *event"}, 0 },
+// 234 long sys_tgkill ['int tgid', ' int pid', ' int sig']
+{ 234, "sys_tgkill", "444", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int tgid", " int pid", " int sig"}, 0 },
+// 235 long sys_utimes ['char __user *filename', 'struct timeval __user *utimes']
+{ 235, "sys_utimes", "sp", {7, 6}, {0xff, 0xff}, {"char __user *filename", "struct timeval __user *utimes"}, 0 },
+// 237 long sys_mbind ['unsigned long start', ' unsigned long len', 'unsigned long mode', 'unsigned long __user *nmask', 'unsigned long maxnode', 'unsigned flags']
+{ 237, "sys_mbind", "444p44", {7, 6, 2, 10, 8, 9}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"unsigned long start", " unsigned long len", "unsigned long mode", "unsigned long __user *nmask", "unsigned long maxnode", "unsigned flags"}, 0 },
+// 238 long sys_set_mempolicy ['int mode', ' unsigned long __user *nmask', 'unsigned long maxnode']
+{ 238, "sys_set_mempolicy", "4p4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int mode", " unsigned long __user *nmask", "unsigned long maxnode"}, 0 },
+// 239 long sys_get_mempolicy ['int __user *policy', 'unsigned long __user *nmask', 'unsigned long maxnode', 'unsigned long addr', ' unsigned long flags']
+{ 239, "sys_get_mempolicy", "pp444", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int __user *policy", "unsigned long __user *nmask", "unsigned long maxnode", "unsigned long addr", " unsigned long flags"}, 0 },
+// 240 long sys_mq_open ['const char __user *name', ' int oflag', ' mode_t mode', ' struct mq_attr __user *attr']
+{ 240, "sys_mq_open", "s44p", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"const char __user *name", " int oflag", " mode_t mode", " struct mq_attr __user *attr"}, 0 },
+// 241 long sys_mq_unlink ['const char __user *name']
+{ 241, "sys_mq_unlink", "s", {7}, {0xff}, {"const char __user *name"}, 0 },
+// 242 long sys_mq_timedsend ['mqd_t mqdes', ' const char __user *msg_ptr', ' size_t msg_len', ' unsigned int msg_prio', ' const struct timespec __user *abs_timeout']
+{ 242, "sys_mq_timedsend", "4s44p", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"mqd_t mqdes", " const char __user *msg_ptr", " size_t msg_len", " unsigned int msg_prio", " const struct timespec __user *abs_timeout"}, 0 },
+// 243 long sys_mq_timedreceive ['mqd_t mqdes', ' char __user *msg_ptr', ' size_t msg_len', ' unsigned int __user *msg_prio', ' const struct timespec __user *abs_timeout']
+{ 243, "sys_mq_timedreceive", "4s4pp", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"mqd_t mqdes", " char __user *msg_ptr", " size_t msg_len", " unsigned int __user *msg_prio", " const struct timespec __user *abs_timeout"}, 0 },
+// 244 long sys_mq_notify ['mqd_t mqdes', ' const struct sigevent __user *notification']
+{ 244, "sys_mq_notify", "4p", {7, 6}, {0xff, 0xff}, {"mqd_t mqdes", " const struct sigevent __user *notification"}, 0 },
+// 245 long sys_mq_getsetattr ['mqd_t mqdes', ' const struct mq_attr __user *mqstat', ' struct mq_attr __user *omqstat']
+{ 245, "sys_mq_getsetattr", "4pp", {7, 6, 2}, {0xff, 0xff, 0xff}, {"mqd_t mqdes", " const struct mq_attr __user *mqstat", " struct mq_attr __user *omqstat"}, 0 },
+// 246 long sys_kexec_load ['unsigned long entry', ' unsigned long nr_segments', 'struct kexec_segment __user *segments', 'unsigned long flags']
+{ 246, "sys_kexec_load", "44p4", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"unsigned long entry", " unsigned long nr_segments", "struct kexec_segment __user *segments", "unsigned long flags"}, 0 },
+// 247 long sys_waitid ['int which', ' pid_t pid', 'struct siginfo __user *infop', 'int options', ' struct rusage __user *ru']
+{ 247, "sys_waitid", "44p4p", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int which", " pid_t pid", "struct siginfo __user *infop", "int options", " struct rusage __user *ru"}, 0 },
+// 248 long sys_add_key ['const char __user *_type', 'const char __user *_description', 'const void __user *_payload', 'size_t plen', 'key_serial_t destringid']
+{ 248, "sys_add_key", "ssp44", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"const char __user *_type", "const char __user *_description", "const void __user *_payload", "size_t plen", "key_serial_t destringid"}, 0 },
+// 249 long sys_request_key ['const char __user *_type', 'const char __user *_description', 'const char __user *_callout_info', 'key_serial_t destringid']
+{ 249, "sys_request_key", "sss4", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"const char __user *_type", "const char __user *_description", "const char __user *_callout_info", "key_serial_t destringid"}, 0 },
+// 250 long sys_keyctl ['int cmd', ' unsigned long arg2', ' unsigned long arg3', 'unsigned long arg4', ' unsigned long arg5']
+{ 250, "sys_keyctl", "44444", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int cmd", " unsigned long arg2", " unsigned long arg3", "unsigned long arg4", " unsigned long arg5"}, 0 },
+// 251 long sys_ioprio_set ['int which', ' int who', ' int ioprio']
+{ 251, "sys_ioprio_set", "444", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int which", " int who", " int ioprio"}, 0 },
+// 252 long sys_ioprio_get ['int which', ' int who']
+{ 252, "sys_ioprio_get", "44", {7, 6}, {0xff, 0xff}, {"int which", " int who"}, 0 },
+// 253 long sys_inotify_init ['void']
+{ 253, "sys_inotify_init", "", {}, {}, {}, 0 },
+// 254 long sys_inotify_add_watch ['int fd', ' const char __user *path', 'u32 mask']
+{ 254, "sys_inotify_add_watch", "4s4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int fd", " const char __user *path", "u32 mask"}, 0 },
+// 255 long sys_inotify_rm_watch ['int fd', ' __s32 wd']
+{ 255, "sys_inotify_rm_watch", "44", {7, 6}, {0xff, 0xff}, {"int fd", " __s32 wd"}, 0 },
+// 256 long sys_migrate_pages ['pid_t pid', ' unsigned long maxnode', ' const unsigned long __user *from', ' const unsigned long __user *to']
+{ 256, "sys_migrate_pages", "44pp", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"pid_t pid", " unsigned long maxnode", " const unsigned long __user *from", " const unsigned long __user *to"}, 0 },
+// 257 long sys_openat ['int dfd', ' const char __user *filename', ' int flags', 'int mode']
+{ 257, "sys_openat", "4s44", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int dfd", " const char __user *filename", " int flags", "int mode"}, 0 },
+// 258 long sys_mkdirat ['int dfd', ' const char __user * pathname', ' int mode']
+{ 258, "sys_mkdirat", "4s4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int dfd", " const char __user * pathname", " int mode"}, 0 },
+// 259 long sys_mknodat ['int dfd', ' const char __user * filename', ' int mode', 'unsigned dev']
+{ 259, "sys_mknodat", "4s44", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int dfd", " const char __user * filename", " int mode", "unsigned dev"}, 0 },
+// 260 long sys_fchownat ['int dfd', ' const char __user *filename', ' uid_t user', 'gid_t group', ' int flag']
+{ 260, "sys_fchownat", "4s444", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int dfd", " const char __user *filename", " uid_t user", "gid_t group", " int flag"}, 0 },
+// 261 long sys_futimesat ['int dfd', ' char __user *filename', 'struct timeval __user *utimes']
+{ 261, "sys_futimesat", "4sp", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int dfd", " char __user *filename", "struct timeval __user *utimes"}, 0 },
+// 262 long sys_newfstatat ['int dfd', ' const char __user *filename', ' struct stat __user *statbuf', ' int flag']
+{ 262, "sys_newfstatat", "4sp4", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int dfd", " const char __user *filename", " struct stat __user *statbuf", " int flag"}, 0 },
+// 263 long sys_unlinkat ['int dfd', ' const char __user * pathname', ' int flag']
+{ 263, "sys_unlinkat", "4s4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int dfd", " const char __user * pathname", " int flag"}, 0 },
+// 264 long sys_renameat ['int olddfd', ' const char __user * oldname', 'int newdfd', ' const char __user * newname']
+{ 264, "sys_renameat", "4s4s", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int olddfd", " const char __user * oldname", "int newdfd", " const char __user * newname"}, 0 },
+// 265 long sys_linkat ['int olddfd', ' const char __user *oldname', 'int newdfd', ' const char __user *newname', ' int flags']
+{ 265, "sys_linkat", "4s4s4", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int olddfd", " const char __user *oldname", "int newdfd", " const char __user *newname", " int flags"}, 0 },
+// 266 long sys_symlinkat ['const char __user * oldname', 'int newdfd', ' const char __user * newname']
+{ 266, "sys_symlinkat", "s4s", {7, 6, 2}, {0xff, 0xff, 0xff}, {"const char __user * oldname", "int newdfd", " const char __user * newname"}, 0 },
+// 267 long sys_readlinkat ['int dfd', ' const char __user *path', ' char __user *buf', 'int bufsiz']
+{ 267, "sys_readlinkat", "4sp4", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int dfd", " const char __user *path", " char __user *buf", "int bufsiz"}, 0 },
+// 268 long sys_fchmodat ['int dfd', ' const char __user * filename', 'mode_t mode']
+{ 268, "sys_fchmodat", "4s4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int dfd", " const char __user * filename", "mode_t mode"}, 0 },
+// 269 long sys_faccessat ['int dfd', ' const char __user *filename', ' int mode']
+{ 269, "sys_faccessat", "4s4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int dfd", " const char __user *filename", " int mode"}, 0 },
+// 270 long sys_pselect6 ['int n', ' fd_set __user *inp', ' fd_set __user *outp', ' fd_set __user *exp', ' struct timespec __user *tsp', ' void __user *sig']
+{ 270, "sys_pselect6", "4ppppp", {7, 6, 2, 10, 8, 9}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"int n", " fd_set __user *inp", " fd_set __user *outp", " fd_set __user *exp", " struct timespec __user *tsp", " void __user *sig"}, 0 },
+// 271 long sys_ppoll ['struct pollfd __user *ufds', ' unsigned int nfds', ' struct timespec __user *tsp', ' const sigset_t __user *sigmask', ' size_t sigsetsize']
+{ 271, "sys_ppoll", "p4pp4", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"struct pollfd __user *ufds", " unsigned int nfds", " struct timespec __user *tsp", " const sigset_t __user *sigmask", " size_t sigsetsize"}, 0 },
+// 272 long sys_unshare ['unsigned long unshare_flags']
+{ 272, "sys_unshare", "4", {7}, {0xff}, {"unsigned long unshare_flags"}, 0 },
+// 273 long sys_set_robust_list ['struct robust_list_head __user *head', 'size_t len']
+{ 273, "sys_set_robust_list", "p4", {7, 6}, {0xff, 0xff}, {"struct robust_list_head __user *head", "size_t len"}, 0 },
+// 274 long sys_get_robust_list ['int pid', 'struct robust_list_head __user * __user *head_ptr', 'size_t __user *len_ptr']
+{ 274, "sys_get_robust_list", "4pp", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int pid", "struct robust_list_head __user * __user *head_ptr", "size_t __user *len_ptr"}, 0 },
+// 275 long sys_splice ['int fd_in', ' loff_t __user *off_in', 'int fd_out', ' loff_t __user *off_out', 'size_t len', ' unsigned int flags']
+{ 275, "sys_splice", "4p4p44", {7, 6, 2, 10, 8, 9}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"int fd_in", " loff_t __user *off_in", "int fd_out", " loff_t __user *off_out", "size_t len", " unsigned int flags"}, 0 },
+// 276 long sys_tee ['int fdin', ' int fdout', ' size_t len', ' unsigned int flags']
+{ 276, "sys_tee", "4444", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int fdin", " int fdout", " size_t len", " unsigned int flags"}, 0 },
+// 277 long sys_sync_file_range ['int fd', ' loff_t offset', ' loff_t nbytes', ' unsigned int flags']
+{ 277, "sys_sync_file_range", "4884", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int fd", " loff_t offset", " loff_t nbytes", " unsigned int flags"}, 0 },
+// 278 long sys_vmsplice ['int fd', ' const struct iovec __user *iov', 'unsigned long nr_segs', ' unsigned int flags']
+{ 278, "sys_vmsplice", "4p44", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int fd", " const struct iovec __user *iov", "unsigned long nr_segs", " unsigned int flags"}, 0 },
+// 279 long sys_move_pages ['pid_t pid', ' unsigned long nr_pages', 'const void __user * __user *pages', 'const int __user *nodes', 'int __user *status', 'int flags']
+{ 279, "sys_move_pages", "44ppp4", {7, 6, 2, 10, 8, 9}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"pid_t pid", " unsigned long nr_pages", "const void __user * __user *pages", "const int __user *nodes", "int __user *status", "int flags"}, 0 },
+// 280 long sys_utimensat ['int dfd', ' char __user *filename', 'struct timespec __user *utimes', ' int flags']
+{ 280, "sys_utimensat", "4sp4", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int dfd", " char __user *filename", "struct timespec __user *utimes", " int flags"}, 0 },
+// 281 long sys_epoll_pwait ['int epfd', ' struct epoll_event __user *events', ' int maxevents', ' int timeout', ' const sigset_t __user *sigmask', ' size_t sigsetsize']
+{ 281, "sys_epoll_pwait", "4p44p4", {7, 6, 2, 10, 8, 9}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"int epfd", " struct epoll_event __user *events", " int maxevents", " int timeout", " const sigset_t __user *sigmask", " size_t sigsetsize"}, 0 },
+// 282 long sys_signalfd ['int ufd', ' sigset_t __user *user_mask', ' size_t sizemask']
+{ 282, "sys_signalfd", "4p4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int ufd", " sigset_t __user *user_mask", " size_t sizemask"}, 0 },
+// 283 long sys_timerfd_create ['int clockid', ' int flags']
+{ 283, "sys_timerfd_create", "44", {7, 6}, {0xff, 0xff}, {"int clockid", " int flags"}, 0 },
+// 284 long sys_eventfd ['unsigned int count']
+{ 284, "sys_eventfd", "4", {7}, {0xff}, {"unsigned int count"}, 0 },
+// 285 long sys_fallocate ['int fd', ' int mode', ' loff_t offset', ' loff_t len']
+{ 285, "sys_fallocate", "4488", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int fd", " int mode", " loff_t offset", " loff_t len"}, 0 },
+// 286 long sys_timerfd_settime ['int ufd', ' int flags', 'const struct itimerspec __user *utmr', 'struct itimerspec __user *otmr']
+{ 286, "sys_timerfd_settime", "44pp", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int ufd", " int flags", "const struct itimerspec __user *utmr", "struct itimerspec __user *otmr"}, 0 },
+// 287 long sys_timerfd_gettime ['int ufd', ' struct itimerspec __user *otmr']
+{ 287, "sys_timerfd_gettime", "4p", {7, 6}, {0xff, 0xff}, {"int ufd", " struct itimerspec __user *otmr"}, 0 },
+// 288 long sys_accept4 ['int fd', ' struct sockaddr __user *upeer_sockaddr', ' int __user *upeer_addrlen', ' int flags']
+{ 288, "sys_accept4", "4pp4", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int fd", " struct sockaddr __user *upeer_sockaddr", " int __user *upeer_addrlen", " int flags"}, 0 },
+// 289 long sys_signalfd4 ['int ufd', ' sigset_t __user *user_mask', ' size_t sizemask', ' int flags']
+{ 289, "sys_signalfd4", "4p44", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int ufd", " sigset_t __user *user_mask", " size_t sizemask", " int flags"}, 0 },
+// 290 long sys_eventfd2 ['unsigned int count', ' int flags']
+{ 290, "sys_eventfd2", "44", {7, 6}, {0xff, 0xff}, {"unsigned int count", " int flags"}, 0 },
+// 291 long sys_epoll_create1 ['int flags']
+{ 291, "sys_epoll_create1", "4", {7}, {0xff}, {"int flags"}, 0 },
+// 292 long sys_dup3 ['unsigned int oldfd', ' unsigned int newfd', ' int flags']
+{ 292, "sys_dup3", "444", {7, 6, 2}, {0xff, 0xff, 0xff}, {"unsigned int oldfd", " unsigned int newfd", " int flags"}, 0 },
+// 293 long sys_pipe2 ['int __user *', ' int']
+{ 293, "sys_pipe2", "p4", {7, 6}, {0xff, 0xff}, {"int __user *", " int"}, 0 },
+// 294 long sys_inotify_init1 ['int flags']
+{ 294, "sys_inotify_init1", "4", {7}, {0xff}, {"int flags"}, 0 },
+// 295 long sys_preadv ['unsigned long fd', ' const struct iovec __user *vec', ' unsigned long vlen', ' unsigned long pos_l', ' unsigned long pos_h']
+{ 295, "sys_preadv", "4p444", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"unsigned long fd", " const struct iovec __user *vec", " unsigned long vlen", " unsigned long pos_l", " unsigned long pos_h"}, 0 },
+// 296 long sys_pwritev ['unsigned long fd', ' const struct iovec __user *vec', ' unsigned long vlen', ' unsigned long pos_l', ' unsigned long pos_h']
+{ 296, "sys_pwritev", "4p444", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"unsigned long fd", " const struct iovec __user *vec", " unsigned long vlen", " unsigned long pos_l", " unsigned long pos_h"}, 0 },
+// 297 long sys_rt_tgsigqueueinfo ['pid_t tgid', ' pid_t pid', ' int sig', ' siginfo_t __user *uinfo']
+{ 297, "sys_rt_tgsigqueueinfo", "444p", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"pid_t tgid", " pid_t pid", " int sig", " siginfo_t __user *uinfo"}, 0 },
+// 298 long sys_perf_event_open ['struct perf_event_attr __user *attr_uptr', ' pid_t pid', ' int cpu', ' int group_fd', ' unsigned long flags']
+{ 298, "sys_perf_event_open", "p4444", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"struct perf_event_attr __user *attr_uptr", " pid_t pid", " int cpu", " int group_fd", " unsigned long flags"}, 0 },
+// 299 long sys_recvmmsg ['int fd', ' struct mmsghdr __user *msg', ' unsigned int vlen', ' unsigned flags', ' struct timespec __user *timeout']
+{ 299, "sys_recvmmsg", "4p44p", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int fd", " struct mmsghdr __user *msg", " unsigned int vlen", " unsigned flags", " struct timespec __user *timeout"}, 0 },
+// 300 long sys_fanotify_init ['unsigned int flags', ' unsigned int event_f_flags']
+{ 300, "sys_fanotify_init", "44", {7, 6}, {0xff, 0xff}, {"unsigned int flags", " unsigned int event_f_flags"}, 0 },
+// 301 long sys_fanotify_mark ['int fanotify_fd', ' unsigned int flags', ' u64 mask', ' int fd', ' const char __user *pathname']
+{ 301, "sys_fanotify_mark", "4484s", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int fanotify_fd", " unsigned int flags", " u64 mask", " int fd", " const char __user *pathname"}, 0 },
+// 302 long sys_prlimit64 ['pid_t pid', ' unsigned int resource', ' const struct rlimit64 __user *new_rlim', ' struct rlimit64 __user *old_rlim']
+{ 302, "sys_prlimit64", "44pp", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"pid_t pid", " unsigned int resource", " const struct rlimit64 __user *new_rlim", " struct rlimit64 __user *old_rlim"}, 0 },
+// 303 long sys_name_to_handle_at ['int dfd', ' const char __user *name', ' struct file_handle __user *handle', ' int __user *mnt_id', ' int flag']
+{ 303, "sys_name_to_handle_at", "4spp4", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int dfd", " const char __user *name", " struct file_handle __user *handle", " int __user *mnt_id", " int flag"}, 0 },
+// 304 long sys_open_by_handle_at ['int mountdirfd', ' struct file_handle __user *handle', ' int flags']
+{ 304, "sys_open_by_handle_at", "4p4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int mountdirfd", " struct file_handle __user *handle", " int flags"}, 0 },
+// 305 long sys_clock_adjtime ['clockid_t which_clock', ' struct timex __user *tx']
+{ 305, "sys_clock_adjtime", "4p", {7, 6}, {0xff, 0xff}, {"clockid_t which_clock", " struct timex __user *tx"}, 0 },
+// 306 long sys_syncfs ['int fd']
+{ 306, "sys_syncfs", "4", {7}, {0xff}, {"int fd"}, 0 },
+// 307 long sys_sendmmsg ['int fd', ' struct mmsghdr __user *msg', ' unsigned int vlen', ' unsigned flags']
+{ 307, "sys_sendmmsg", "4p44", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int fd", " struct mmsghdr __user *msg", " unsigned int vlen", " unsigned flags"}, 0 },
+// 308 long sys_setns ['int fd', ' int nstype']
+{ 308, "sys_setns", "44", {7, 6}, {0xff, 0xff}, {"int fd", " int nstype"}, 0 },
+// 309 long sys_getcpu ['unsigned __user *cpu', ' unsigned __user *node', ' struct getcpu_cache __user *cache']
+{ 309, "sys_getcpu", "ppp", {7, 6, 2}, {0xff, 0xff, 0xff}, {"unsigned __user *cpu", " unsigned __user *node", " struct getcpu_cache __user *cache"}, 0 },
+// 310 long sys_process_vm_readv ['pid_t pid', ' const struct iovec __user *lvec', ' unsigned long liovcnt', ' const struct iovec __user *rvec', ' unsigned long riovcnt', ' unsigned long flags']
+{ 310, "sys_process_vm_readv", "4p4p44", {7, 6, 2, 10, 8, 9}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"pid_t pid", " const struct iovec __user *lvec", " unsigned long liovcnt", " const struct iovec __user *rvec", " unsigned long riovcnt", " unsigned long flags"}, 0 },
+// 311 long sys_process_vm_writev ['pid_t pid', ' const struct iovec __user *lvec', ' unsigned long liovcnt', ' const struct iovec __user *rvec', ' unsigned long riovcnt', ' unsigned long flags']
+{ 311, "sys_process_vm_writev", "4p4p44", {7, 6, 2, 10, 8, 9}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"pid_t pid", " const struct iovec __user *lvec", " unsigned long liovcnt", " const struct iovec __user *rvec", " unsigned long riovcnt", " unsigned long flags"}, 0 },
+// 312 long sys_kcmp ['pid_t pid1', ' pid_t pid2', ' int type', ' unsigned long idx1', ' unsigned long idx2']
+{ 312, "sys_kcmp", "44444", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"pid_t pid1", " pid_t pid2", " int type", " unsigned long idx1", " unsigned long idx2"}, 0 },
+// 313 long sys_finit_module ['int fd', ' const char __user *uargs', ' int flags']
+{ 313, "sys_finit_module", "4s4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int fd", " const char __user *uargs", " int flags"}, 0 },
+// 314 long sys_sched_setattr ['pid_t pid', ' struct sched_attr __user *attr', ' unsigned int flags']
+{ 314, "sys_sched_setattr", "4p4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"pid_t pid", " struct sched_attr __user *attr", " unsigned int flags"}, 0 },
+// 315 long sys_sched_getattr ['pid_t pid', ' struct sched_attr __user *attr', ' unsigned int size', ' unsigned int flags']
+{ 315, "sys_sched_getattr", "4p44", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"pid_t pid", " struct sched_attr __user *attr", " unsigned int size", " unsigned int flags"}, 0 },
+// 316 long sys_renameat2 ['int olddfd', ' const char __user *oldname', ' int newdfd', ' const char __user *newname', ' unsigned int flags']
+{ 316, "sys_renameat2", "4s4s4", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int olddfd", " const char __user *oldname", " int newdfd", " const char __user *newname", " unsigned int flags"}, 0 },
+// 317 long sys_seccomp ['unsigned int op', ' unsigned int flags', ' void __user *uargs']
+{ 317, "sys_seccomp", "44p", {7, 6, 2}, {0xff, 0xff, 0xff}, {"unsigned int op", " unsigned int flags", " void __user *uargs"}, 0 },
+// 318 long sys_getrandom ['char __user *buf', ' size_t count', ' unsigned int flags']
+{ 318, "sys_getrandom", "p44", {7, 6, 2}, {0xff, 0xff, 0xff}, {"char __user *buf", " size_t count", " unsigned int flags"}, 0 },
+// 319 long sys_memfd_create ['const char __user *uname_ptr', ' unsigned int flags']
+{ 319, "sys_memfd_create", "s4", {7, 6}, {0xff, 0xff}, {"const char __user *uname_ptr", " unsigned int flags"}, 0 },
+// 320 long sys_kexec_file_load ['int kernel_fd', ' int initrd_fd', ' unsigned long cmdline_len', ' const char __user *cmdline_ptr', ' unsigned long flags']
+{ 320, "sys_kexec_file_load", "444s4", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int kernel_fd", " int initrd_fd", " unsigned long cmdline_len", " const char __user *cmdline_ptr", " unsigned long flags"}, 0 },
+// 321 long sys_bpf ['int cmd', ' union bpf_attr __user *attr', ' unsigned int size']
+{ 321, "sys_bpf", "4p4", {7, 6, 2}, {0xff, 0xff, 0xff}, {"int cmd", " union bpf_attr __user *attr", " unsigned int size"}, 0 },
+// 322 long sys_execveat ['int dfd', ' const char __user *filename', ' char *const argv[]', ' char *const envp[]', ' int flags']
+{ 322, "sys_execveat", "4spp4", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int dfd", " const char __user *filename", " char *const argv[]", " char *const envp[]", " int flags"}, 0 },
+// 323 long sys_userfaultfd ['int flags']
+{ 323, "sys_userfaultfd", "4", {7}, {0xff}, {"int flags"}, 0 },
+// 324 long sys_membarrier ['int cmd', ' int flags']
+{ 324, "sys_membarrier", "44", {7, 6}, {0xff, 0xff}, {"int cmd", " int flags"}, 0 },
+// 325 long sys_mlock2 ['unsigned long start', ' size_t len', ' int flags']
+{ 325, "sys_mlock2", "444", {7, 6, 2}, {0xff, 0xff, 0xff}, {"unsigned long start", " size_t len", " int flags"}, 0 },
+// 326 long sys_copy_file_range ['int fd_in', ' loff_t __user *off_in', ' int fd_out', ' loff_t __user *off_out', ' size_t len', ' unsigned int flags']
+{ 326, "sys_copy_file_range", "4p4p44", {7, 6, 2, 10, 8, 9}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"int fd_in", " loff_t __user *off_in", " int fd_out", " loff_t __user *off_out", " size_t len", " unsigned int flags"}, 0 },
+// 327 long sys_preadv2 ['unsigned long fd', ' const struct iovec __user *vec', ' unsigned long vlen', ' unsigned long pos_l', ' unsigned long pos_h', ' int flags']
+{ 327, "sys_preadv2", "4p4444", {7, 6, 2, 10, 8, 9}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"unsigned long fd", " const struct iovec __user *vec", " unsigned long vlen", " unsigned long pos_l", " unsigned long pos_h", " int flags"}, 0 },
+// 328 long sys_pwritev2 ['unsigned long fd', ' const struct iovec __user *vec', ' unsigned long vlen', ' unsigned long pos_l', ' unsigned long pos_h', ' int flags']
+{ 328, "sys_pwritev2", "4p4444", {7, 6, 2, 10, 8, 9}, {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}, {"unsigned long fd", " const struct iovec __user *vec", " unsigned long vlen", " unsigned long pos_l", " unsigned long pos_h", " int flags"}, 0 },
+// 329 long sys_pkey_mprotect ['unsigned long start', ' size_t len', ' unsigned long prot', ' int pkey']
+{ 329, "sys_pkey_mprotect", "4444", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"unsigned long start", " size_t len", " unsigned long prot", " int pkey"}, 0 },
+// 330 long sys_pkey_alloc ['unsigned long flags', ' unsigned long init_val']
+{ 330, "sys_pkey_alloc", "44", {7, 6}, {0xff, 0xff}, {"unsigned long flags", " unsigned long init_val"}, 0 },
+// 331 long sys_pkey_free ['int pkey']
+{ 331, "sys_pkey_free", "4", {7}, {0xff}, {"int pkey"}, 0 },
+// 332 long sys_statx ['int dfd', ' const char __user *path', ' unsigned flags', ' unsigned mask', ' struct statx __user *buffer']
+{ 332, "sys_statx", "4s44p", {7, 6, 2, 10, 8}, {0xff, 0xff, 0xff, 0xff, 0xff}, {"int dfd", " const char __user *path", " unsigned flags", " unsigned mask", " struct statx __user *buffer"}, 0 },
+// 333 long sys_io_pgetevents ['']
+{ 333, "sys_io_pgetevents", "", {}, {}, {}, 0 },
+// 334 long sys_rseq ['struct rseq __user *rseq', ' u32 rseq_len', ' int flags', ' u32 sig']
+{ 334, "sys_rseq", "p444", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"struct rseq __user *rseq", " u32 rseq_len", " int flags", " u32 sig"}, 0 },
+// 424 long sys_pidfd_send_signal ['int pidfd', ' int sig', ' siginfo_t __user *info', ' unsigned int flags']
+{ 424, "sys_pidfd_send_signal", "44p4", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int pidfd", " int sig", " siginfo_t __user *info", " unsigned int flags"}, 0 },
+// 425 long sys_io_uring_setup ['']
+{ 425, "sys_io_uring_setup", "", {}, {}, {}, 0 },
+// 426 long sys_io_uring_enter ['']
+{ 426, "sys_io_uring_enter", "", {}, {}, {}, 0 },
+// 427 long sys_io_uring_register ['']
+{ 427, "sys_io_uring_register", "", {}, {}, {}, 0 },
+// 428 long sys_open_tree ['']
+{ 428, "sys_open_tree", "", {}, {}, {}, 0 },
+// 429 long sys_move_mount ['']
+{ 429, "sys_move_mount", "", {}, {}, {}, 0 },
+// 430 long sys_fsopen ['']
+{ 430, "sys_fsopen", "", {}, {}, {}, 0 },
+// 431 long sys_fsconfig ['']
+{ 431, "sys_fsconfig", "", {}, {}, {}, 0 },
+// 432 long sys_fsmount ['']
+{ 432, "sys_fsmount", "", {}, {}, {}, 0 },
+// 433 long sys_fspick ['']
+{ 433, "sys_fspick", "", {}, {}, {}, 0 },
+// 434 long sys_pidfd_open ['pid_t pid', ' unsigned int flags']
+{ 434, "sys_pidfd_open", "44", {7, 6}, {0xff, 0xff}, {"pid_t pid", " unsigned int flags"}, 0 },
+// 435 long sys_clone3 ['struct clone_args __user *uargs', ' size_t size']
+{ 435, "sys_clone3", "p4", {7, 6}, {0xff, 0xff}, {"struct clone_args __user *uargs", " size_t size"}, 0 },
+// 436 long sys_close_range ['unsigned int fd', ' unsigned int max_fd', ' unsigned int flags']
+{ 436, "sys_close_range", "444", {7, 6, 2}, {0xff, 0xff, 0xff}, {"unsigned int fd", " unsigned int max_fd", " unsigned int flags"}, 0 },
+// 437 long sys_openat2 ['int dfd', ' const char __user *filename', ' struct open_how __user *how', ' size_t size']
+{ 437, "sys_openat2", "4sp4", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int dfd", " const char __user *filename", " struct open_how __user *how", " size_t size"}, 0 },
+// 438 long sys_pidfd_getfd ['']
+{ 438, "sys_pidfd_getfd", "", {}, {}, {}, 0 },
+// 439 long sys_faccessat2 ['int dfd', ' const char __user *filename', ' int mode', ' int flags']
+{ 439, "sys_faccessat2", "4s44", {7, 6, 2, 10}, {0xff, 0xff, 0xff, 0xff}, {"int dfd", " const char __user *filename", " int mode", " int flags"}, 0 },
+// 440 long sys_process_madvise ['']
+{ 440, "sys_process_madvise", "", {}, {}, {}, 0 },
+// 441 long sys_epoll_pwait2 ['']
+{ 441, "sys_epoll_pwait2", "", {}, {}, {}, 0 },
+// 442 long sys_mount_setattr ['']
+{ 442, "sys_mount_setattr", "", {}, {}, {}, 0 },
+// 443 long sys_quotactl_fd ['']
+{ 443, "sys_quotactl_fd", "", {}, {}, {}, 0 },
+// 444 long sys_landlock_create_ruleset ['']
+{ 444, "sys_landlock_create_ruleset", "", {}, {}, {}, 0 },
+// 445 long sys_landlock_add_rule ['']
+{ 445, "sys_landlock_add_rule", "", {}, {}, {}, 0 },
+// 446 long sys_landlock_restrict_self ['']
+{ 446, "sys_landlock_restrict_self", "", {}, {}, {}, 0 },
+// 447 long sys_memfd_secret ['']
+{ 447, "sys_memfd_secret", "", {}, {}, {}, 0 },
+// 448 long sys_process_mrelease ['']
+{ 448, "sys_process_mrelease", "", {}, {}, {}, 0 },
+// 449 long sys_futex_waitv ['']
+{ 449, "sys_futex_waitv", "", {}, {}, {}, 0 },
+// 450 long sys_set_mempolicy_home_node ['']
+{ 450, "sys_set_mempolicy_home_node", "", {}, {}, {}, 0 },
+};
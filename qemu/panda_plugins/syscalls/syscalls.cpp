@@ -24,19 +24,33 @@ extern "C"{
 #include <stdio.h>
 #include <stdlib.h>
 }
-#include <functional>
+#include <string.h>
 #include <string>
 #include <list>
+#include <vector>
+#include <unordered_map>
 #include <algorithm>
+#include <atomic>
+#include <thread>
+#include <chrono>
 
+#include "syscalls_trace.h"
+
+int before_translate_callback(CPUState *env, target_ulong pc);
 bool translate_callback(CPUState *env, target_ulong pc);
 int exec_callback(CPUState *env, target_ulong pc);
 extern "C" {
 bool init_plugin(void *);
 void uninit_plugin(void *);
 }
-// This is where we'll write out the syscall data
+// This is where we'll write out the syscall data (see syscalls_trace.h).
+// Set with -panda-arg syscalls:file=<path>.
 FILE *plugin_log;
+const char *plugin_log_path = "syscalls.bin";
+
+// Decode arguments using the Linux syscall tables. With
+// -panda-arg syscalls:os=windows only the call number is recorded.
+bool linux_syscalls = true;
 
 std::vector<target_ulong> relevant_ASIDs;
 
@@ -69,21 +83,85 @@ static inline target_ulong get_asid(CPUState *env, target_ulong addr) {
 #endif
 }
 
-// Check if the instruction is sysenter (0F 34)
+// Guest code for the block being translated. translate_callback runs for
+// every instruction, so instead of copying each one out of guest memory it
+// borrows the host page the code is on, looked up once per page per block.
+struct code_window {
+    bool valid;
+    target_ulong page;
+    const uint8_t *host;    // NULL if the page isn't RAM
+};
+static code_window cur_code;
+
+int before_translate_callback(CPUState *env, target_ulong pc) {
+    cur_code.valid = false;
+    return 0;
+}
+
+// Returns n bytes of guest code at pc, or NULL if they can't be read.
+// Instructions that cross a page, or aren't in RAM, are copied into copy.
+static const uint8_t *code_bytes(CPUState *env, target_ulong pc, int n, uint8_t *copy) {
+    target_ulong page = pc & TARGET_PAGE_MASK;
+    if (!cur_code.valid || cur_code.page != page) {
+        cur_code.page = page;
+        cur_code.host = panda_virt_to_host(env, page, TARGET_PAGE_SIZE);
+        cur_code.valid = true;
+    }
+    if (cur_code.host && (pc - page) + n <= TARGET_PAGE_SIZE) {
+        return cur_code.host + (pc - page);
+    }
+    if (panda_virtual_memory_rw(env, pc, copy, n, 0) < 0) {
+        return NULL;
+    }
+    return copy;
+}
+
+#ifdef TARGET_I386
+enum x86_syscall_insn {
+    X86_NOT_SYSCALL,
+    X86_SYSENTER,   // 0F 34
+    X86_INT80,      // CD 80
+    X86_SYSCALL,    // 0F 05
+};
+
+static x86_syscall_insn x86_classify(const uint8_t *buf) {
+    if (buf[0] == 0x0F && buf[1] == 0x34) return X86_SYSENTER;
+#ifdef TARGET_X86_64
+    if (buf[0] == 0x0F && buf[1] == 0x05) return X86_SYSCALL;
+#endif
+    // Linux only
+    if (linux_syscalls && buf[0] == 0xCD && buf[1] == 0x80) return X86_INT80;
+    return X86_NOT_SYSCALL;
+}
+
+// Which kind of syscall instruction is at each pc translate_callback
+// accepted, so exec_callback doesn't have to read the guest code again.
+// Entries are never removed: a TB only calls exec_callback for pcs that
+// were syscalls when it was translated. Keyed by virtual pc, so processes
+// with different syscall instructions at the same address share whichever
+// was translated last.
+static std::unordered_map<target_ulong, x86_syscall_insn> x86_insns;
+#endif
+
+// Check if the instruction is a system call: sysenter, int 0x80 or syscall
+// on x86, swi on ARM
 bool translate_callback(CPUState *env, target_ulong pc) {
 #ifdef TARGET_I386
-    unsigned char buf[2];
-    panda_virtual_memory_rw(env, pc, buf, 2, 0);
-    if (buf[0]== 0x0F && buf[1] == 0x34)
-        return true;
-    else
-        return false;
+    uint8_t copy[2];
+    const uint8_t *buf = code_bytes(env, pc, 2, copy);
+    if (!buf) return false;
+    x86_syscall_insn insn = x86_classify(buf);
+    if (insn == X86_NOT_SYSCALL) return false;
+    x86_insns[pc] = insn;
+    return true;
 #elif defined(TARGET_ARM)
-    unsigned char buf[4];
+    uint8_t copy[4];
+    const uint8_t *buf;
 
     // Check for ARM mode syscall
     if(env->thumb == 0){
-        panda_virtual_memory_rw(env, pc, buf, 4, 0);
+        buf = code_bytes(env, pc, 4, copy);
+        if (!buf) return false;
 	// EABI
         if( ((buf[3] & 0x0F) ==  0x0F)  && (buf[2] == 0) && (buf[1] == 0) && (buf[0] == 0) ){
 	  //if( (buf[3] ==  0xEF) ){
@@ -94,7 +172,8 @@ bool translate_callback(CPUState *env, target_ulong pc) {
 #endif
 	}
     } else { 
-      panda_virtual_memory_rw(env, pc, buf, 2, 0);
+      buf = code_bytes(env, pc, 2, copy);
+      if (!buf) return false;
     // check for Thumb mode syscall
       if (buf[1] == 0xDF && buf[0] == 0){
         return true;
@@ -107,11 +186,42 @@ bool translate_callback(CPUState *env, target_ulong pc) {
 
 typedef std::pair<target_ulong, target_ulong> ReturnPoint;
 
-static std::list<ReturnPoint> fork_returns;
-static std::list<ReturnPoint> exec_returns;
-static std::list<ReturnPoint> clone_returns;
+struct ReturnPointHash {
+    size_t operator()(const ReturnPoint &p) const {
+        return (uint64_t)p.first * 0x9e3779b97f4a7c15ULL ^ p.second;
+    }
+};
+
+// Outstanding returns from fork, exec, clone and mmap, counted per key.
+// returned_check_callback runs before every block, so they are indexed by
+// exactly what it matches on: (return PC, ASID) for fork and mmap, ASID
+// for exec (the first user mode block in the new image) and return PC for
+// clone. pending_returns is the total over all of them, so the check is a
+// single branch when nothing is outstanding.
+static std::unordered_map<ReturnPoint, int, ReturnPointHash> fork_returns;
+static std::unordered_map<target_ulong, int> exec_returns;
+static std::unordered_map<target_ulong, int> clone_returns;
+static std::unordered_map<ReturnPoint, int, ReturnPointHash> mmap_returns;
+static size_t pending_returns = 0;
+
+template <typename M, typename K>
+static inline void add_pending_return(M &returns, const K &key) {
+    returns[key]++;
+    pending_returns++;
+}
+
+// Removes the returns pending at key and says how many there were
+template <typename M, typename K>
+static inline int take_pending_returns(M &returns, const K &key) {
+    auto it = returns.find(key);
+    if (it == returns.end()) return 0;
+    int n = it->second;
+    returns.erase(it);
+    pending_returns -= n;
+    return n;
+}
+
 static std::list<ReturnPoint> prctl_returns;
-static std::list<ReturnPoint> mmap_returns;
 #if defined(TARGET_ARM)
 static void call_fork_callback(CPUState *env, target_ulong pc){
     uint8_t offset = 0;
@@ -121,18 +231,11 @@ static void call_fork_callback(CPUState *env, target_ulong pc){
         offset = 2;
     }
     // pc + offset or env->regs[14] ?
-    fork_returns.push_back(std::make_pair(pc + offset, get_asid(env, pc)));
+    add_pending_return(fork_returns, ReturnPoint(pc + offset, get_asid(env, pc)));
 }
 
 static void call_exec_callback(CPUState *env, target_ulong pc){
-    uint8_t offset = 0;
-    if(env->thumb == 0){
-        offset = 4;
-    } else {
-        offset = 2;
-    }
-    exec_returns.push_back(std::make_pair(pc+offset,  get_asid(env, pc)));
-    //exec_returns.push_back(std::make_pair(env->regs[14], get_asid(env, pc)));
+    add_pending_return(exec_returns, get_asid(env, pc));
 }
 
 static void call_clone_callback(CPUState *env, target_ulong pc){
@@ -142,7 +245,7 @@ static void call_clone_callback(CPUState *env, target_ulong pc){
     } else {
         offset = 2;
     }
-    clone_returns.push_back(std::make_pair(env->regs[14], get_asid(env, pc)));
+    add_pending_return(clone_returns, env->regs[14]);
 }
 
 static void call_prctl_callback(CPUState *env, target_ulong pc){
@@ -162,7 +265,7 @@ static void call_mmap_callback(CPUState *env, target_ulong pc){
     } else {
         offset = 2;
     }
-    mmap_returns.push_back(std::make_pair(env->regs[14], get_asid(env, pc)));
+    add_pending_return(mmap_returns, ReturnPoint(env->regs[14], get_asid(env, pc)));
 }
 
 #endif //TARGET_ARM
@@ -178,62 +281,296 @@ static inline bool in_kernelspace(CPUState *env) {
 }
 
 static int returned_check_callback(CPUState *env, TranslationBlock *tb){
+    if (!pending_returns) return 0;
 #if defined(CONFIG_PANDA_VMI)
     panda_cb_list *plist;
-    for(auto& retVal :fork_returns){
-        if (retVal.first == tb->pc && retVal.second == get_asid(env, tb->pc)){
-           // we returned from fork
-           for(plist = panda_cbs[PANDA_CB_VMI_AFTER_FORK]; plist != NULL; plist = plist->next) {
-                plist->entry.return_from_fork(env);
-            }
-           // set to 0,0 so we can remove after we finish iterating
-           retVal.first = retVal.second = 0;
+    target_ulong asid = get_asid(env, tb->pc);
+    int n;
+
+    // we returned from fork
+    n = take_pending_returns(fork_returns, ReturnPoint(tb->pc, asid));
+    while (n--) {
+        for(plist = panda_cbs[PANDA_CB_VMI_AFTER_FORK]; plist != NULL; plist = plist->next) {
+            plist->entry.return_from_fork(env);
         }
     }
-    fork_returns.remove(std::make_pair<target_ulong, target_ulong>(0,0));
-    for(auto& retVal :exec_returns){
-        if(retVal.second == get_asid(env, tb->pc) && !in_kernelspace(env)){
-        //if (retVal.first == tb->pc /*&& retVal.second == get_asid(env, tb->pc)*/){
-           // we returned from fork
-           for(plist = panda_cbs[PANDA_CB_VMI_AFTER_EXEC]; plist != NULL; plist = plist->next) {
+    // we returned from exec
+    if (!exec_returns.empty() && !in_kernelspace(env)) {
+        n = take_pending_returns(exec_returns, asid);
+        while (n--) {
+            for(plist = panda_cbs[PANDA_CB_VMI_AFTER_EXEC]; plist != NULL; plist = plist->next) {
                 plist->entry.return_from_exec(env);
             }
-           // set to 0,0 so we can remove after we finish iterating
-           retVal.first = retVal.second = 0;
         }
     }
-    exec_returns.remove(std::make_pair<target_ulong, target_ulong>(0,0));
-    for(auto& retVal :clone_returns){
-        if (retVal.first == tb->pc /*&& retVal.second == get_asid(env, tb->pc)*/){
-           // we returned from fork
-           for(plist = panda_cbs[PANDA_CB_VMI_AFTER_CLONE]; plist != NULL; plist = plist->next) {
-                plist->entry.return_from_clone(env);
-            }
-           // set to 0,0 so we can remove after we finish iterating
-           retVal.first = retVal.second = 0;
+    // we returned from clone
+    n = take_pending_returns(clone_returns, tb->pc);
+    while (n--) {
+        for(plist = panda_cbs[PANDA_CB_VMI_AFTER_CLONE]; plist != NULL; plist = plist->next) {
+            plist->entry.return_from_clone(env);
+        }
+    }
+    // we returned from mmap
+    n = take_pending_returns(mmap_returns, ReturnPoint(tb->pc, asid));
+    while (n--) {
+        for(plist = panda_cbs[PANDA_CB_VMI_AFTER_MMAP]; plist != NULL; plist = plist->next) {
+            plist->entry.return_from_mmap(env);
         }
     }
-    clone_returns.remove(std::make_pair<target_ulong, target_ulong>(0,0));
 #else
     fork_returns.clear();
     exec_returns.clear();
     clone_returns.clear();
+    mmap_returns.clear();
+    pending_returns = 0;
 #endif
     return 0;
 }
 
 
-//void record_syscall(const char* callname);
-void finish_syscall(){}
-//void log_string(target_ulong src, const char* argname);
-//void log_pointer(target_ulong addr, const char* argname);
-//void log_32(target_ulong value, const char* argname);
-//void log64(target_ulong high, target_ulong low, const char* argname){}
-std::function<void (const char*)> record_syscall;
-std::function<void (target_ulong, const char*)> log_string;
-std::function<void (target_ulong, const char*)> log_pointer;
-std::function<void (target_ulong, const char*)> log_32;
-std::function<void (target_ulong, target_ulong, const char*)> log_64;
+// Syscall prototypes, generated by android_syscall_parser.py. argtypes
+// has one SYSCALL_ARG_* character per argument, and argregs gives the
+// register it is passed in. A 64 bit argument passed in a pair of
+// registers has its low half in argregs and its high half in argregs_hi;
+// otherwise argregs_hi is SYSCALL_NO_REG.
+#define SYSCALL_MAX_ARGS 8
+#define SYSCALL_NO_REG 0xff
+
+// VMI callbacks to set up when the syscall is made
+#define SYSCALL_CB_FORK  1
+#define SYSCALL_CB_EXEC  2
+#define SYSCALL_CB_CLONE 4
+#define SYSCALL_CB_MMAP  8
+#define SYSCALL_CB_PRCTL 16
+
+struct syscall_prototype {
+    uint32_t callno;
+    const char *name;
+    const char *argtypes;
+    uint8_t argregs[SYSCALL_MAX_ARGS];
+    uint8_t argregs_hi[SYSCALL_MAX_ARGS];
+    const char *argnames[SYSCALL_MAX_ARGS];
+    int callbacks;
+};
+
+// The prototype tables for each ABI, indexed by SYSCALL_ABI_*. On x86_64,
+// 32 bit processes (and anything else using int 0x80 or sysenter) use the
+// i386 calls, with the i386 numbers.
+struct syscall_table {
+    const syscall_prototype *prototypes;
+    size_t count;
+};
+
+#if defined(TARGET_ARM)
+#include "syscall_table_arm.h"
+static const syscall_table syscall_tables[] = {
+    { syscall_prototypes_arm, ARRAY_SIZE(syscall_prototypes_arm) },
+};
+#elif defined(TARGET_X86_64)
+#include "syscall_table_x86_64.h"
+#include "syscall_table_x86.h"
+static const syscall_table syscall_tables[] = {
+    { syscall_prototypes_x86_64, ARRAY_SIZE(syscall_prototypes_x86_64) },
+    { syscall_prototypes_x86, ARRAY_SIZE(syscall_prototypes_x86) },
+};
+#elif defined(TARGET_I386)
+#include "syscall_table_x86.h"
+static const syscall_table syscall_tables[] = {
+    { syscall_prototypes_x86, ARRAY_SIZE(syscall_prototypes_x86) },
+};
+#else
+static const syscall_table syscall_tables[] = {
+    { NULL, 0 },
+};
+#endif
+
+// Keyed on (abi << 32) | callno
+static std::unordered_map<uint64_t, const syscall_prototype *> prototypes_by_callno;
+
+static inline const syscall_prototype *find_prototype(uint32_t abi, uint32_t callno) {
+    auto it = prototypes_by_callno.find(((uint64_t)abi << 32) | callno);
+    return it == prototypes_by_callno.end() ? NULL : it->second;
+}
+
+// How the syscall being recorded was made, which decides where its
+// arguments are
+struct syscall_entry {
+    uint32_t abi;           // SYSCALL_ABI_*
+    bool sysenter;          // the 6th i386 argument is on the user stack
+};
+
+static inline uint64_t syscall_reg(CPUState *env, const syscall_entry &e, int reg) {
+#if defined(TARGET_ARM)
+    return env->regs[reg];
+#elif defined(TARGET_I386)
+    if (e.sysenter && reg == R_EBP) {
+        // The vDSO saves EBP and passes the user stack pointer in it
+        uint32_t arg6 = 0;
+        panda_virtual_memory_rw(env, env->regs[R_EBP], (uint8_t *)&arg6, 4, 0);
+        return arg6;
+    }
+    if (e.abi == SYSCALL_ABI_COMPAT32) {
+        return (uint32_t)env->regs[reg];
+    }
+    return env->regs[reg];
+#else
+    return 0;
+#endif
+}
+
+static inline uint64_t syscall_arg(CPUState *env, const syscall_entry &e,
+                                   const syscall_prototype *proto, int i) {
+    uint64_t val = syscall_reg(env, e, proto->argregs[i]);
+    if (proto->argregs_hi[i] != SYSCALL_NO_REG) {
+        val = (uint32_t)val | (syscall_reg(env, e, proto->argregs_hi[i]) << 32);
+    }
+    return val;
+}
+
+// Strings longer than this are truncated in the trace
+#define SYSCALL_TRACE_MAX_STRING 16384
+#define SYSCALL_TRACE_RING_SIZE (4 << 20)
+
+// Records are built by the CPU thread and handed to a writer thread through
+// a single producer, single consumer byte ring, so guest execution never
+// waits on the disk unless the ring fills up. In that case the producer
+// waits for the writer rather than drop syscalls.
+class trace_ring {
+public:
+    explicit trace_ring(size_t size) : buf(size), head(0), tail(0) {}
+
+    void push(const uint8_t *data, size_t len) {
+        uint64_t h = head.load(std::memory_order_relaxed);
+        while (h + len - tail.load(std::memory_order_acquire) > buf.size()) {
+            std::this_thread::yield();
+        }
+        size_t off = h % buf.size();
+        size_t first = std::min(len, buf.size() - off);
+        memcpy(&buf[off], data, first);
+        memcpy(&buf[0], data + first, len - first);
+        head.store(h + len, std::memory_order_release);
+    }
+
+    // Writes out everything pushed so far; returns the number of bytes
+    size_t drain(FILE *f) {
+        uint64_t t = tail.load(std::memory_order_relaxed);
+        uint64_t h = head.load(std::memory_order_acquire);
+        if (h == t) return 0;
+        size_t off = t % buf.size();
+        size_t len = h - t;
+        size_t first = std::min(len, buf.size() - off);
+        fwrite(&buf[off], 1, first, f);
+        fwrite(&buf[0], 1, len - first, f);
+        tail.store(h, std::memory_order_release);
+        return len;
+    }
+
+private:
+    std::vector<uint8_t> buf;
+    std::atomic<uint64_t> head;     // bytes pushed, written by the CPU thread
+    std::atomic<uint64_t> tail;     // bytes written out, by the writer thread
+};
+
+static trace_ring *trace;
+static std::thread trace_writer;
+static std::atomic<bool> trace_done(false);
+
+static void write_trace(void) {
+    while (true) {
+        bool stop = trace_done.load(std::memory_order_acquire);
+        if (trace->drain(plugin_log) == 0) {
+            if (stop) break;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    fflush(plugin_log);
+}
+
+// The record being built; reused so the common case doesn't allocate
+static std::vector<uint8_t> record_buf;
+
+template <typename T>
+static inline void record_put(const T &v) {
+    const uint8_t *p = (const uint8_t *)&v;
+    record_buf.insert(record_buf.end(), p, p + sizeof(T));
+}
+
+static void record_string(CPUState *env, target_ulong src) {
+    size_t lenpos = record_buf.size();
+    uint32_t total = 0;
+    char buff[TARGET_PAGE_SIZE];
+    record_put(total);
+    while (total < SYSCALL_TRACE_MAX_STRING) {
+        // keep reading pages until the string terminates, borrowing the
+        // guest page directly when it is RAM instead of copying it
+        unsigned int len = TARGET_PAGE_SIZE - (src & ~TARGET_PAGE_MASK);
+        const char *page = (const char *)panda_virt_to_host(env, src, len);
+        if (!page) {
+            if (panda_virtual_memory_rw(env, src, (uint8_t *)buff, len, 0) < 0) {
+                break; // not mapped
+            }
+            page = buff;
+        }
+        const char *end = (const char *)memchr(page, 0, len);
+        size_t n = end ? end - page : len;
+        n = std::min(n, (size_t)(SYSCALL_TRACE_MAX_STRING - total));
+        record_buf.insert(record_buf.end(), page, page + n);
+        total += n;
+        if (end) break;
+        src += len;
+    }
+    memcpy(&record_buf[lenpos], &total, sizeof(total));
+}
+
+static void record_syscall(CPUState *env, target_ulong pc, uint32_t callno,
+                           const syscall_entry &e, const syscall_prototype *proto,
+                           uint16_t flags) {
+    syscall_trace_record rec = {};
+    rec.callno = callno;
+    rec.pc = pc;
+    rec.asid = get_asid(env, pc);
+    rec.flags = flags;
+    rec.abi = e.abi;
+    rec.nargs = proto ? strlen(proto->argtypes) : 0;
+
+    record_buf.clear();
+    record_put(rec);
+    for (uint32_t i = 0; i < rec.nargs; i++) {
+        uint64_t val = syscall_arg(env, e, proto, i);
+        if (proto->argtypes[i] == SYSCALL_ARG_STRING) {
+            record_string(env, val);
+        }
+        else {
+            record_put(val);
+        }
+    }
+    rec.len = record_buf.size();
+    memcpy(&record_buf[0], &rec.len, sizeof(rec.len));
+    trace->push(&record_buf[0], record_buf.size());
+}
+
+static bool write_trace_header(FILE *f) {
+    syscall_trace_header hdr;
+    memcpy(hdr.magic, SYSCALL_TRACE_MAGIC, sizeof(hdr.magic));
+    hdr.version = SYSCALL_TRACE_VERSION;
+    hdr.target_ulong_size = sizeof(target_ulong);
+    hdr.nprototypes = prototypes_by_callno.size();
+    fwrite(&hdr, sizeof(hdr), 1, f);
+    for (auto &it : prototypes_by_callno) {
+        const syscall_prototype &p = *it.second;
+        uint32_t abi = it.first >> 32;
+        uint32_t nargs = strlen(p.argtypes);
+        fwrite(&abi, sizeof(abi), 1, f);
+        fwrite(&p.callno, sizeof(p.callno), 1, f);
+        fwrite(&nargs, sizeof(nargs), 1, f);
+        fwrite(p.argtypes, 1, nargs, f);
+        fwrite(p.name, 1, strlen(p.name) + 1, f);
+        for (uint32_t j = 0; j < nargs; j++) {
+            fwrite(p.argnames[j], 1, strlen(p.argnames[j]) + 1, f);
+        }
+    }
+    return !ferror(f);
+}
 
 static inline bool is_watched(CPUState *env){
     target_ulong pc;
@@ -251,86 +588,65 @@ static inline bool is_watched(CPUState *env){
     return false;
 }
 
-static void syscall_fprintf(CPUState* env, const char* __format, ...){
-    if (is_watched(env)){
-        va_list va;
-        va_start(va,__format);
-        vfprintf(plugin_log, __format,va);
-        va_end(va);
-    }
-}
-
 // This will only be called for instructions where the
 // translate_callback returned true
 int exec_callback(CPUState *env, target_ulong pc) {
 #ifdef TARGET_I386
-    // On Windows, the system call id is in EAX
-    syscall_fprintf(env, "PC=" TARGET_FMT_lx ", SYSCALL=" TARGET_FMT_lx "\n", pc, env->regs[R_EAX]);
+    // The call number is in EAX (RAX). Which table it indexes depends on
+    // how the call was made, which translate_callback recorded.
+    auto it = x86_insns.find(pc);
+    if (it == x86_insns.end()) return 0;
+    x86_syscall_insn insn = it->second;
+
+    syscall_entry e = { SYSCALL_ABI_NATIVE, insn == X86_SYSENTER };
+#ifdef TARGET_X86_64
+    if (insn != X86_SYSCALL || !(env->hflags & HF_CS64_MASK)) {
+        e.abi = SYSCALL_ABI_COMPAT32;
+    }
+#endif
+    uint32_t callno = env->regs[R_EAX];
+    const syscall_prototype *proto = NULL;
+    if (linux_syscalls) {
+        proto = find_prototype(e.abi, callno);
+    }
+    else {
+        // On Windows, just the system call id
+        e.abi = SYSCALL_ABI_NATIVE;
+    }
+
+    if (is_watched(env))
+        record_syscall(env, pc, callno, e, proto, 0);
 #elif defined(TARGET_ARM)
 #if defined(CAPTURE_ARM_OABI)
-#if (1)
     if(env->thumb == 0){ //Old ABI not possible with Thumb
       // read 4 bytes, number may be in instruction.
-      unsigned char buf[4];
-      panda_virtual_memory_rw(env, pc, buf, 4, 0);
-        if (buf[2] == 0x90) {
-	fprintf(plugin_log, "PC=" TARGET_FMT_lx ", SYSCALL=" TARGET_FMT_lx ", OLD ABI \n", pc, *(unsigned int*)&buf);
-	return 0;
+      uint32_t insn;
+      panda_virtual_memory_rw(env, pc, (uint8_t *)&insn, 4, 0);
+      if (((insn >> 16) & 0xff) == 0x90) {
+        syscall_entry e = { SYSCALL_ABI_NATIVE, false };
+        record_syscall(env, pc, insn, e, NULL, 0);
+        return 0;
       }
     }
-#else
-    syscall_fprintf(env, "SKIPPING OABI\n");
-#endif
 #endif// OABI
     if (env->regs[7] == 0xf0){ //skip sys_futex
       return 0;
     }
 
-    record_syscall = [&env, &pc](const char* callname){
-      syscall_fprintf(env, "CALL=%s, PC=" TARGET_FMT_lx ", SYSCALL=" TARGET_FMT_lx ", thumb=" TARGET_FMT_lx "\n", callname, pc, env->regs[7], env->thumb);
-    };
-
-    log_string = [&env, &pc](target_ulong src, const char* argname){
-      std::string value;
-      char buff[4097];
-      buff[4096] = 0;
-      unsigned short len = 4096 - (src & 0xFFF);
-      if(len == 0) len = 4096;
-      do{
-	// keep copying pages until the string terminates
-	int ret = panda_virtual_memory_rw(env, src, (uint8_t*)buff, len, 0);
-	if(ret < 0){ // not mapped
-	  break;
-	}
-	if(strlen(buff) > len){
-
-	  value.append(buff, len);
-	  src += len;
-	  len = 4096;
-	}else {
-	  value += buff;
-	  break;
-	}
-      }while(true);
-      syscall_fprintf(env, "STR, NAME=%s, VALUE=%s\n", argname, value.c_str());
-    };
-
-    log_pointer = [&env, &pc](target_ulong addr, const char* argname){
-      syscall_fprintf(env, "PTR, NAME=%s, VALUE=" TARGET_FMT_lx"\n",argname, addr);
-    };
-
-    log_32 = [&env,&pc](target_ulong value, const char* argname){
-      syscall_fprintf(env, "I32, NAME=%s, VALUE=" TARGET_FMT_lx"\n", argname, value);
-    };
-
-    log_64 = [&env,&pc](target_ulong high, target_ulong low, const char* argname){
-      syscall_fprintf(env, "I64, NAME=%s, VALUE=%llx\n", argname, ((unsigned long long)high << 32) | low );
-    };
+    syscall_entry e = { SYSCALL_ABI_NATIVE, false };
+    const syscall_prototype *proto = find_prototype(e.abi, env->regs[7]);
 
-#include "syscall_printer.c"
+    if (is_watched(env))
+        record_syscall(env, pc, env->regs[7], e, proto,
+                       env->thumb ? SYSCALL_TRACE_THUMB : 0);
 
-    // syscall is in R7
-    //syscall_fprintf(env, "PC=" TARGET_FMT_lx ", SYSCALL=" TARGET_FMT_lx ", thumb=" TARGET_FMT_lx "\n", pc, env->regs[7], env->thumb);
+    if (proto) {
+        if (proto->callbacks & SYSCALL_CB_FORK) call_fork_callback(env, pc);
+        if (proto->callbacks & SYSCALL_CB_EXEC) call_exec_callback(env, pc);
+        if (proto->callbacks & SYSCALL_CB_CLONE) call_clone_callback(env, pc);
+        if (proto->callbacks & SYSCALL_CB_MMAP) call_mmap_callback(env, pc);
+        if (proto->callbacks & SYSCALL_CB_PRCTL) call_prctl_callback(env, pc);
+    }
 #endif
 
     return 0;
@@ -345,6 +661,8 @@ bool init_plugin(void *self) {
 #if  defined(TARGET_I386) || defined(TARGET_ARM)
     panda_cb pcb;
 
+    pcb.before_block_translate = before_translate_callback;
+    panda_register_callback(self, PANDA_CB_BEFORE_BLOCK_TRANSLATE, pcb);
     pcb.insn_translate = translate_callback;
     panda_register_callback(self, PANDA_CB_INSN_TRANSLATE, pcb);
     pcb.insn_exec = exec_callback;
@@ -353,13 +671,41 @@ bool init_plugin(void *self) {
     panda_register_callback(self, PANDA_CB_BEFORE_BLOCK_EXEC, pcb);
 #endif
 
-    plugin_log = fopen("/scratch/syscalls.txt", "w");    
-    if(!plugin_log) return false;
-    else return true;
+    for (int i = 0; i < panda_argc; i++) {
+        if (0 == strncmp(panda_argv[i], "syscalls:file=", 14)) {
+            plugin_log_path = panda_argv[i] + 14;
+        }
+        else if (0 == strcmp(panda_argv[i], "syscalls:os=windows")) {
+            linux_syscalls = false;
+        }
+    }
+
+    for (size_t abi = 0; linux_syscalls && abi < ARRAY_SIZE(syscall_tables); abi++) {
+        const syscall_table &t = syscall_tables[abi];
+        for (size_t i = 0; i < t.count; i++) {
+            prototypes_by_callno[((uint64_t)abi << 32) | t.prototypes[i].callno] =
+                &t.prototypes[i];
+        }
+    }
+
+    plugin_log = fopen(plugin_log_path, "wb");
+    if(!plugin_log) {
+        printf("Couldn't open %s for writing. Exiting.\n", plugin_log_path);
+        return false;
+    }
+    if (!write_trace_header(plugin_log)) {
+        perror("syscalls: fwrite");
+        return false;
+    }
+    trace = new trace_ring(SYSCALL_TRACE_RING_SIZE);
+    trace_writer = std::thread(write_trace);
+    return true;
 }
 
 void uninit_plugin(void *self) {
-    fflush(plugin_log);
+    trace_done.store(true, std::memory_order_release);
+    trace_writer.join();
+    delete trace;
     fclose(plugin_log);
 }
 
@@ -0,0 +1,71 @@
+/* PANDABEGINCOMMENT
+ *
+ * Authors:
+ *  Tim Leek               tleek@ll.mit.edu
+ *  Ryan Whelan            rwhelan@ll.mit.edu
+ *  Joshua Hodosh          josh.hodosh@ll.mit.edu
+ *  Michael Zhivich        mzhivich@ll.mit.edu
+ *  Brendan Dolan-Gavitt   brendandg@gatech.edu
+ *
+ * This work is licensed under the terms of the GNU GPL, version 2.
+ * See the COPYING file in the top-level directory.
+ *
+PANDAENDCOMMENT */
+#ifndef __SYSCALLS_TRACE_H__
+#define __SYSCALLS_TRACE_H__
+
+// Binary trace format written by the syscalls plugin and read by
+// panda_tools/syscalls_dump. All integers are in host byte order.
+//
+// The file starts with a syscall_trace_header, followed by nprototypes
+// prototype descriptions, so the trace can be decoded without knowing the
+// guest architecture:
+//   uint32_t abi (SYSCALL_ABI_*)
+//   uint32_t callno
+//   uint32_t nargs
+//   nargs argument type characters (SYSCALL_ARG_*)
+//   the syscall name, NUL terminated
+//   nargs argument names, each NUL terminated
+//
+// The rest of the file is a sequence of records, one per syscall: a
+// syscall_trace_record followed by nargs argument slots, typed by the
+// prototype for (abi, callno) (a call with no prototype has no arguments).
+// String slots are a uint32_t length followed by that many bytes (no
+// terminator); every other slot is a uint64_t.
+
+#include <stdint.h>
+
+#define SYSCALL_TRACE_MAGIC   "PANDASYS"
+#define SYSCALL_TRACE_VERSION 2
+
+#define SYSCALL_ARG_STRING  's'
+#define SYSCALL_ARG_POINTER 'p'
+#define SYSCALL_ARG_32      '4'
+#define SYSCALL_ARG_64      '8'
+
+// Flags in syscall_trace_record
+#define SYSCALL_TRACE_THUMB 1
+
+// Which syscall table a call number belongs to. Calls made on x86_64
+// through int 0x80 or sysenter, or from 32 bit code, are i386 calls.
+#define SYSCALL_ABI_NATIVE   0
+#define SYSCALL_ABI_COMPAT32 1
+
+struct syscall_trace_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t target_ulong_size;     // for printing addresses like the guest
+    uint32_t nprototypes;
+} __attribute__((packed));
+
+struct syscall_trace_record {
+    uint32_t len;       // whole record, including argument slots
+    uint32_t callno;
+    uint64_t pc;
+    uint64_t asid;
+    uint16_t flags;
+    uint16_t abi;
+    uint32_t nargs;
+} __attribute__((packed));
+
+#endif
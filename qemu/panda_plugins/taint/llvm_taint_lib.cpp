@@ -57,13 +57,14 @@ bool PandaTaintFunctionPass::runOnFunction(Function &F){
     // check and see if cache needs to be flushed and if so, flush
     std::map<std::string, TaintTB*>::iterator it;
     if (ttbCache->size() == 10000){
-        for (it = ttbCache->begin(); it != ttbCache->end(); it++){
+        for (it = ttbCache->begin(); it != ttbCache->end(); ){
             // don't remove helper functions from cache
             if (!strstr(it->second->name, "tcg-llvm-tb")){
+                it++;
                 continue;
             }
             taint_tb_cleanup(it->second);
-            ttbCache->erase(it);
+            ttbCache->erase(it++);
         }
     }
 
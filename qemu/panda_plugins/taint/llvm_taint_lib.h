@@ -157,9 +157,9 @@ public:
         // If we created this ttbCache, we delete it
         if (createdTtbCache){
             std::map<std::string, TaintTB*>::iterator it;
-            for (it = ttbCache->begin(); it != ttbCache->end(); it++){
+            for (it = ttbCache->begin(); it != ttbCache->end(); ){
                 taint_tb_cleanup(it->second);
-                ttbCache->erase(it);
+                ttbCache->erase(it++);
             }
             delete ttbCache;
         }
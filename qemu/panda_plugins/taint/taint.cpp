@@ -28,12 +28,16 @@ extern "C" {
 #include "panda_memlog.h"
 #include "panda_stats.h"
 
-#ifndef CONFIG_SOFTMMU
+#ifdef CONFIG_SOFTMMU
+#include "rr_log.h"
+#else
 #include "syscall_defs.h"
 #endif
 
 }
 
+#include <sys/time.h>
+
 #include "llvm/PassManager.h"
 #include "llvm/PassRegistry.h"
 #include "llvm/Analysis/Verifier.h"
@@ -43,6 +47,7 @@ extern "C" {
 
 #include "llvm_taint_lib.h"
 #include "panda_dynval_inst.h"
+#include "panda_helper_call_morph.h"
 #include "taint_processor.h"
 
 // These need to be extern "C" so that the ABI is compatible with
@@ -83,6 +88,24 @@ llvm::PandaInstrFunctionPass *PIFP;
 // Global count of taint labels
 int count = 0;
 
+// taint:start=N leaves LLVM (and taint) off until replay reaches guest
+// instruction N, so everything before the point of interest runs under TCG.
+// taint_on is set once the LLVM backend and shadow memory are set up, and
+// the blocks that follow are instrumented.
+bool taint_on = false;
+uint64_t taint_start_instr = 0;
+
+// Timing for taint:start, to report how much replay time it saved
+static double time_init;
+static double time_switch;
+static uint64_t instr_switch;
+
+static double now(){
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
 // Apply taint to a buffer of memory
 void add_taint(Shad *shad, TaintOpBuffer *tbuf, uint64_t addr, int length){
     struct addr_struct a = {};
@@ -107,6 +130,9 @@ void add_taint(Shad *shad, TaintOpBuffer *tbuf, uint64_t addr, int length){
  */
 int phys_mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
                        target_ulong size, void *buf) {
+    if (!taint_on || !panda_block_in_llvm){
+        return 0; // not instrumented, see before_block_exec
+    }
     DynValBuffer *dynval_buffer = PIFP->PIV->getDynvalBuffer();
     log_dynval(dynval_buffer, ADDRENTRY, STORE, addr);
     return 0;
@@ -114,6 +140,9 @@ int phys_mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
 
 int phys_mem_read_callback(CPUState *env, target_ulong pc, target_ulong addr,
         target_ulong size, void *buf){
+    if (!taint_on || !panda_block_in_llvm){
+        return 0; // not instrumented, see before_block_exec
+    }
     DynValBuffer *dynval_buffer = PIFP->PIV->getDynvalBuffer();
     log_dynval(dynval_buffer, ADDRENTRY, LOAD, addr);
     return 0;
@@ -152,10 +181,42 @@ static void llvm_init(){
 
 } // namespace llvm
 
+static void taint_enable();
+
 // Derive taint ops
 int before_block_exec(CPUState *env, TranslationBlock *tb){
     //printf("%s\n", tcg_llvm_get_func_name(tb));
 
+#ifdef CONFIG_SOFTMMU
+    if (!taint_on){
+        if (shadow){
+            // Set up at the previous block, which ran without taint
+            taint_on = true;
+        }
+        else if (rr_prog_point.guest_instr_count < taint_start_instr){
+            return 0;
+        }
+        else {
+            time_switch = now() - time_init;
+            instr_switch = rr_prog_point.guest_instr_count;
+            printf("taint: reached instruction %" PRIu64 " after %.2f seconds"
+                " (%.0f instructions/s under TCG), enabling taint\n",
+                instr_switch, time_switch, instr_switch / time_switch);
+            // This block's backend was picked before the switch, so it
+            // isn't instrumented; taint starts with the next one.
+            taint_enable();
+            return 0;
+        }
+    }
+#endif
+
+    // Blocks a plugin chose to run under TCG aren't instrumented, so no
+    // dynamic values are logged for them and there are no taint ops to run.
+    // Taint isn't propagated through them either.
+    if (!panda_block_in_llvm){
+        return 0;
+    }
+
     taintfpm->run(*(tb->llvm_function));
     DynValBuffer *dynval_buffer = PIFP->PIV->getDynvalBuffer();
     clear_dynval_buffer(dynval_buffer);
@@ -165,6 +226,9 @@ int before_block_exec(CPUState *env, TranslationBlock *tb){
 // Execute taint ops
 int after_block_exec(CPUState *env, TranslationBlock *tb,
         TranslationBlock *next_tb){
+    if (!taint_on || !panda_block_in_llvm){
+        return 0;
+    }
     DynValBuffer *dynval_buffer = PIFP->PIV->getDynvalBuffer();
     rewind_dynval_buffer(dynval_buffer);
 
@@ -179,6 +243,9 @@ int after_block_exec(CPUState *env, TranslationBlock *tb,
 }
 
 int cb_cpu_restore_state(CPUState *env, TranslationBlock *tb){
+    if (!taint_on || !panda_block_in_llvm){
+        return 0;
+    }
     printf("EXCEPTION - logging\n");
     DynValBuffer *dynval_buffer = PIFP->PIV->getDynvalBuffer();
     log_exception(dynval_buffer);
@@ -193,9 +260,28 @@ int cb_cpu_restore_state(CPUState *env, TranslationBlock *tb){
     return 0;
 }
 
+// The taint ops cached for a TB's LLVM function are keyed by its name, and
+// a TB lowered again gets a new one, so drop them with the function.
+int before_llvm_free(CPUState *env, TranslationBlock *tb){
+    if (!PTFP){
+        return 0;
+    }
+    std::map<std::string, TaintTB*> *ttbCache = PTFP->getTaintTBCache();
+    std::map<std::string, TaintTB*>::iterator it =
+        ttbCache->find(tb->llvm_function->getName().str());
+    if (it != ttbCache->end()){
+        if (PTFP->ttb == it->second){
+            PTFP->ttb = NULL;
+        }
+        taint_tb_cleanup(it->second);
+        ttbCache->erase(it);
+    }
+    return 0;
+}
+
 int guest_hypercall_callback(CPUState *env) {
 #ifdef TARGET_I386
-  if(env->regs[R_EAX] == 0xdeadbeef) {
+  if(taint_on && env->regs[R_EAX] == 0xdeadbeef) {
     target_ulong buf_start = env->regs[R_ECX];
     target_ulong buf_len = env->regs[R_EDX];
 
@@ -281,6 +367,9 @@ int user_after_syscall(void *cpu_env, bitmask_transtbl *fcntl_flags_tbl,
                        int num, abi_long arg1, abi_long arg2, abi_long arg3,
                        abi_long arg4, abi_long arg5, abi_long arg6,
                        abi_long arg7, abi_long arg8, void *p, abi_long ret){
+    if (!taint_on){
+        return 0;
+    }
     switch (num){
         case TARGET_NR_read:
             user_read(ret, arg1, p);
@@ -305,34 +394,33 @@ int user_after_syscall(void *cpu_env, bitmask_transtbl *fcntl_flags_tbl,
 
 #endif // CONFIG_SOFTMMU
 
-bool init_plugin(void *self) {
-    printf("Initializing taint plugin\n");
-    panda_cb pcb;
+/*
+ * Switch to the LLVM backend and set up the instrumentation and shadow memory.
+ * Called at init, or at the taint:start point.
+ */
+static void taint_enable(){
     panda_enable_memcb();
     panda_disable_tb_chaining();
-    pcb.before_block_exec = before_block_exec;
-    panda_register_callback(self, PANDA_CB_BEFORE_BLOCK_EXEC, pcb);
-    pcb.after_block_exec = after_block_exec;
-    panda_register_callback(self, PANDA_CB_AFTER_BLOCK_EXEC, pcb);
-    pcb.phys_mem_read = phys_mem_read_callback;
-    panda_register_callback(self, PANDA_CB_PHYS_MEM_READ, pcb);
-    pcb.phys_mem_write = phys_mem_write_callback;
-    panda_register_callback(self, PANDA_CB_PHYS_MEM_WRITE, pcb);
-    pcb.cb_cpu_restore_state = cb_cpu_restore_state;
-    panda_register_callback(self, PANDA_CB_CPU_RESTORE_STATE, pcb);
-    pcb.guest_hypercall = guest_hypercall_callback;
-    panda_register_callback(self, PANDA_CB_GUEST_HYPERCALL, pcb);
-
-#ifndef CONFIG_SOFTMMU
-    pcb.user_after_syscall = user_after_syscall;
-    panda_register_callback(self, PANDA_CB_USER_AFTER_SYSCALL, pcb);
-#endif
 
+    // The dynamic value log has to line up with the unoptimized IR
+    if (llvm_opt_threshold){
+        printf("taint: turning off LLVM tiered optimization\n");
+        llvm_opt_threshold = 0;
+    }
+    // Every block chosen for LLVM has to run under it
+    tcg_llvm_set_async(0);
     if (!execute_llvm){
         panda_enable_llvm();
     }
-    llvm::llvm_init();
+    else {
+        // Blocks already lowered to LLVM don't have the instrumentation
+        panda_do_flush_tb();
+    }
+    // Link in the helpers first, so calls are morphed (and helpers inlined)
+    // before the instrumentation pass runs, and inlined helper code is
+    // instrumented as part of the block
     panda_enable_llvm_helpers();
+    llvm::llvm_init();
 
     /*
      * Run instrumentation pass over all helper functions that are now in the
@@ -371,6 +459,9 @@ bool init_plugin(void *self) {
         printf("Error initializing shadow memory...\n");
         exit(1);
     }
+    // Inlined helpers don't get a frame of their own, so their values have
+    // to fit in the block's
+    limit_llvm_helper_inlining(num_vals);
 
     taintfpm = new llvm::FunctionPassManager(tcg_llvm_ctx->getModule());
 
@@ -389,6 +480,63 @@ bool init_plugin(void *self) {
         }
         PTFP->runOnFunction(*i);
     }
+}
+
+bool init_plugin(void *self) {
+    printf("Initializing taint plugin\n");
+    int i;
+    for (i = 0; i < panda_argc; i++){
+        if (0 == strncmp(panda_argv[i], "taint:start=", 12)){
+            taint_start_instr = strtoull(panda_argv[i]+12, NULL, 0);
+        }
+    }
+
+    panda_cb pcb;
+    pcb.before_block_exec = before_block_exec;
+    panda_register_callback(self, PANDA_CB_BEFORE_BLOCK_EXEC, pcb);
+    pcb.after_block_exec = after_block_exec;
+    panda_register_callback(self, PANDA_CB_AFTER_BLOCK_EXEC, pcb);
+    pcb.phys_mem_read = phys_mem_read_callback;
+    panda_register_callback(self, PANDA_CB_PHYS_MEM_READ, pcb);
+    pcb.phys_mem_write = phys_mem_write_callback;
+    panda_register_callback(self, PANDA_CB_PHYS_MEM_WRITE, pcb);
+    pcb.cb_cpu_restore_state = cb_cpu_restore_state;
+    panda_register_callback(self, PANDA_CB_CPU_RESTORE_STATE, pcb);
+    pcb.guest_hypercall = guest_hypercall_callback;
+    panda_register_callback(self, PANDA_CB_GUEST_HYPERCALL, pcb);
+    pcb.before_llvm_free = before_llvm_free;
+    panda_register_callback(self, PANDA_CB_BEFORE_LLVM_FREE, pcb);
+
+#ifndef CONFIG_SOFTMMU
+    pcb.user_after_syscall = user_after_syscall;
+    panda_register_callback(self, PANDA_CB_USER_AFTER_SYSCALL, pcb);
+#endif
+
+    time_init = now();
+    if (taint_start_instr == 0){
+        taint_enable();
+        taint_on = true;
+    }
+    else {
+#ifdef CONFIG_SOFTMMU
+        // The instruction count only moves in record and replay. Plugins
+        // given on the command line load before -replay begins, so a
+        // requested replay counts too.
+        if (rr_in_replay() || rr_replay_requested) {
+            printf("taint: running under TCG until instruction %" PRIu64 "\n",
+                taint_start_instr);
+        }
+        else {
+            printf("taint: start is only supported in replay, ignoring it\n");
+            taint_enable();
+            taint_on = true;
+        }
+#else
+        printf("taint: start is only supported in replay, ignoring it\n");
+        taint_enable();
+        taint_on = true;
+#endif
+    }
 
     return true;
 }
@@ -412,6 +560,23 @@ void uninit_plugin(void *self) {
         pr->unregisterPass(*pi);
     }
 
+    if (!shadow){
+        return;
+    }
+
+#ifdef CONFIG_SOFTMMU
+    if (taint_start_instr > 0 && rr_prog_point.guest_instr_count > instr_switch){
+        // Estimate how long the replay would have taken to get to the point
+        // of interest had LLVM been on from the start.
+        double llvm_time = now() - time_init - time_switch;
+        double llvm_rate = (rr_prog_point.guest_instr_count -
+            instr_switch) / llvm_time;
+        printf("taint: %.0f instructions/s under LLVM, taint:start saved"
+            " about %.2f seconds\n", llvm_rate,
+            instr_switch / llvm_rate - time_switch);
+    }
+#endif
+
     delete taintfpm; // Delete function pass manager and pass
 
     tp_free(shadow);
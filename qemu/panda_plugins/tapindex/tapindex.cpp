@@ -31,10 +31,11 @@ extern "C" {
 #include <stdlib.h>
 #include <ctype.h>
 #include <math.h>
-#include <map>
-#include <list>
 #include <algorithm>
 
+#include "../common/prog_point.h"
+#include "../common/tap_store.h"
+
 // These need to be extern "C" so that the ABI is compatible with
 // QEMU/PANDA, which is written in C
 extern "C" {
@@ -46,19 +47,9 @@ int mem_read_callback(CPUState *env, target_ulong pc, target_ulong addr, target_
 
 }
 
-struct prog_point {
-    target_ulong caller;
-    target_ulong pc;
-    target_ulong cr3;
-    bool operator <(const prog_point &p) const {
-        return (this->pc < p.pc) || \
-               (this->pc == p.pc && this->caller < p.caller) || \
-               (this->pc == p.pc && this->caller == p.caller && this->cr3 < p.cr3);
-    }
-};
-
-std::map<prog_point,long> read_tracker;
-std::map<prog_point,long> write_tracker;
+typedef tap_store<prog_point,tap_count<long>,hash_prog_point> tap_tracker;
+tap_tracker *read_tracker;
+tap_tracker *write_tracker;
 FILE *read_index;
 FILE *write_index;
 
@@ -71,7 +62,7 @@ int mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
         p.cr3 = env->cr[3];
 #endif
     p.pc = pc;
-    write_tracker[p] += size;
+    (*write_tracker)[p].n += size;
  
     return 1;
 }
@@ -85,7 +76,7 @@ int mem_read_callback(CPUState *env, target_ulong pc, target_ulong addr,
         p.cr3 = env->cr[3];
 #endif
     p.pc = pc;
-    read_tracker[p] += size;
+    (*read_tracker)[p].n += size;
  
     return 1;
 }
@@ -95,6 +86,10 @@ bool init_plugin(void *self) {
 
     printf("Initializing plugin tapindex\n");
 
+    uint64_t mem_limit = tap_store_mem_limit("tapindex");
+    read_tracker = new tap_tracker("tap_reads", mem_limit / 2);
+    write_tracker = new tap_tracker("tap_writes", mem_limit / 2);
+
     // Need this to get EIP with our callbacks
     panda_enable_precise_pc();
     // Enable memory logging
@@ -128,20 +123,21 @@ void uninit_plugin(void *self) {
     fwrite(&target_ulong_size, sizeof(uint32_t), 1, read_index);
 
     // Save reads
-    std::map<prog_point,long>::iterator it;
-    for(it = read_tracker.begin(); it != read_tracker.end(); it++) {
-        fwrite(&it->first, sizeof(prog_point), 1, read_index);
-        fwrite(&it->second, sizeof(long), 1, read_index);
-    }
+    read_tracker->finish([](const prog_point &p, const tap_count<long> &c) {
+        fwrite(&p, sizeof(prog_point), 1, read_index);
+        fwrite(&c.n, sizeof(long), 1, read_index);
+    });
     fclose(read_index);
+    delete read_tracker;
 
     // Cross platform support: need to know how big a target_ulong is
     fwrite(&target_ulong_size, sizeof(uint32_t), 1, write_index);
 
     // Save writes
-    for(it = write_tracker.begin(); it != write_tracker.end(); it++) {
-        fwrite(&it->first, sizeof(prog_point), 1, write_index);
-        fwrite(&it->second, sizeof(long), 1, write_index);
-    }
+    write_tracker->finish([](const prog_point &p, const tap_count<long> &c) {
+        fwrite(&p, sizeof(prog_point), 1, write_index);
+        fwrite(&c.n, sizeof(long), 1, write_index);
+    });
     fclose(write_index);
+    delete write_tracker;
 }
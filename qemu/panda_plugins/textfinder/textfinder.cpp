@@ -31,10 +31,11 @@ extern "C" {
 #include <stdlib.h>
 #include <ctype.h>
 #include <math.h>
-#include <map>
-#include <list>
 #include <algorithm>
 
+#include "../common/prog_point.h"
+#include "../common/tap_store.h"
+
 // These need to be extern "C" so that the ABI is compatible with
 // QEMU/PANDA, which is written in C
 extern "C" {
@@ -49,19 +50,19 @@ int mem_read_callback(CPUState *env, target_ulong pc, target_ulong addr, target_
 uint64_t bytes_read, bytes_written;
 uint64_t num_reads, num_writes;
 
-struct text_counter { unsigned int hist[256]; };
-struct prog_point {
-    target_ulong caller;
-    target_ulong pc;
-    target_ulong cr3;
-    bool operator <(const prog_point &p) const {
-        return (this->pc < p.pc) || \
-               (this->pc == p.pc && this->caller < p.caller) || \
-               (this->pc == p.pc && this->caller == p.caller && this->cr3 < p.cr3);
+struct text_counter {
+    unsigned int hist[256];
+
+    text_counter() { memset(hist, 0, sizeof(hist)); }
+    void merge(const text_counter &o) {
+        for (int i = 0; i < 256; i++) hist[i] += o.hist[i];
     }
+    size_t heap_bytes() const { return 0; }
+    void write(FILE *f) const { fwrite(hist, sizeof(hist), 1, f); }
+    bool read(FILE *f) { return fread(hist, sizeof(hist), 1, f) == 1; }
 };
 
-std::map<prog_point,text_counter> text_tracker;
+tap_store<prog_point,text_counter,hash_prog_point> *text_tracker;
 //FILE *text_memlog;
 
 int mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
@@ -75,7 +76,7 @@ int mem_write_callback(CPUState *env, target_ulong pc, target_ulong addr,
         p.cr3 = env->cr[3];
 #endif
     p.pc = pc;
-    text_counter &tc = text_tracker[p];
+    text_counter &tc = (*text_tracker)[p];
     for (unsigned int i = 0; i < size; i++) {
         unsigned char val = ((unsigned char *)buf)[i];
         //fprintf(text_memlog, TARGET_FMT_lx "." TARGET_FMT_lx " " TARGET_FMT_lx " %02x\n" , p.pc, p.caller, addr+i, val);
@@ -97,6 +98,9 @@ bool init_plugin(void *self) {
 
     printf("Initializing plugin textfinder\n");
 
+    text_tracker = new tap_store<prog_point,text_counter,hash_prog_point>(
+        "mem_report", tap_store_mem_limit("textfinder"));
+
     // Need this to get EIP with our callbacks
     panda_enable_precise_pc();
     // Enable memory logging
@@ -162,18 +166,10 @@ double byte_entropy(text_counter t) {
 }
 
 void uninit_plugin(void *self) {
-    std::list<std::pair<prog_point,text_counter> > display_map;
-
     printf("Memory statistics: %lu loads, %lu stores, %lu bytes read, %lu bytes written.\n",
         num_reads, num_writes, bytes_read, bytes_written
     );
 
-    // In order to sort this properly
-    for(std::map<prog_point,text_counter>::iterator it = text_tracker.begin(); it != text_tracker.end(); it++) {
-        display_map.push_back(std::make_pair(it->first, it->second));
-    }
-    //display_map.sort(confidence_compare);
-
     FILE *mem_report = fopen("mem_report.bin", "w");
     if(!mem_report) {
         printf("Couldn't write report:\n");
@@ -186,12 +182,12 @@ void uninit_plugin(void *self) {
     fwrite(&target_ulong_size, sizeof(uint32_t), 1, mem_report);
 
     //fprintf(mem_report, "PC          Text/Non-text\n");
-    std::list<std::pair<prog_point,text_counter> >::iterator it;
-    for(it = display_map.begin(); it != display_map.end(); it++) {
-        fwrite(&it->first, sizeof(prog_point), 1, mem_report);
-        fwrite(&it->second, sizeof(text_counter), 1, mem_report);
-    }
+    text_tracker->finish([mem_report](const prog_point &p, const text_counter &tc) {
+        fwrite(&p, sizeof(prog_point), 1, mem_report);
+        fwrite(&tc, sizeof(text_counter), 1, mem_report);
+    });
     fclose(mem_report);
+    delete text_tracker;
     
     //fclose(text_memlog);
 }
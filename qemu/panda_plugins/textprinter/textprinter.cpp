@@ -34,6 +34,13 @@ extern "C" {
 #include <ctype.h>
 #include <math.h>
 #include <set>
+#include <map>
+#include <vector>
+#include <string>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 #include <iostream>
 #include <fstream>
 
@@ -59,35 +66,196 @@ get_prog_point_t get_prog_point;
 uint64_t mem_counter;
 
 std::set<prog_point> tap_points;
-gzFile read_tap_buffers;
-gzFile write_tap_buffers;
+
+// Output format
+// -------------
+// Each tapped access becomes one record in a per-tap buffer. When a tap's
+// buffer reaches CHUNK_SIZE bytes it is handed to a background thread,
+// which compresses it as an independent zlib stream, appends it to
+// {read,write}_tap_buffers.bin and appends an index_entry to the matching
+// .idx file. A tool can then find every chunk for one tap in the index and
+// inflate only those. scripts/textprinter_dump.py converts back to the
+// old text format.
+//
+// Records are varints (LEB128), delta-coded against the previous record
+// in the same chunk (all "previous" values start at 0):
+//   counter delta
+//   zigzag(addr - previous addr)
+//   ncallers+1, then the callers outermost first; or 0 if the callers
+//     are the same as in the previous record
+//   size, then size bytes of data
+//
+// The .idx file starts with a uint32_t sizeof(target_ulong), like the
+// other tap reports.
+#define CHUNK_SIZE (64*1024)
+
+// Chunks are compressed on a separate thread. If it falls behind, the
+// guest blocks in flush_stream once this many chunks are waiting, rather
+// than queueing raw data without bound.
+#define MAX_PENDING_CHUNKS 64
+
+struct index_entry {
+    prog_point p;
+    uint64_t offset;        // of the compressed chunk in the .bin file
+    uint32_t compressed_len;
+    uint32_t raw_len;
+    uint64_t first_counter;
+    uint32_t nrecords;
+} __attribute__((packed));
+
+struct tap_stream {
+    std::string buf;
+    uint64_t first_counter;
+    uint64_t prev_counter;
+    target_ulong prev_addr;
+    std::vector<target_ulong> prev_callers;
+    uint32_t nrecords;
+
+    tap_stream() : first_counter(0), prev_counter(0), prev_addr(0), nrecords(0) {}
+};
+
+struct tap_output {
+    FILE *data;
+    FILE *index;
+    std::map<prog_point,tap_stream> streams;
+};
+
+struct pending_chunk {
+    tap_output *out;
+    index_entry ent;
+    std::string raw;
+};
+
+tap_output read_tap_buffers;
+tap_output write_tap_buffers;
+
+std::mutex chunk_lock;
+std::condition_variable chunk_ready;
+std::condition_variable chunk_space;
+std::deque<pending_chunk> chunk_queue;
+bool compressor_done = false;
+std::thread compressor;
+
+static void compress_chunks(void) {
+    std::vector<Bytef> zbuf;
+    while (true) {
+        pending_chunk c;
+        {
+            std::unique_lock<std::mutex> lk(chunk_lock);
+            chunk_ready.wait(lk, []{ return !chunk_queue.empty() || compressor_done; });
+            if (chunk_queue.empty()) break;
+            c = chunk_queue.front();
+            chunk_queue.pop_front();
+        }
+        chunk_space.notify_one();
+        uLongf zlen = compressBound(c.raw.size());
+        zbuf.resize(zlen);
+        if (compress2(&zbuf[0], &zlen, (const Bytef *)c.raw.data(),
+                      c.raw.size(), Z_DEFAULT_COMPRESSION) != Z_OK) {
+            fprintf(stderr, "textprinter: compression failed, dropping chunk\n");
+            continue;
+        }
+        // Only this thread touches the output files once we're running
+        c.ent.offset = ftell(c.out->data);
+        c.ent.compressed_len = zlen;
+        fwrite(&zbuf[0], 1, zlen, c.out->data);
+        fwrite(&c.ent, sizeof(c.ent), 1, c.out->index);
+    }
+}
+
+static void flush_stream(tap_output *out, const prog_point &p, tap_stream &ts) {
+    if (ts.nrecords == 0) return;
+    pending_chunk c;
+    c.out = out;
+    c.ent.p = p;
+    c.ent.raw_len = ts.buf.size();
+    c.ent.first_counter = ts.first_counter;
+    c.ent.nrecords = ts.nrecords;
+    c.raw.swap(ts.buf);
+    ts = tap_stream();
+    {
+        std::unique_lock<std::mutex> lk(chunk_lock);
+        chunk_space.wait(lk, []{ return chunk_queue.size() < MAX_PENDING_CHUNKS; });
+        chunk_queue.push_back(c);
+    }
+    chunk_ready.notify_one();
+}
+
+static inline void put_varint(std::string &buf, uint64_t v) {
+    while (v >= 0x80) {
+        buf.push_back((char)(v | 0x80));
+        v >>= 7;
+    }
+    buf.push_back((char)v);
+}
+
+static inline uint64_t zigzag(int64_t v) {
+    return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
 
 int mem_callback(CPUState *env, target_ulong pc, target_ulong addr,
-                       target_ulong size, void *buf, gzFile f) {
+                       target_ulong size, void *buf, tap_output *out) {
     prog_point p = {};
     get_prog_point(env, &p);
 
     if (tap_points.find(p) != tap_points.end()) {
         target_ulong callers[16] = {0};
         int nret = get_callers(callers, 16, env);
-        for (unsigned int i = 0; i < size; i++) {
-            for (int j = nret-1; j > 0; j--) {
-                gzprintf(f, TARGET_FMT_lx " ", callers[j]);
-            }
-            gzprintf(f, TARGET_FMT_lx " " TARGET_FMT_lx " " TARGET_FMT_lx " " TARGET_FMT_lx " %ld %02x\n",
-                    p.caller, p.pc, p.cr3, addr+i, mem_counter, ((unsigned char *)buf)[i]);
+        tap_stream &ts = out->streams[p];
+
+        if (ts.nrecords == 0) ts.first_counter = mem_counter;
+        put_varint(ts.buf, mem_counter - ts.prev_counter);
+        put_varint(ts.buf, zigzag((int64_t)addr - (int64_t)ts.prev_addr));
+
+        // Same callers the old text format listed: outermost first,
+        // skipping callers[0]
+        std::vector<target_ulong> cur;
+        for (int j = nret-1; j > 0; j--) cur.push_back(callers[j]);
+        if (ts.nrecords != 0 && cur == ts.prev_callers) {
+            put_varint(ts.buf, 0);
+        }
+        else {
+            put_varint(ts.buf, cur.size() + 1);
+            for (size_t j = 0; j < cur.size(); j++) put_varint(ts.buf, cur[j]);
+            ts.prev_callers.swap(cur);
         }
+
+        put_varint(ts.buf, size);
+        ts.buf.append((const char *)buf, size);
+
+        ts.prev_counter = mem_counter;
+        ts.prev_addr = addr;
+        ts.nrecords++;
+        if (ts.buf.size() >= CHUNK_SIZE) flush_stream(out, p, ts);
     }
     mem_counter++;
 
     return 1;
 }
 
+static bool open_output(tap_output *out, const char *data_path, const char *index_path) {
+    out->data = fopen(data_path, "wb");
+    out->index = fopen(index_path, "wb");
+    if (!out->data || !out->index) {
+        printf("Couldn't open %s / %s for writing. Exiting.\n", data_path, index_path);
+        return false;
+    }
+    // Cross platform support: need to know how big a target_ulong is
+    uint32_t target_ulong_size = sizeof(target_ulong);
+    fwrite(&target_ulong_size, sizeof(uint32_t), 1, out->index);
+    return true;
+}
+
+static void close_output(tap_output *out) {
+    if (out->data) fclose(out->data);
+    if (out->index) fclose(out->index);
+}
+
 int read_mem_callback(CPUState *env, target_ulong pc, target_ulong addr, target_ulong size, void *buf) {
-    return mem_callback(env, pc, addr, size, buf, read_tap_buffers);
+    return mem_callback(env, pc, addr, size, buf, &read_tap_buffers);
 }
 int write_mem_callback(CPUState *env, target_ulong pc, target_ulong addr, target_ulong size, void *buf ) {
-    return mem_callback(env, pc, addr, size, buf, write_tap_buffers);
+    return mem_callback(env, pc, addr, size, buf, &write_tap_buffers);
 }
 
 bool init_plugin(void *self) {
@@ -112,16 +280,11 @@ bool init_plugin(void *self) {
     }
     taps.close();
 
-    write_tap_buffers = gzopen("write_tap_buffers.txt.gz", "w");
-    if(!write_tap_buffers) {
-        printf("Couldn't open write_tap_buffers.txt for writing. Exiting.\n");
+    if (!open_output(&write_tap_buffers, "write_tap_buffers.bin", "write_tap_buffers.idx"))
         return false;
-    }
-    read_tap_buffers = gzopen("read_tap_buffers.txt.gz", "w");
-    if(!read_tap_buffers) {
-        printf("Couldn't open read_tap_buffers.txt for writing. Exiting.\n");
+    if (!open_output(&read_tap_buffers, "read_tap_buffers.bin", "read_tap_buffers.idx"))
         return false;
-    }
+    compressor = std::thread(compress_chunks);
 
     void *cs_plugin = panda_get_plugin_by_name("panda_callstack_instr.so");
     if (!cs_plugin) {
@@ -156,6 +319,20 @@ bool init_plugin(void *self) {
 }
 
 void uninit_plugin(void *self) {
-    gzclose(read_tap_buffers);
-    gzclose(write_tap_buffers);
+    std::map<prog_point,tap_stream>::iterator it;
+    for (it = read_tap_buffers.streams.begin(); it != read_tap_buffers.streams.end(); it++)
+        flush_stream(&read_tap_buffers, it->first, it->second);
+    for (it = write_tap_buffers.streams.begin(); it != write_tap_buffers.streams.end(); it++)
+        flush_stream(&write_tap_buffers, it->first, it->second);
+
+    if (compressor.joinable()) {
+        {
+            std::lock_guard<std::mutex> lk(chunk_lock);
+            compressor_done = true;
+        }
+        chunk_ready.notify_one();
+        compressor.join();
+    }
+    close_output(&read_tap_buffers);
+    close_output(&write_tap_buffers);
 }
@@ -0,0 +1,157 @@
+/* PANDABEGINCOMMENT
+ * 
+ * Authors:
+ *  Tim Leek               tleek@ll.mit.edu
+ *  Ryan Whelan            rwhelan@ll.mit.edu
+ *  Joshua Hodosh          josh.hodosh@ll.mit.edu
+ *  Michael Zhivich        mzhivich@ll.mit.edu
+ *  Brendan Dolan-Gavitt   brendandg@gatech.edu
+ * 
+ * This work is licensed under the terms of the GNU GPL, version 2. 
+ * See the COPYING file in the top-level directory. 
+ * 
+PANDAENDCOMMENT */
+
+/*
+ * Converts the binary trace written by the syscalls plugin into the text
+ * format the plugin used to write:
+ *
+ *   CALL=<name>, PC=<pc>, SYSCALL=<number>, thumb=<0|1>
+ *   STR, NAME=<arg>, VALUE=<string>
+ *   PTR, NAME=<arg>, VALUE=<hex>
+ *   I32, NAME=<arg>, VALUE=<hex>
+ *   I64, NAME=<arg>, VALUE=<hex>
+ *
+ * usage: syscalls_dump syscalls.bin
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "syscalls_trace.h"
+
+struct prototype {
+    std::string name;
+    std::string argtypes;
+    std::vector<std::string> argnames;
+};
+
+static bool read_cstring(FILE *f, std::string &s) {
+    int c;
+    s.clear();
+    while ((c = fgetc(f)) != EOF) {
+        if (c == 0) return true;
+        s.push_back((char)c);
+    }
+    return false;
+}
+
+// Reads an argument slot from the record body, advancing pos
+template <typename T>
+static bool get(const std::vector<uint8_t> &body, size_t &pos, T &v) {
+    if (pos + sizeof(T) > body.size()) return false;
+    memcpy(&v, &body[pos], sizeof(T));
+    pos += sizeof(T);
+    return true;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s syscalls.bin\n", argv[0]);
+        return 1;
+    }
+    FILE *f = fopen(argv[1], "rb");
+    if (!f) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    syscall_trace_header hdr;
+    if (fread(&hdr, sizeof(hdr), 1, f) != 1 ||
+        memcmp(hdr.magic, SYSCALL_TRACE_MAGIC, sizeof(hdr.magic)) != 0 ||
+        hdr.version != SYSCALL_TRACE_VERSION) {
+        fprintf(stderr, "%s is not a syscalls plugin trace\n", argv[1]);
+        return 1;
+    }
+    int width = hdr.target_ulong_size * 2;
+
+    // Keyed on (abi << 32) | callno
+    std::map<uint64_t, prototype> prototypes;
+    for (uint32_t i = 0; i < hdr.nprototypes; i++) {
+        uint32_t abi, callno, nargs;
+        prototype p;
+        if (fread(&abi, sizeof(abi), 1, f) != 1 ||
+            fread(&callno, sizeof(callno), 1, f) != 1 ||
+            fread(&nargs, sizeof(nargs), 1, f) != 1) {
+            fprintf(stderr, "truncated prototype table\n");
+            return 1;
+        }
+        p.argtypes.resize(nargs);
+        if (nargs && fread(&p.argtypes[0], 1, nargs, f) != nargs) {
+            fprintf(stderr, "truncated prototype table\n");
+            return 1;
+        }
+        read_cstring(f, p.name);
+        p.argnames.resize(nargs);
+        for (uint32_t j = 0; j < nargs; j++) read_cstring(f, p.argnames[j]);
+        prototypes[((uint64_t)abi << 32) | callno] = p;
+    }
+
+    syscall_trace_record rec;
+    std::vector<uint8_t> body;
+    while (fread(&rec, sizeof(rec), 1, f) == 1) {
+        if (rec.len < sizeof(rec)) {
+            fprintf(stderr, "corrupt record\n");
+            return 1;
+        }
+        body.resize(rec.len - sizeof(rec));
+        if (!body.empty() && fread(&body[0], 1, body.size(), f) != body.size()) {
+            fprintf(stderr, "truncated record\n");
+            return 1;
+        }
+
+        std::map<uint64_t, prototype>::iterator it =
+            prototypes.find(((uint64_t)rec.abi << 32) | rec.callno);
+        const prototype *p = (it != prototypes.end()) ? &it->second : NULL;
+        printf("CALL=%s, PC=%0*llx, SYSCALL=%0*x, thumb=%0*x%s\n",
+               p ? p->name.c_str() : "UNKNOWN",
+               width, (unsigned long long)rec.pc, width, rec.callno,
+               width, rec.flags & SYSCALL_TRACE_THUMB,
+               rec.abi == SYSCALL_ABI_COMPAT32 ? ", compat32" : "");
+        if (!p) continue;
+
+        size_t pos = 0;
+        for (uint32_t i = 0; i < rec.nargs && i < p->argtypes.size(); i++) {
+            const char *name = p->argnames[i].c_str();
+            if (p->argtypes[i] == SYSCALL_ARG_STRING) {
+                uint32_t len;
+                if (!get(body, pos, len) || pos + len > body.size()) break;
+                std::string value((const char *)&body[pos], len);
+                pos += len;
+                printf("STR, NAME=%s, VALUE=%s\n", name, value.c_str());
+                continue;
+            }
+            uint64_t value;
+            if (!get(body, pos, value)) break;
+            switch (p->argtypes[i]) {
+            case SYSCALL_ARG_POINTER:
+                printf("PTR, NAME=%s, VALUE=%0*llx\n", name, width, (unsigned long long)value);
+                break;
+            case SYSCALL_ARG_32:
+                printf("I32, NAME=%s, VALUE=%0*llx\n", name, width, (unsigned long long)value);
+                break;
+            case SYSCALL_ARG_64:
+                printf("I64, NAME=%s, VALUE=%llx\n", name, (unsigned long long)value);
+                break;
+            }
+        }
+    }
+
+    fclose(f);
+    return 0;
+}
@@ -2148,6 +2148,49 @@ STEXI
 Run the emulation in single step mode.
 ETEXI
 
+DEF("tcg-opt-level", HAS_ARG, QEMU_OPTION_tcg_opt_level, \
+    "-tcg-opt-level n\n"
+    "                optimize TCG ops at level n (0-2, default 2)\n", QEMU_ARCH_ALL)
+STEXI
+@item -tcg-opt-level @var{n}
+@findex -tcg-opt-level
+Set how much the TCG ops of each translated block are optimized, before
+they are turned into host code or LLVM IR.  0 turns the optimizer off, 1
+folds constants (including conditional branches and setcond) and
+propagates copies, and 2 (the default) also removes moves to globals that
+are overwritten before they are read.  The optimizer's statistics are shown
+by @code{info jit}, and printed when QEMU exits if this option is given.
+ETEXI
+
+DEF("tb-regions", HAS_ARG, QEMU_OPTION_tb_regions, \
+    "-tb-regions n   split the translated code buffer into n regions (default 8)\n",
+    QEMU_ARCH_ALL)
+STEXI
+@item -tb-regions @var{n}
+@findex -tb-regions
+Split the buffer holding translated code into @var{n} regions (at most 64,
+default 8), filled in turn.  When the last one is full, only the blocks in
+the oldest region are thrown away and its space reused, instead of flushing
+every translation and retranslating (and lowering to LLVM) the whole
+working set again.  1 flushes everything when the buffer is full.  Flushes,
+evictions and retranslations per second are shown by @code{info jit}, and
+printed when QEMU exits if this option is given.
+ETEXI
+
+DEF("panda-vtlb", HAS_ARG, QEMU_OPTION_panda_vtlb, \
+    "-panda-vtlb on|off\n"
+    "                cache guest virtual translations for plugins (default on)\n",
+    QEMU_ARCH_ALL)
+STEXI
+@item -panda-vtlb on|off
+@findex -panda-vtlb
+Turn the software TLB used by @code{panda_virtual_memory_rw} and
+@code{panda_virt_to_host} on or off.  When off, every call walks the guest
+page tables, as before the cache existed.  The lookups that hit and missed
+the cache are shown by @code{info jit}, and printed when QEMU exits if this
+option is given.
+ETEXI
+
 DEF("S", 0, QEMU_OPTION_S, \
     "-S              freeze CPU at startup (use 'c' to start execution)\n",
     QEMU_ARCH_ALL)
@@ -2598,6 +2641,20 @@ DEF("llvm", 0, QEMU_OPTION_execute_llvm,
     "-llvm           execute code using LLVM JIT\n", QEMU_ARCH_ALL)
 DEF("generate-llvm", 0, QEMU_OPTION_generate_llvm,
     "-generate-llvm  translate code into LLVM but don't execute it\n", QEMU_ARCH_ALL)
+DEF("llvm-opt-threshold", HAS_ARG, QEMU_OPTION_llvm_opt_threshold,
+    "-llvm-opt-threshold n\n"
+    "                optimize LLVM code for blocks that have run n times\n", QEMU_ARCH_ALL)
+DEF("llvm-async", 0, QEMU_OPTION_llvm_async,
+    "-llvm-async     compile LLVM code on a background thread\n", QEMU_ARCH_ALL)
+DEF("llvm-trace-threshold", HAS_ARG, QEMU_OPTION_llvm_trace_threshold,
+    "-llvm-trace-threshold n\n"
+    "                run LLVM blocks followed by the same block n times as traces\n", QEMU_ARCH_ALL)
+DEF("llvm-mem-limit", HAS_ARG, QEMU_OPTION_llvm_mem_limit,
+    "-llvm-mem-limit size\n"
+    "                free LLVM code of blocks not run recently past size MB\n", QEMU_ARCH_ALL)
+DEF("llvm-inline-helpers", HAS_ARG, QEMU_OPTION_llvm_inline_helpers,
+    "-llvm-inline-helpers n\n"
+    "                run helpers from bitcode, inlining those of size up to n\n", QEMU_ARCH_ALL)
 #endif
 
 #if defined(CONFIG_ANDROID)
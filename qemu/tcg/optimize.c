@@ -39,8 +39,6 @@ typedef enum {
     TCG_TEMP_UNDEF = 0,
     TCG_TEMP_CONST,
     TCG_TEMP_COPY,
-    TCG_TEMP_HAS_COPY,
-    TCG_TEMP_ANY
 } tcg_temp_state;
 
 struct tcg_temp_info {
@@ -52,39 +50,66 @@ struct tcg_temp_info {
 
 static struct tcg_temp_info temps[TCG_MAX_TEMPS];
 
-/* Reset TEMP's state to TCG_TEMP_ANY.  If TEMP was a representative of some
-   class of equivalent temp's, a new representative should be chosen in this
-   class. */
-static void reset_temp(TCGArg temp, int nb_temps, int nb_globals)
+int tcg_opt_level = 2;
+TCGOptStats tcg_opt_stats;
+
+/* Reset TEMP's state to TCG_TEMP_UNDEF.  If TEMP was a copy of other temps,
+   unlink it from their class. */
+static void reset_temp(TCGArg temp)
 {
-    int i;
-    TCGArg new_base = (TCGArg)-1;
-    if (temps[temp].state == TCG_TEMP_HAS_COPY) {
-        for (i = temps[temp].next_copy; i != temp; i = temps[i].next_copy) {
-            if (i >= nb_globals) {
-                temps[i].state = TCG_TEMP_HAS_COPY;
-                new_base = i;
-                break;
-            }
+    if (temps[temp].state == TCG_TEMP_COPY) {
+        if (temps[temp].prev_copy == temps[temp].next_copy) {
+            temps[temps[temp].next_copy].state = TCG_TEMP_UNDEF;
+        } else {
+            temps[temps[temp].next_copy].prev_copy = temps[temp].prev_copy;
+            temps[temps[temp].prev_copy].next_copy = temps[temp].next_copy;
         }
+    }
+    temps[temp].state = TCG_TEMP_UNDEF;
+}
+
+/* Of the temps holding the same value as TEMP, return the one that is
+   cheapest to use: a global, which lives in a register or env anyway, then
+   a local temp, then TEMP itself. */
+static TCGArg find_better_copy(TCGContext *s, TCGArg temp)
+{
+    TCGArg i;
+
+    if (temp < s->nb_globals) {
+        return temp;
+    }
+    for (i = temps[temp].next_copy; i != temp; i = temps[i].next_copy) {
+        if (i < s->nb_globals) {
+            return i;
+        }
+    }
+    if (!s->temps[temp].temp_local) {
         for (i = temps[temp].next_copy; i != temp; i = temps[i].next_copy) {
-            if (new_base == (TCGArg)-1) {
-                temps[i].state = TCG_TEMP_ANY;
-            } else {
-                temps[i].val = new_base;
+            if (s->temps[i].temp_local) {
+                return i;
             }
         }
-        temps[temps[temp].next_copy].prev_copy = temps[temp].prev_copy;
-        temps[temps[temp].prev_copy].next_copy = temps[temp].next_copy;
-    } else if (temps[temp].state == TCG_TEMP_COPY) {
-        temps[temps[temp].next_copy].prev_copy = temps[temp].prev_copy;
-        temps[temps[temp].prev_copy].next_copy = temps[temp].next_copy;
-        new_base = temps[temp].val;
     }
-    temps[temp].state = TCG_TEMP_ANY;
-    if (new_base != (TCGArg)-1 && temps[new_base].next_copy == new_base) {
-        temps[new_base].state = TCG_TEMP_ANY;
+    return temp;
+}
+
+static bool temps_are_copies(TCGArg arg1, TCGArg arg2)
+{
+    TCGArg i;
+
+    if (arg1 == arg2) {
+        return true;
+    }
+    if (temps[arg1].state != TCG_TEMP_COPY
+        || temps[arg2].state != TCG_TEMP_COPY) {
+        return false;
+    }
+    for (i = temps[arg1].next_copy; i != arg1; i = temps[i].next_copy) {
+        if (i == arg2) {
+            return true;
+        }
     }
+    return false;
 }
 
 static int op_bits(TCGOpcode op)
@@ -108,22 +133,19 @@ static TCGOpcode op_to_movi(TCGOpcode op)
 }
 
 static void tcg_opt_gen_mov(TCGContext *s, TCGArg *gen_args, TCGArg dst,
-                            TCGArg src, int nb_temps, int nb_globals)
+                            TCGArg src)
 {
-        reset_temp(dst, nb_temps, nb_globals);
-        assert(temps[src].state != TCG_TEMP_COPY);
-        /* Don't try to copy if one of temps is a global or either one
-           is local and another is register */
-        if (src >= nb_globals && dst >= nb_globals &&
-            tcg_arg_is_local(s, src) == tcg_arg_is_local(s, dst)) {
-            assert(temps[src].state != TCG_TEMP_CONST);
-            if (temps[src].state != TCG_TEMP_HAS_COPY) {
-                temps[src].state = TCG_TEMP_HAS_COPY;
+        reset_temp(dst);
+        assert(temps[src].state != TCG_TEMP_CONST);
+        /* All state is dropped at the end of each basic block, so globals,
+           local temps and temps can all be copies of each other. */
+        if (s->temps[src].type == s->temps[dst].type) {
+            if (temps[src].state != TCG_TEMP_COPY) {
+                temps[src].state = TCG_TEMP_COPY;
                 temps[src].next_copy = src;
                 temps[src].prev_copy = src;
             }
             temps[dst].state = TCG_TEMP_COPY;
-            temps[dst].val = src;
             temps[dst].next_copy = temps[src].next_copy;
             temps[dst].prev_copy = src;
             temps[temps[dst].next_copy].prev_copy = dst;
@@ -133,10 +155,9 @@ static void tcg_opt_gen_mov(TCGContext *s, TCGArg *gen_args, TCGArg dst,
         gen_args[1] = src;
 }
 
-static void tcg_opt_gen_movi(TCGArg *gen_args, TCGArg dst, TCGArg val,
-                             int nb_temps, int nb_globals)
+static void tcg_opt_gen_movi(TCGArg *gen_args, TCGArg dst, TCGArg val)
 {
-        reset_temp(dst, nb_temps, nb_globals);
+        reset_temp(dst);
         temps[dst].state = TCG_TEMP_CONST;
         temps[dst].val = val;
         gen_args[0] = dst;
@@ -267,6 +288,100 @@ static TCGArg do_constant_folding(TCGOpcode op, TCGArg x, TCGArg y)
     return res;
 }
 
+static bool do_constant_folding_cond_32(uint32_t x, uint32_t y, TCGCond c)
+{
+    switch (c) {
+    case TCG_COND_EQ:
+        return x == y;
+    case TCG_COND_NE:
+        return x != y;
+    case TCG_COND_LT:
+        return (int32_t)x < (int32_t)y;
+    case TCG_COND_GE:
+        return (int32_t)x >= (int32_t)y;
+    case TCG_COND_LE:
+        return (int32_t)x <= (int32_t)y;
+    case TCG_COND_GT:
+        return (int32_t)x > (int32_t)y;
+    case TCG_COND_LTU:
+        return x < y;
+    case TCG_COND_GEU:
+        return x >= y;
+    case TCG_COND_LEU:
+        return x <= y;
+    case TCG_COND_GTU:
+        return x > y;
+    default:
+        tcg_abort();
+    }
+}
+
+static bool do_constant_folding_cond_64(uint64_t x, uint64_t y, TCGCond c)
+{
+    switch (c) {
+    case TCG_COND_EQ:
+        return x == y;
+    case TCG_COND_NE:
+        return x != y;
+    case TCG_COND_LT:
+        return (int64_t)x < (int64_t)y;
+    case TCG_COND_GE:
+        return (int64_t)x >= (int64_t)y;
+    case TCG_COND_LE:
+        return (int64_t)x <= (int64_t)y;
+    case TCG_COND_GT:
+        return (int64_t)x > (int64_t)y;
+    case TCG_COND_LTU:
+        return x < y;
+    case TCG_COND_GEU:
+        return x >= y;
+    case TCG_COND_LEU:
+        return x <= y;
+    case TCG_COND_GTU:
+        return x > y;
+    default:
+        tcg_abort();
+    }
+}
+
+/* Return 0 or 1 if the condition C on X and Y is known to be false or
+   true, 2 if it can't be decided here. */
+static TCGArg do_constant_folding_cond(TCGOpcode op, TCGArg x,
+                                       TCGArg y, TCGCond c)
+{
+    if (temps[x].state == TCG_TEMP_CONST && temps[y].state == TCG_TEMP_CONST) {
+        switch (op_bits(op)) {
+        case 32:
+            return do_constant_folding_cond_32(temps[x].val, temps[y].val, c);
+        case 64:
+            return do_constant_folding_cond_64(temps[x].val, temps[y].val, c);
+        default:
+            tcg_abort();
+        }
+    } else if (temps_are_copies(x, y)) {
+        switch (c) {
+        case TCG_COND_EQ:
+        case TCG_COND_GE:
+        case TCG_COND_LE:
+        case TCG_COND_GEU:
+        case TCG_COND_LEU:
+            return 1;
+        default:
+            return 0;
+        }
+    } else if (temps[y].state == TCG_TEMP_CONST && temps[y].val == 0) {
+        switch (c) {
+        case TCG_COND_LTU:
+            return 0;
+        case TCG_COND_GEU:
+            return 1;
+        default:
+            return 2;
+        }
+    }
+    return 2;
+}
+
 /* Propagate constants and copies, fold constant expressions. */
 static TCGArg *tcg_constant_folding(TCGContext *s, uint16_t *tcg_opc_ptr,
                                     TCGArg *args, TCGOpDef *tcg_op_defs)
@@ -278,8 +393,8 @@ static TCGArg *tcg_constant_folding(TCGContext *s, uint16_t *tcg_opc_ptr,
     TCGArg tmp;
     /* Array VALS has an element for each temp.
        If this temp holds a constant then its value is kept in VALS' element.
-       If this temp is a copy of other ones then this equivalence class'
-       representative is kept in VALS' element.
+       If this temp is a copy of other ones then the other temps of its
+       equivalence class are linked through VALS' elements.
        If this temp is neither copy nor constant then corresponding VALS'
        element is unused. */
 
@@ -292,12 +407,29 @@ static TCGArg *tcg_constant_folding(TCGContext *s, uint16_t *tcg_opc_ptr,
     for (op_index = 0; op_index < nb_ops; op_index++) {
         op = gen_opc_buf[op_index];
         def = &tcg_op_defs[op];
-        /* Do copy propagation */
-        if (!(def->flags & (TCG_OPF_CALL_CLOBBER | TCG_OPF_SIDE_EFFECTS))) {
-            assert(op != INDEX_op_call);
+        /* Do copy propagation.  The last input of a call is the address of
+           the helper, which is left alone. */
+        if (op == INDEX_op_call) {
+            int nb_oargs = args[0] >> 16;
+            int nb_iargs = args[0] & 0xffff;
+            for (i = nb_oargs + 1; i < nb_oargs + nb_iargs; i++) {
+                if (args[i] != TCG_CALL_DUMMY_ARG
+                    && temps[args[i]].state == TCG_TEMP_COPY) {
+                    tmp = find_better_copy(s, args[i]);
+                    if (tmp != args[i]) {
+                        args[i] = tmp;
+                        tcg_opt_stats.copies++;
+                    }
+                }
+            }
+        } else {
             for (i = def->nb_oargs; i < def->nb_oargs + def->nb_iargs; i++) {
                 if (temps[args[i]].state == TCG_TEMP_COPY) {
-                    args[i] = temps[args[i]].val;
+                    tmp = find_better_copy(s, args[i]);
+                    if (tmp != args[i]) {
+                        args[i] = tmp;
+                        tcg_opt_stats.copies++;
+                    }
                 }
             }
         }
@@ -318,6 +450,24 @@ static TCGArg *tcg_constant_folding(TCGContext *s, uint16_t *tcg_opc_ptr,
                 args[2] = tmp;
             }
             break;
+        CASE_OP_32_64(brcond):
+            if (temps[args[0]].state == TCG_TEMP_CONST
+                && temps[args[1]].state != TCG_TEMP_CONST) {
+                tmp = args[0];
+                args[0] = args[1];
+                args[1] = tmp;
+                args[2] = tcg_swap_cond(args[2]);
+            }
+            break;
+        CASE_OP_32_64(setcond):
+            if (temps[args[1]].state == TCG_TEMP_CONST
+                && temps[args[2]].state != TCG_TEMP_CONST) {
+                tmp = args[1];
+                args[1] = args[2];
+                args[2] = tmp;
+                args[3] = tcg_swap_cond(args[3]);
+            }
+            break;
         default:
             break;
         }
@@ -337,15 +487,13 @@ static TCGArg *tcg_constant_folding(TCGContext *s, uint16_t *tcg_opc_ptr,
             }
             if (temps[args[2]].state == TCG_TEMP_CONST
                 && temps[args[2]].val == 0) {
-                if ((temps[args[0]].state == TCG_TEMP_COPY
-                    && temps[args[0]].val == args[1])
-                    || args[0] == args[1]) {
+                if (temps_are_copies(args[0], args[1])) {
                     args += 3;
                     gen_opc_buf[op_index] = INDEX_op_nop;
+                    tcg_opt_stats.removed++;
                 } else {
                     gen_opc_buf[op_index] = op_to_mov(op);
-                    tcg_opt_gen_mov(s, gen_args, args[0], args[1],
-                                    nb_temps, nb_globals);
+                    tcg_opt_gen_mov(s, gen_args, args[0], args[1]);
                     gen_args += 2;
                     args += 3;
                 }
@@ -356,7 +504,8 @@ static TCGArg *tcg_constant_folding(TCGContext *s, uint16_t *tcg_opc_ptr,
             if ((temps[args[2]].state == TCG_TEMP_CONST
                 && temps[args[2]].val == 0)) {
                 gen_opc_buf[op_index] = op_to_movi(op);
-                tcg_opt_gen_movi(gen_args, args[0], 0, nb_temps, nb_globals);
+                tcg_opt_gen_movi(gen_args, args[0], 0);
+                tcg_opt_stats.folded++;
                 args += 3;
                 gen_args += 2;
                 continue;
@@ -364,14 +513,14 @@ static TCGArg *tcg_constant_folding(TCGContext *s, uint16_t *tcg_opc_ptr,
             break;
         CASE_OP_32_64(or):
         CASE_OP_32_64(and):
-            if (args[1] == args[2]) {
-                if (args[1] == args[0]) {
+            if (temps_are_copies(args[1], args[2])) {
+                if (temps_are_copies(args[0], args[1])) {
                     args += 3;
                     gen_opc_buf[op_index] = INDEX_op_nop;
+                    tcg_opt_stats.removed++;
                 } else {
                     gen_opc_buf[op_index] = op_to_mov(op);
-                    tcg_opt_gen_mov(s, gen_args, args[0], args[1], nb_temps,
-                                    nb_globals);
+                    tcg_opt_gen_mov(s, gen_args, args[0], args[1]);
                     gen_args += 2;
                     args += 3;
                 }
@@ -387,16 +536,14 @@ static TCGArg *tcg_constant_folding(TCGContext *s, uint16_t *tcg_opc_ptr,
            allocator where needed and possible.  Also detect copies. */
         switch (op) {
         CASE_OP_32_64(mov):
-            if ((temps[args[1]].state == TCG_TEMP_COPY
-                && temps[args[1]].val == args[0])
-                || args[0] == args[1]) {
+            if (temps_are_copies(args[0], args[1])) {
                 args += 2;
                 gen_opc_buf[op_index] = INDEX_op_nop;
+                tcg_opt_stats.removed++;
                 break;
             }
             if (temps[args[1]].state != TCG_TEMP_CONST) {
-                tcg_opt_gen_mov(s, gen_args, args[0], args[1],
-                                nb_temps, nb_globals);
+                tcg_opt_gen_mov(s, gen_args, args[0], args[1]);
                 gen_args += 2;
                 args += 2;
                 break;
@@ -408,7 +555,7 @@ static TCGArg *tcg_constant_folding(TCGContext *s, uint16_t *tcg_opc_ptr,
             args[1] = temps[args[1]].val;
             /* fallthrough */
         CASE_OP_32_64(movi):
-            tcg_opt_gen_movi(gen_args, args[0], args[1], nb_temps, nb_globals);
+            tcg_opt_gen_movi(gen_args, args[0], args[1]);
             gen_args += 2;
             args += 2;
             break;
@@ -423,12 +570,13 @@ static TCGArg *tcg_constant_folding(TCGContext *s, uint16_t *tcg_opc_ptr,
             if (temps[args[1]].state == TCG_TEMP_CONST) {
                 gen_opc_buf[op_index] = op_to_movi(op);
                 tmp = do_constant_folding(op, temps[args[1]].val, 0);
-                tcg_opt_gen_movi(gen_args, args[0], tmp, nb_temps, nb_globals);
+                tcg_opt_gen_movi(gen_args, args[0], tmp);
+                tcg_opt_stats.folded++;
                 gen_args += 2;
                 args += 2;
                 break;
             } else {
-                reset_temp(args[0], nb_temps, nb_globals);
+                reset_temp(args[0]);
                 gen_args[0] = args[0];
                 gen_args[1] = args[1];
                 gen_args += 2;
@@ -456,12 +604,13 @@ static TCGArg *tcg_constant_folding(TCGContext *s, uint16_t *tcg_opc_ptr,
                 gen_opc_buf[op_index] = op_to_movi(op);
                 tmp = do_constant_folding(op, temps[args[1]].val,
                                           temps[args[2]].val);
-                tcg_opt_gen_movi(gen_args, args[0], tmp, nb_temps, nb_globals);
+                tcg_opt_gen_movi(gen_args, args[0], tmp);
+                tcg_opt_stats.folded++;
                 gen_args += 2;
                 args += 3;
                 break;
             } else {
-                reset_temp(args[0], nb_temps, nb_globals);
+                reset_temp(args[0]);
                 gen_args[0] = args[0];
                 gen_args[1] = args[1];
                 gen_args[2] = args[2];
@@ -469,15 +618,60 @@ static TCGArg *tcg_constant_folding(TCGContext *s, uint16_t *tcg_opc_ptr,
                 args += 3;
                 break;
             }
+        CASE_OP_32_64(setcond):
+            tmp = do_constant_folding_cond(op, args[1], args[2], args[3]);
+            if (tmp != 2) {
+                gen_opc_buf[op_index] = op_to_movi(op);
+                tcg_opt_gen_movi(gen_args, args[0], tmp);
+                tcg_opt_stats.conds++;
+                gen_args += 2;
+                args += 4;
+                break;
+            } else {
+                reset_temp(args[0]);
+                gen_args[0] = args[0];
+                gen_args[1] = args[1];
+                gen_args[2] = args[2];
+                gen_args[3] = args[3];
+                gen_args += 4;
+                args += 4;
+                break;
+            }
+        CASE_OP_32_64(brcond):
+            tmp = do_constant_folding_cond(op, args[0], args[1], args[2]);
+            if (tmp != 2) {
+                /* A branch that is never taken just goes away, and the
+                   basic block carries on; one that always is becomes an
+                   unconditional branch. */
+                if (tmp) {
+                    memset(temps, 0, nb_temps * sizeof(struct tcg_temp_info));
+                    gen_opc_buf[op_index] = INDEX_op_br;
+                    gen_args[0] = args[3];
+                    gen_args += 1;
+                } else {
+                    gen_opc_buf[op_index] = INDEX_op_nop;
+                }
+                tcg_opt_stats.conds++;
+                args += 4;
+                break;
+            } else {
+                memset(temps, 0, nb_temps * sizeof(struct tcg_temp_info));
+                for (i = 0; i < def->nb_args; i++) {
+                    *gen_args = *args;
+                    args++;
+                    gen_args++;
+                }
+                break;
+            }
         case INDEX_op_call:
             nb_call_args = (args[0] >> 16) + (args[0] & 0xffff);
             if (!(args[nb_call_args + 1] & (TCG_CALL_CONST | TCG_CALL_PURE))) {
                 for (i = 0; i < nb_globals; i++) {
-                    reset_temp(i, nb_temps, nb_globals);
+                    reset_temp(i);
                 }
             }
             for (i = 0; i < (args[0] >> 16); i++) {
-                reset_temp(args[i + 1], nb_temps, nb_globals);
+                reset_temp(args[i + 1]);
             }
             i = nb_call_args + 3;
             while (i) {
@@ -490,7 +684,6 @@ static TCGArg *tcg_constant_folding(TCGContext *s, uint16_t *tcg_opc_ptr,
         case INDEX_op_set_label:
         case INDEX_op_jmp:
         case INDEX_op_br:
-        CASE_OP_32_64(brcond):
             memset(temps, 0, nb_temps * sizeof(struct tcg_temp_info));
             for (i = 0; i < def->nb_args; i++) {
                 *gen_args = *args;
@@ -502,7 +695,7 @@ static TCGArg *tcg_constant_folding(TCGContext *s, uint16_t *tcg_opc_ptr,
             /* Default case: we do know nothing about operation so no
                propagation is done.  We only trash output args.  */
             for (i = 0; i < def->nb_oargs; i++) {
-                reset_temp(args[i], nb_temps, nb_globals);
+                reset_temp(args[i]);
             }
             for (i = 0; i < def->nb_args; i++) {
                 gen_args[i] = args[i];
@@ -516,10 +709,189 @@ static TCGArg *tcg_constant_folding(TCGContext *s, uint16_t *tcg_opc_ptr,
     return gen_args;
 }
 
+/* Return true if a load of SIZE bytes at OFFSET from the fixed register
+   temp BASE (env) overlaps the memory of global G. */
+static bool global_overlaps(TCGContext *s, int g, TCGArg base,
+                            tcg_target_long offset, int size)
+{
+    TCGTemp *ts = &s->temps[g];
+    int gsize = ts->base_type == TCG_TYPE_I64 ? 8 : 4;
+
+    if (ts->fixed_reg || ts->mem_reg != s->temps[base].reg) {
+        return false;
+    }
+    return offset < ts->mem_offset + gsize && ts->mem_offset < offset + size;
+}
+
+static int ld_size(TCGOpcode op)
+{
+    switch (op) {
+    CASE_OP_32_64(ld8u):
+    CASE_OP_32_64(ld8s):
+        return 1;
+    CASE_OP_32_64(ld16u):
+    CASE_OP_32_64(ld16s):
+        return 2;
+    case INDEX_op_ld_i32:
+    case INDEX_op_ld32u_i64:
+    case INDEX_op_ld32s_i64:
+        return 4;
+    case INDEX_op_ld_i64:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+/* Remove movs to globals that are overwritten later in the same basic
+   block before anything can read them.  Globals are read by ops that use
+   them, by loads from env that overlap them, and by anything that may see
+   the CPU state in env: calls other than const ones, ops with side effects
+   (which includes guest loads and stores, since they can fault) and the
+   end of the basic block.  The TCG backend's liveness analysis already
+   drops these, but code lowered to LLVM stores every global it writes to
+   env.  Loads through pointers other than env are assumed to read every
+   global.  Dead movs become nopn, so the op indexes don't change. */
+static void tcg_dead_global_stores(TCGContext *s, uint16_t *tcg_opc_ptr,
+                                   TCGArg *args, TCGOpDef *tcg_op_defs)
+{
+    /* The last mov to each global that nothing has read yet */
+    static int store_op[TCG_MAX_TEMPS];
+    static TCGArg *store_args[TCG_MAX_TEMPS];
+    int i, g, nb_ops, op_index, nb_args, nb_oargs, nb_iargs, size;
+    int nb_globals = s->nb_globals;
+    TCGOpcode op;
+    const TCGOpDef *def;
+
+    memset(store_args, 0, nb_globals * sizeof(TCGArg *));
+    nb_ops = tcg_opc_ptr - gen_opc_buf;
+    for (op_index = 0; op_index < nb_ops; op_index++, args += nb_args) {
+        op = gen_opc_buf[op_index];
+        def = &tcg_op_defs[op];
+        if (op == INDEX_op_call) {
+            nb_oargs = args[0] >> 16;
+            nb_iargs = args[0] & 0xffff;
+            nb_args = nb_oargs + nb_iargs + def->nb_cargs + 1;
+            if (!(args[nb_oargs + nb_iargs + 1] & TCG_CALL_CONST)) {
+                memset(store_args, 0, nb_globals * sizeof(TCGArg *));
+                continue;
+            }
+            for (i = 1; i < nb_oargs + nb_iargs + 1; i++) {
+                if (args[i] != TCG_CALL_DUMMY_ARG && args[i] < nb_globals) {
+                    store_args[args[i]] = NULL;
+                }
+            }
+            continue;
+        }
+        if (op == INDEX_op_nopn) {
+            nb_args = args[0];
+            continue;
+        }
+        nb_args = def->nb_args;
+        if ((def->flags & (TCG_OPF_BB_END | TCG_OPF_SIDE_EFFECTS))
+            || op == INDEX_op_set_label) {
+            memset(store_args, 0, nb_globals * sizeof(TCGArg *));
+            continue;
+        }
+
+        /* Reads */
+        size = ld_size(op);
+        if (size && !s->temps[args[1]].fixed_reg) {
+            /* A load through a computed pointer could read any global */
+            memset(store_args, 0, nb_globals * sizeof(TCGArg *));
+        } else if (size) {
+            for (g = 0; g < nb_globals; g++) {
+                if (global_overlaps(s, g, args[1], args[2], size)) {
+                    store_args[g] = NULL;
+                }
+            }
+        }
+        for (i = def->nb_oargs; i < def->nb_oargs + def->nb_iargs; i++) {
+            if (args[i] < nb_globals) {
+                store_args[args[i]] = NULL;
+            }
+        }
+
+        /* Writes */
+        for (i = 0; i < def->nb_oargs; i++) {
+            g = args[i];
+            if (g >= nb_globals) {
+                continue;
+            }
+            if (store_args[g]) {
+                gen_opc_buf[store_op[g]] = INDEX_op_nopn;
+                store_args[g][0] = 2;
+                store_args[g][1] = 2;
+                tcg_opt_stats.dead_stores++;
+            }
+            store_args[g] = NULL;
+        }
+        switch (op) {
+        CASE_OP_32_64(mov):
+        CASE_OP_32_64(movi):
+            if (args[0] < nb_globals && !s->temps[args[0]].fixed_reg) {
+                store_op[args[0]] = op_index;
+                store_args[args[0]] = args;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+static void tcg_count_ops(uint16_t *tcg_opc_ptr, int64_t *count)
+{
+    uint16_t *opc;
+
+    for (opc = gen_opc_buf; opc < tcg_opc_ptr; opc++) {
+        switch (*opc) {
+        case INDEX_op_nop:
+        case INDEX_op_nop1:
+        case INDEX_op_nop2:
+        case INDEX_op_nop3:
+        case INDEX_op_nopn:
+        case INDEX_op_debug_insn_start:
+            break;
+        default:
+            (*count)++;
+            break;
+        }
+    }
+}
+
 TCGArg *tcg_optimize(TCGContext *s, uint16_t *tcg_opc_ptr,
         TCGArg *args, TCGOpDef *tcg_op_defs)
 {
     TCGArg *res;
+
+    if (tcg_opt_level == 0) {
+        return gen_opparam_ptr;
+    }
+    tcg_opt_stats.runs++;
+    tcg_count_ops(tcg_opc_ptr, &tcg_opt_stats.ops_in);
     res = tcg_constant_folding(s, tcg_opc_ptr, args, tcg_op_defs);
+    if (tcg_opt_level >= 2) {
+        tcg_dead_global_stores(s, tcg_opc_ptr, args, tcg_op_defs);
+    }
+    tcg_count_ops(tcg_opc_ptr, &tcg_opt_stats.ops_out);
     return res;
 }
+
+void tcg_dump_opt_info(FILE *f, fprintf_function cpu_fprintf)
+{
+    TCGOptStats *st = &tcg_opt_stats;
+
+    cpu_fprintf(f, "TCG optimizer level %d\n", tcg_opt_level);
+    if (!st->runs) {
+        return;
+    }
+    cpu_fprintf(f, "  ops/run           %0.1f -> %0.1f (%" PRId64 " runs)\n",
+                (double)st->ops_in / st->runs,
+                (double)st->ops_out / st->runs, st->runs);
+    cpu_fprintf(f, "  folded ops        %" PRId64 "\n", st->folded);
+    cpu_fprintf(f, "  folded conds      %" PRId64 "\n", st->conds);
+    cpu_fprintf(f, "  removed ops       %" PRId64 "\n", st->removed);
+    cpu_fprintf(f, "  copies propagated %" PRId64 "\n", st->copies);
+    cpu_fprintf(f, "  dead global movs  %" PRId64 "\n", st->dead_stores);
+}
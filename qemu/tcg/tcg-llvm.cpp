@@ -145,9 +145,16 @@ static char *qemu_st_helper_names[5] = {
 #include <llvm/Support/DynamicLibrary.h>
 #include <llvm/Support/raw_ostream.h>
 
+#include <algorithm>
+#include <deque>
 #include <iostream>
+#include <set>
 #include <sstream>
 
+#include <pthread.h>
+#include <signal.h>
+#include <time.h>
+
 //#undef NDEBUG
 
 extern "C" {
@@ -158,6 +165,28 @@ extern "C" {
         0, 0, {0,0,0}
         , 0, 0, 0
     };
+
+    uint64_t llvm_opt_threshold = 0;
+    TCGLLVMTierStats tcg_llvm_tier_stats;
+
+    int llvm_async_compile = 0;
+
+    uint64_t llvm_trace_threshold = 0;
+    TCGLLVMTraceStats tcg_llvm_trace_stats;
+
+    uint64_t llvm_mem_limit = 0;
+    TCGLLVMMemStats tcg_llvm_mem_stats;
+}
+
+/* Counts LLVM TB executions while llvm_mem_limit is set, to date
+ * llvm_last_use */
+static uint64_t tcg_llvm_use_clock = 0;
+
+static inline uint64_t get_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
 }
 
 extern CPUState *env;
@@ -166,6 +195,21 @@ using namespace llvm;
 
 class TJITMemoryManager;
 
+static void tcg_llvm_free_tb_code(TranslationBlock *tb);
+
+/* Rough size of a function's IR; constants live in the LLVMContext and
+ * aren't counted */
+static uint32_t irBytes(Function *f)
+{
+    size_t bytes = sizeof(Function);
+    for(Function::iterator bb = f->begin(); bb != f->end(); ++bb) {
+        bytes += sizeof(BasicBlock);
+        for(BasicBlock::iterator i = bb->begin(); i != bb->end(); ++i)
+            bytes += sizeof(Instruction) + i->getNumOperands() * sizeof(Use);
+    }
+    return bytes;
+}
+
 struct TCGLLVMContextPrivate {
     LLVMContext& m_context;
     IRBuilder<> m_builder;
@@ -180,8 +224,26 @@ struct TCGLLVMContextPrivate {
     /* Function pass manager (used for optimizing the code) */
     FunctionPassManager *m_functionPassManager;
 
-    /* Count of generated translation blocks */
+    /* Passes run on hot TBs, after m_functionPassManager */
+    FunctionPassManager *m_optPassManager;
+
+    /* Background compilation (llvm_async_compile).  m_lock protects the
+     * module, the JIT and the queue; the compile thread holds it while it
+     * compiles a TB from the queue. */
+    pthread_mutex_t m_lock;
+    pthread_cond_t m_compileCond;   /* signalled when a TB is queued */
+    pthread_cond_t m_idleCond;      /* broadcast when the queue empties */
+    std::deque<TranslationBlock*> m_compileQueue;
+
+    /* TBs that have an LLVM function, for collectCode */
+    std::set<TranslationBlock*> m_liveTBs;
+    pthread_t m_compileThread;
+    bool m_compileThreadStarted;
+    bool m_stopCompileThread;
+
+    /* Count of generated translation blocks, and of traces */
     int m_tbCount;
+    int m_traceCount;
 
     /* XXX: The following members are "local" to generateCode method */
 
@@ -278,7 +340,21 @@ public:
                              int mem_index, int bits);
     void generateTraceCall(uintptr_t pc);
     int generateOperation(int opc, const TCGArg *args);
-    void generateCode(TCGContext *s, TranslationBlock *tb);
+    bool generateCode(TCGContext *s, TranslationBlock *tb);
+    bool optimizeCode(TranslationBlock *tb);
+    void freeCode(TranslationBlock *tb);
+
+    /* Traces */
+    TCGLLVMTrace* formTrace(TranslationBlock *head);
+    void freeTrace(TCGLLVMTrace *trace);
+
+    void collectCode(TranslationBlock *keep);
+    void forgetTBs(TranslationBlock *begin, TranslationBlock *end);
+
+    /* Background compilation */
+    void startCompileThread();
+    void compileThread();
+    void waitForCompiles();
 };
 
 /* Custom JITMemoryManager in order to capture the size of
@@ -358,6 +434,7 @@ public:
 
 TCGLLVMContextPrivate::TCGLLVMContextPrivate()
     : m_context(getGlobalContext()), m_builder(m_context), m_tbCount(0),
+      m_traceCount(0),
       m_tcgContext(NULL), m_tbFunction(NULL)
 {
     std::memset(m_values, 0, sizeof(m_values));
@@ -365,6 +442,12 @@ TCGLLVMContextPrivate::TCGLLVMContextPrivate()
     std::memset(m_globalsIdx, 0, sizeof(m_globalsIdx));
     std::memset(m_labels, 0, sizeof(m_labels));
 
+    pthread_mutex_init(&m_lock, NULL);
+    pthread_cond_init(&m_compileCond, NULL);
+    pthread_cond_init(&m_idleCond, NULL);
+    m_compileThreadStarted = false;
+    m_stopCompileThread = false;
+
     InitializeNativeTarget();
 
     m_module = new Module("tcg-llvm", m_context);
@@ -414,6 +497,21 @@ TCGLLVMContextPrivate::TCGLLVMContextPrivate()
      */
 
     m_functionPassManager->doInitialization();
+
+    /* Second tier, for TBs that have run llvm_opt_threshold times.  The
+     * translated code keeps guest registers in memory, and the volatile
+     * stores of the PC and opc index (needed by cpu_restore_state) are left
+     * alone by all of these.
+     */
+    m_optPassManager = new FunctionPassManager(m_module);
+    m_optPassManager->add(
+            new DataLayout(*m_executionEngine->getDataLayout()));
+    m_optPassManager->add(createPromoteMemoryToRegisterPass());
+    m_optPassManager->add(createInstructionCombiningPass());
+    m_optPassManager->add(createGVNPass());
+    m_optPassManager->add(createDeadStoreEliminationPass());
+    m_optPassManager->add(createCFGSimplificationPass());
+    m_optPassManager->doInitialization();
 }
 
 /* rwhelan: to restart LLVM again, there is either a bug with the
@@ -423,10 +521,26 @@ TCGLLVMContextPrivate::TCGLLVMContextPrivate()
  */
 TCGLLVMContextPrivate::~TCGLLVMContextPrivate()
 {
+    if (m_compileThreadStarted){
+        pthread_mutex_lock(&m_lock);
+        m_stopCompileThread = true;
+        pthread_cond_signal(&m_compileCond);
+        pthread_mutex_unlock(&m_lock);
+        pthread_join(m_compileThread, NULL);
+    }
+    pthread_cond_destroy(&m_idleCond);
+    pthread_cond_destroy(&m_compileCond);
+    pthread_mutex_destroy(&m_lock);
+
     if (m_functionPassManager){
         delete m_functionPassManager;
         m_functionPassManager = NULL;
     }
+
+    if (m_optPassManager){
+        delete m_optPassManager;
+        m_optPassManager = NULL;
+    }
  
     // the following line will also delete
     // m_moduleProvider, m_module and all its functions
@@ -1310,8 +1424,25 @@ int TCGLLVMContextPrivate::generateOperation(int opc, const TCGArg *args)
     return nb_args;
 }
 
-void TCGLLVMContextPrivate::generateCode(TCGContext *s, TranslationBlock *tb)
+bool TCGLLVMContextPrivate::generateCode(TCGContext *s, TranslationBlock *tb)
 {
+    /* With llvm_async_compile, the TB is only turned into IR here and the
+     * compile thread generates its code.  If that thread is busy with the
+     * module, leave the TB to TCG for now rather than wait for it; it is
+     * lowered another time it runs.  Logging the LLVM output needs the code
+     * right away, so it is done synchronously.
+     */
+    bool async = llvm_async_compile && execute_llvm &&
+        !qemu_loglevel_mask(CPU_LOG_LLVM_IR | CPU_LOG_LLVM_ASM);
+    if(async) {
+        if(pthread_mutex_trylock(&m_lock))
+            return false;
+    } else {
+        pthread_mutex_lock(&m_lock);
+    }
+
+    uint64_t start = get_ns();
+
     /* Create new function for current translation block */
     /* TODO: compute the checksum of the tb to see if we can reuse some code */
     std::ostringstream fName;
@@ -1394,17 +1525,35 @@ void TCGLLVMContextPrivate::generateCode(TCGContext *s, TranslationBlock *tb)
     m_functionPassManager->run(*m_tbFunction);
 
     tb->llvm_function = m_tbFunction;
+    tb->llvm_ir_bytes = irBytes(m_tbFunction);
+    tb->llvm_last_use = tcg_llvm_use_clock;
+    m_liveTBs.insert(tb);
+    tcg_llvm_mem_stats.functions++;
+    tcg_llvm_mem_stats.ir_bytes += tb->llvm_ir_bytes;
 
-    if(execute_llvm || qemu_loglevel_mask(CPU_LOG_LLVM_ASM)) {
+    if(async) {
+        tb->llvm_tc_ptr = 0;
+        tb->llvm_tc_end = 0;
+        startCompileThread();
+        m_compileQueue.push_back(tb);
+        pthread_cond_signal(&m_compileCond);
+    } else if(execute_llvm || qemu_loglevel_mask(CPU_LOG_LLVM_ASM)) {
         tb->llvm_tc_ptr = (uint8_t*)
                 m_executionEngine->getPointerToFunction(m_tbFunction);
         tb->llvm_tc_end = tb->llvm_tc_ptr +
                 m_jitMemoryManager->getLastFunctionSize();
+        tcg_llvm_mem_stats.code_bytes += tb->llvm_tc_end - tb->llvm_tc_ptr;
     } else {
         tb->llvm_tc_ptr = 0;
         tb->llvm_tc_end = 0;
     }
 
+    tb->llvm_tier = 0;
+    tb->llvm_exec_count = 0;
+    tb->llvm_exec_ns = 0;
+    tcg_llvm_tier_stats.tbs[0]++;
+    tcg_llvm_tier_stats.compile_ns[0] += get_ns() - start;
+
     if(qemu_loglevel_mask(CPU_LOG_LLVM_IR)) {
         std::string fcnString;
         llvm::raw_string_ostream s(fcnString);
@@ -1414,6 +1563,347 @@ void TCGLLVMContextPrivate::generateCode(TCGContext *s, TranslationBlock *tb)
         qemu_log("\n");
         qemu_log_flush();
     }
+
+    pthread_mutex_unlock(&m_lock);
+    return true;
+}
+
+bool TCGLLVMContextPrivate::optimizeCode(TranslationBlock *tb)
+{
+    /* Try again later if the compile thread is busy */
+    if(pthread_mutex_trylock(&m_lock))
+        return false;
+
+    uint64_t start = get_ns();
+
+    m_optPassManager->run(*tb->llvm_function);
+
+    tcg_llvm_mem_stats.ir_bytes -= tb->llvm_ir_bytes;
+    tb->llvm_ir_bytes = irBytes(tb->llvm_function);
+    tcg_llvm_mem_stats.ir_bytes += tb->llvm_ir_bytes;
+
+    /* The JIT overwrites the start of the old code with a jump to the new
+     * code, so a pointer to the old code that is still around stays valid.
+     * The old code is never freed, so it stays in code_bytes and counts
+     * against llvm_mem_limit, although collections can't reclaim it. */
+    tcg_llvm_mem_stats.orphaned_bytes += tb->llvm_tc_end - tb->llvm_tc_ptr;
+    uint8_t *tc_ptr = (uint8_t*)
+            m_executionEngine->recompileAndRelinkFunction(tb->llvm_function);
+    tb->llvm_tc_end = tc_ptr + m_jitMemoryManager->getLastFunctionSize();
+    tb->llvm_tc_ptr = tc_ptr;
+    tcg_llvm_mem_stats.code_bytes += tb->llvm_tc_end - tb->llvm_tc_ptr;
+    tb->llvm_tier = 1;
+
+    tcg_llvm_tier_stats.tbs[1]++;
+    tcg_llvm_tier_stats.compile_ns[1] += get_ns() - start;
+    tcg_llvm_tier_stats.hot_execs += tb->llvm_exec_count;
+    tcg_llvm_tier_stats.hot_exec_ns += tb->llvm_exec_ns;
+
+    if(qemu_loglevel_mask(CPU_LOG_LLVM_IR)) {
+        std::string fcnString;
+        llvm::raw_string_ostream s(fcnString);
+        s << *tb->llvm_function;
+        qemu_log("OUT (LLVM IR, optimized):\n");
+        qemu_log("%s", s.str().c_str());
+        qemu_log("\n");
+        qemu_log_flush();
+    }
+
+    pthread_mutex_unlock(&m_lock);
+    return true;
+}
+
+void TCGLLVMContextPrivate::freeCode(TranslationBlock *tb)
+{
+    /* Waits for the compile thread to finish with the TB it is working on,
+     * which may be this one */
+    pthread_mutex_lock(&m_lock);
+    if(!tb->llvm_tc_ptr) {
+        std::deque<TranslationBlock*>::iterator it =
+            std::find(m_compileQueue.begin(), m_compileQueue.end(), tb);
+        if(it != m_compileQueue.end())
+            m_compileQueue.erase(it);
+    } else {
+        m_executionEngine->freeMachineCodeForFunction(tb->llvm_function);
+        tcg_llvm_mem_stats.code_bytes -= tb->llvm_tc_end - tb->llvm_tc_ptr;
+    }
+    tb->llvm_function->eraseFromParent();
+    m_liveTBs.erase(tb);
+    tcg_llvm_mem_stats.functions--;
+    tcg_llvm_mem_stats.ir_bytes -= tb->llvm_ir_bytes;
+    pthread_mutex_unlock(&m_lock);
+}
+
+TCGLLVMTrace* TCGLLVMContextPrivate::formTrace(TranslationBlock *head)
+{
+    TranslationBlock *tbs[TCG_LLVM_TRACE_MAX_TBS];
+    unsigned ntbs = 0;
+
+    /* Follow the successors that keep coming back, stopping at a loop or
+     * at a TB that has no code yet */
+    for(TranslationBlock *tb = head; tb && ntbs < TCG_LLVM_TRACE_MAX_TBS;
+            tb = tb->llvm_succ) {
+        if(!tb->llvm_tc_ptr || std::find(tbs, tbs + ntbs, tb) != tbs + ntbs)
+            break;
+        tbs[ntbs++] = tb;
+        if(tb->llvm_succ_count < llvm_trace_threshold / 2)
+            break;
+    }
+    if(ntbs < 2)
+        return NULL;
+
+    if(pthread_mutex_trylock(&m_lock))
+        return NULL;
+
+    uint64_t start = get_ns();
+
+    TCGLLVMTrace *trace = new TCGLLVMTrace;
+    memset(trace, 0, sizeof(*trace));
+    trace->ntbs = ntbs;
+    std::copy(tbs, tbs + ntbs, trace->tbs);
+
+    std::ostringstream fName;
+    fName << "tcg-llvm-trace-" << (m_traceCount++) << "-" << std::hex
+          << head->pc;
+
+    /* The TBs' code is called through its address rather than its
+     * Function, so freeing a TB doesn't have to look for traces using it,
+     * and the TBs run exactly as they do on their own: last_pc and
+     * last_opc_index are kept per guest instruction, and the dynamic value
+     * logs of plugins line up with each TB's IR. */
+    FunctionType *tbFunctionType = FunctionType::get(
+            wordType(),
+            std::vector<Type*>(1, intPtrType(64)), false);
+    FunctionType *boundaryType = FunctionType::get(
+            wordType(), std::vector<Type*>(3, wordType()), false);
+    Value *boundary = ConstantExpr::getIntToPtr(
+            ConstantInt::get(wordType(), (uint64_t) &cpu_llvm_trace_boundary),
+            PointerType::getUnqual(boundaryType));
+
+    Function *f = Function::Create(tbFunctionType,
+            Function::PrivateLinkage, fName.str(), m_module);
+    Value *envArg = f->arg_begin();
+    m_builder.SetInsertPoint(BasicBlock::Create(m_context, "tb0", f));
+
+    for(unsigned i = 0; ; ++i) {
+        Value *tbCode = ConstantExpr::getIntToPtr(
+                ConstantInt::get(wordType(), (uint64_t) tbs[i]->llvm_tc_ptr),
+                PointerType::getUnqual(tbFunctionType));
+        Value *ret = m_builder.CreateCall(tbCode, envArg);
+        if(i == ntbs - 1) {
+            m_builder.CreateRet(ret);
+            break;
+        }
+
+        /* Side exit unless cpu_exec would run the next TB anyway */
+        Value *cont = m_builder.CreateCall3(boundary,
+                ConstantInt::get(wordType(), (uint64_t) trace),
+                ConstantInt::get(wordType(), i), ret);
+        std::ostringstream bbName;
+        bbName << "tb" << (i + 1);
+        BasicBlock *exitBB = BasicBlock::Create(m_context, "exit", f);
+        BasicBlock *nextBB = BasicBlock::Create(m_context, bbName.str(), f);
+        m_builder.CreateCondBr(m_builder.CreateICmpNE(cont,
+                ConstantInt::get(wordType(), 0)), nextBB, exitBB);
+        m_builder.SetInsertPoint(exitBB);
+        m_builder.CreateRet(ret);
+        m_builder.SetInsertPoint(nextBB);
+    }
+
+#ifndef NDEBUG
+    verifyFunction(*f);
+#endif
+
+    /* Not run through m_functionPassManager: plugin passes instrument
+     * guest code, which the TBs already are */
+    trace->function = f;
+    trace->tc_ptr = (uint8_t*) m_executionEngine->getPointerToFunction(f);
+    trace->ir_bytes = irBytes(f);
+    trace->code_bytes = m_jitMemoryManager->getLastFunctionSize();
+    tcg_llvm_mem_stats.functions++;
+    tcg_llvm_mem_stats.ir_bytes += trace->ir_bytes;
+    tcg_llvm_mem_stats.code_bytes += trace->code_bytes;
+
+    tcg_llvm_trace_stats.traces++;
+    tcg_llvm_trace_stats.trace_tbs += ntbs;
+    tcg_llvm_trace_stats.compile_ns += get_ns() - start;
+
+    if(qemu_loglevel_mask(CPU_LOG_LLVM_IR)) {
+        std::string fcnString;
+        llvm::raw_string_ostream s(fcnString);
+        s << *f;
+        qemu_log("OUT (LLVM IR, trace):\n");
+        qemu_log("%s", s.str().c_str());
+        qemu_log("\n");
+        qemu_log_flush();
+    }
+
+    pthread_mutex_unlock(&m_lock);
+    return trace;
+}
+
+void TCGLLVMContextPrivate::freeTrace(TCGLLVMTrace *trace)
+{
+    pthread_mutex_lock(&m_lock);
+    m_executionEngine->freeMachineCodeForFunction((Function*) trace->function);
+    ((Function*) trace->function)->eraseFromParent();
+    tcg_llvm_mem_stats.functions--;
+    tcg_llvm_mem_stats.ir_bytes -= trace->ir_bytes;
+    tcg_llvm_mem_stats.code_bytes -= trace->code_bytes;
+    pthread_mutex_unlock(&m_lock);
+    delete trace;
+}
+
+static bool lastUsedBefore(TranslationBlock *a, TranslationBlock *b)
+{
+    return a->llvm_last_use < b->llvm_last_use;
+}
+
+/* How much of llvm_mem_limit the live functions may use: what the orphaned
+ * code leaves, but at least half, so that collections don't end up freeing
+ * every TB once orphaned code fills the limit */
+static uint64_t tcg_llvm_live_limit(void)
+{
+    uint64_t orphaned = tcg_llvm_mem_stats.orphaned_bytes;
+    if(orphaned > llvm_mem_limit / 2)
+        return llvm_mem_limit / 2;
+    return llvm_mem_limit - orphaned;
+}
+
+void TCGLLVMContextPrivate::collectCode(TranslationBlock *keep)
+{
+    TCGLLVMMemStats *st = &tcg_llvm_mem_stats;
+    uint64_t before = st->ir_bytes + st->code_bytes;
+    uint64_t used = before - st->orphaned_bytes;
+    uint64_t target = tcg_llvm_live_limit() / 4 * 3;
+
+    /* m_liveTBs only changes on this thread, so no lock is needed to
+     * read it */
+    std::vector<TranslationBlock*> tbs(m_liveTBs.begin(), m_liveTBs.end());
+    std::sort(tbs.begin(), tbs.end(), lastUsedBefore);
+
+    std::set<TranslationBlock*> victims;
+    for(size_t i = 0; i < tbs.size() && used > target; ++i) {
+        TranslationBlock *tb = tbs[i];
+        if(tb == keep)
+            continue;
+        victims.insert(tb);
+        used -= tb->llvm_ir_bytes;
+        if(tb->llvm_tc_ptr)
+            used -= tb->llvm_tc_end - tb->llvm_tc_ptr;
+    }
+    if(victims.empty())
+        return;
+
+    /* Traces call their TBs' code, so the ones using a victim go first */
+    for(size_t i = 0; i < tbs.size(); ++i) {
+        TCGLLVMTrace *trace = tbs[i]->llvm_trace;
+        if(!trace || victims.count(tbs[i]))
+            continue;
+        for(unsigned j = 1; j < trace->ntbs; ++j) {
+            if(victims.count(trace->tbs[j])) {
+                freeTrace(trace);
+                tbs[i]->llvm_trace = NULL;
+                break;
+            }
+        }
+    }
+
+    for(std::set<TranslationBlock*>::iterator it = victims.begin();
+            it != victims.end(); ++it) {
+        tcg_llvm_free_tb_code(*it);
+    }
+
+    st->collections++;
+    st->collected_tbs += victims.size();
+    st->collected_bytes += before - (st->ir_bytes + st->code_bytes);
+}
+
+/* Drops the traces running through TBs in [begin, end), which are about
+ * to be reused for other code, and the profiled successors pointing at
+ * them, so that no trace is formed through them */
+void TCGLLVMContextPrivate::forgetTBs(TranslationBlock *begin,
+                                      TranslationBlock *end)
+{
+    for(std::set<TranslationBlock*>::iterator it = m_liveTBs.begin();
+            it != m_liveTBs.end(); ++it) {
+        TranslationBlock *tb = *it;
+        if(tb->llvm_succ >= begin && tb->llvm_succ < end) {
+            tb->llvm_succ = NULL;
+            tb->llvm_succ_count = 0;
+        }
+        /* Traces starting in the range go with their TB */
+        TCGLLVMTrace *trace = tb->llvm_trace;
+        if(!trace || (tb >= begin && tb < end))
+            continue;
+        for(unsigned j = 1; j < trace->ntbs; ++j) {
+            if(trace->tbs[j] >= begin && trace->tbs[j] < end) {
+                freeTrace(trace);
+                tb->llvm_trace = NULL;
+                break;
+            }
+        }
+    }
+}
+
+static void *tcg_llvm_compile_thread(void *opaque)
+{
+    ((TCGLLVMContextPrivate*) opaque)->compileThread();
+    return NULL;
+}
+
+void TCGLLVMContextPrivate::startCompileThread()
+{
+    if(m_compileThreadStarted)
+        return;
+    m_stopCompileThread = false;
+    if(pthread_create(&m_compileThread, NULL, tcg_llvm_compile_thread, this)) {
+        std::cerr << "Unable to start LLVM compile thread" << std::endl;
+        exit(1);
+    }
+    m_compileThreadStarted = true;
+}
+
+void TCGLLVMContextPrivate::compileThread()
+{
+    /* Leave QEMU's signals (timers, I/O) to the other threads */
+    sigset_t set;
+    sigfillset(&set);
+    pthread_sigmask(SIG_BLOCK, &set, NULL);
+
+    pthread_mutex_lock(&m_lock);
+    for(;;) {
+        while(!m_stopCompileThread && m_compileQueue.empty())
+            pthread_cond_wait(&m_compileCond, &m_lock);
+        if(m_stopCompileThread)
+            break;
+
+        TranslationBlock *tb = m_compileQueue.front();
+        m_compileQueue.pop_front();
+
+        uint64_t start = get_ns();
+        uint8_t *tc_ptr = (uint8_t*)
+                m_executionEngine->getPointerToFunction(tb->llvm_function);
+        tb->llvm_tc_end = tc_ptr + m_jitMemoryManager->getLastFunctionSize();
+        /* The vCPU thread checks llvm_tc_ptr without the lock, so it has to
+         * be set last */
+        __sync_synchronize();
+        tb->llvm_tc_ptr = tc_ptr;
+        tcg_llvm_tier_stats.compile_ns[0] += get_ns() - start;
+        tcg_llvm_mem_stats.code_bytes += tb->llvm_tc_end - tc_ptr;
+
+        if(m_compileQueue.empty())
+            pthread_cond_broadcast(&m_idleCond);
+    }
+    pthread_mutex_unlock(&m_lock);
+}
+
+void TCGLLVMContextPrivate::waitForCompiles()
+{
+    pthread_mutex_lock(&m_lock);
+    while(!m_compileQueue.empty())
+        pthread_cond_wait(&m_idleCond, &m_lock);
+    pthread_mutex_unlock(&m_lock);
 }
 
 /***********************************/
@@ -1454,13 +1944,55 @@ ExecutionEngine* TCGLLVMContext::getExecutionEngine()
     return m_private->m_executionEngine;
 }
 
-void TCGLLVMContext::generateCode(TCGContext *s, TranslationBlock *tb)
+bool TCGLLVMContext::generateCode(TCGContext *s, TranslationBlock *tb)
 {
     assert(tb->tcg_llvm_context == NULL);
     assert(tb->llvm_function == NULL);
 
+    if(!m_private->generateCode(s, tb))
+        return false;
     tb->tcg_llvm_context = this;
-    m_private->generateCode(s, tb);
+    return true;
+}
+
+bool TCGLLVMContext::optimizeCode(TranslationBlock *tb)
+{
+    assert(tb->tcg_llvm_context == this);
+    assert(tb->llvm_function && tb->llvm_tc_ptr);
+
+    return m_private->optimizeCode(tb);
+}
+
+void TCGLLVMContext::freeCode(TranslationBlock *tb)
+{
+    m_private->freeCode(tb);
+}
+
+void TCGLLVMContext::waitForCompiles()
+{
+    m_private->waitForCompiles();
+}
+
+TCGLLVMTrace* TCGLLVMContext::formTrace(TranslationBlock *head)
+{
+    assert(head->tcg_llvm_context == this && !head->llvm_trace);
+    return m_private->formTrace(head);
+}
+
+void TCGLLVMContext::freeTrace(TCGLLVMTrace *trace)
+{
+    m_private->freeTrace(trace);
+}
+
+void TCGLLVMContext::collectCode(TranslationBlock *keep)
+{
+    m_private->collectCode(keep);
+}
+
+void TCGLLVMContext::forgetTBs(TranslationBlock *begin,
+                               TranslationBlock *end)
+{
+    m_private->forgetTBs(begin, end);
 }
 
 void TCGLLVMContext::writeModule(char *path){
@@ -1496,26 +2028,65 @@ void tcg_llvm_destroy(){
     }
 }
 
-void tcg_llvm_gen_code(TCGLLVMContext *l, TCGContext *s, TranslationBlock *tb)
+int tcg_llvm_gen_code(TCGLLVMContext *l, TCGContext *s, TranslationBlock *tb)
+{
+    return l->generateCode(s, tb) ? 0 : -1;
+}
+
+void tcg_llvm_set_async(int on)
 {
-    l->generateCode(s, tb);
+    llvm_async_compile = on;
+    if(!on && tcg_llvm_ctx)
+        tcg_llvm_ctx->waitForCompiles();
 }
 
 void tcg_llvm_tb_alloc(TranslationBlock *tb)
 {
     tb->tcg_llvm_context = NULL;
     tb->llvm_function = NULL;
+    tb->llvm_succ = NULL;
+    tb->llvm_succ_count = 0;
+    tb->llvm_trace = NULL;
+}
+
+/* Frees the LLVM function and code of tb, and the trace it starts, leaving
+   tb as if it had never been lowered */
+static void tcg_llvm_free_tb_code(TranslationBlock *tb)
+{
+    panda_cb_list *plist;
+    for(plist = panda_cbs[PANDA_CB_BEFORE_LLVM_FREE]; plist != NULL;
+            plist = plist->next) {
+        plist->entry.before_llvm_free(cpu_single_env, tb);
+    }
+
+    if(tb->llvm_trace) {
+        tb->tcg_llvm_context->freeTrace(tb->llvm_trace);
+        tb->llvm_trace = NULL;
+    }
+    tb->tcg_llvm_context->freeCode(tb);
+    tb->tcg_llvm_context = NULL;
+    tb->llvm_function = NULL;
+    tb->llvm_tc_ptr = NULL;
+    tb->llvm_tc_end = NULL;
 }
 
 void tcg_llvm_tb_free(TranslationBlock *tb)
 {
     if(tb->llvm_function) {
-        tb->llvm_function->eraseFromParent();
-        tb->llvm_function = NULL;
-        tb->llvm_tc_ptr = NULL;
+        tcg_llvm_free_tb_code(tb);
     }
 }
 
+void tcg_llvm_tb_evict(TranslationBlock *begin, TranslationBlock *end)
+{
+    if(tcg_llvm_ctx)
+        tcg_llvm_ctx->forgetTBs(begin, end);
+    if(tcg_llvm_runtime.last_tb >= begin && tcg_llvm_runtime.last_tb < end)
+        tcg_llvm_runtime.last_tb = NULL;
+    for(TranslationBlock *tb = begin; tb < end; ++tb)
+        tcg_llvm_tb_free(tb);
+}
+
 int tcg_llvm_search_last_pc(TranslationBlock *tb, uintptr_t searched_pc)
 {
     assert(tb->llvm_function && tb == tcg_llvm_runtime.last_tb);
@@ -1537,15 +2108,168 @@ const char* tcg_llvm_get_func_name(TranslationBlock *tb)
 extern CPUState *env;
 #endif
 
+/* Notes that tb ran after prev (the last LLVM TB, if the one before tb
+   ran under LLVM) and returns the trace starting at tb, forming it if tb
+   has become hot enough */
+static TCGLLVMTrace *tcg_llvm_get_trace(TranslationBlock *prev,
+                                        TranslationBlock *tb)
+{
+    /* cpu_exec would have to call these callbacks for every TB */
+    if(panda_cbs[PANDA_CB_BEFORE_BLOCK_EXEC_INVALIDATE_OPT] ||
+       panda_cbs[PANDA_CB_BEFORE_BLOCK_EXEC_LLVM_OPT])
+        return NULL;
+
+    if(prev) {
+        if(prev->llvm_succ == tb) {
+            prev->llvm_succ_count++;
+        } else {
+            prev->llvm_succ = tb;
+            prev->llvm_succ_count = 1;
+        }
+    }
+
+    if(!tb->llvm_trace && tb->llvm_succ_count >= llvm_trace_threshold) {
+        tb->llvm_trace = tb->tcg_llvm_context->formTrace(tb);
+        /* Profile it again before trying another time */
+        if(!tb->llvm_trace)
+            tb->llvm_succ_count = 0;
+    }
+    return tb->llvm_trace;
+}
+
+static uintptr_t tcg_llvm_trace_exec(TranslationBlock *tb)
+{
+    TCGLLVMTrace *trace = tb->llvm_trace;
+    TCGLLVMTraceStats *st = &tcg_llvm_trace_stats;
+
+    /* Counted before running it, since the TBs may longjmp out */
+    trace->execs++;
+    st->execs++;
+
+    uintptr_t next_tb = ((uintptr_t (*)(void*)) trace->tc_ptr)(&env);
+
+    /* cpu_llvm_trace_boundary moves last_tb along the trace */
+    unsigned ran = std::find(trace->tbs, trace->tbs + trace->ntbs,
+                             tcg_llvm_runtime.last_tb) - trace->tbs + 1;
+    st->tbs_run += ran;
+    if(llvm_mem_limit) {
+        for(unsigned i = 1; i < ran; ++i)
+            trace->tbs[i]->llvm_last_use = tcg_llvm_use_clock;
+    }
+    if(ran < trace->ntbs) {
+        trace->early_exits++;
+        st->early_exits++;
+        /* The path has changed; look for a new one */
+        if(trace->execs >= 64 && trace->early_exits * 2 > trace->execs) {
+            tb->tcg_llvm_context->freeTrace(trace);
+            tb->llvm_trace = NULL;
+            tb->llvm_succ_count = 0;
+            st->dropped++;
+        }
+    }
+    return next_tb;
+}
+
 uintptr_t tcg_llvm_qemu_tb_exec(void *env1, TranslationBlock *tb)
 {
+    TranslationBlock *prev = tcg_llvm_runtime.last_tb;
     tcg_llvm_runtime.last_tb = tb;
     env = (CPUState*)env1;
     uintptr_t next_tb;
+
+    /* Between blocks, so no LLVM code is running that could be freed */
+    if(llvm_mem_limit) {
+        tb->llvm_last_use = ++tcg_llvm_use_clock;
+        if(tcg_llvm_mem_stats.ir_bytes + tcg_llvm_mem_stats.code_bytes -
+                tcg_llvm_mem_stats.orphaned_bytes > tcg_llvm_live_limit())
+            tb->tcg_llvm_context->collectCode(tb);
+    }
+
+    if(llvm_trace_threshold && tcg_llvm_get_trace(prev, tb)) {
+        return tcg_llvm_trace_exec(tb);
+    }
+
+    if(!llvm_opt_threshold) {
+        next_tb = ((uintptr_t (*)(void*)) tb->llvm_tc_ptr)(&env);
+        return next_tb;
+    }
+
+    if(tb->llvm_tier == 0 && tb->llvm_exec_count >= llvm_opt_threshold) {
+        tb->tcg_llvm_context->optimizeCode(tb);
+    }
+
+    /* Counted before running it, since the TB may longjmp out */
+    int tier = tb->llvm_tier;
+    tb->llvm_exec_count++;
+    tcg_llvm_tier_stats.execs[tier]++;
+
+    uint64_t start = get_ns();
     next_tb = ((uintptr_t (*)(void*)) tb->llvm_tc_ptr)(&env);
+    uint64_t ns = get_ns() - start;
+
+    tb->llvm_exec_ns += ns;
+    tcg_llvm_tier_stats.exec_ns[tier] += ns;
     return next_tb;
 }
 
+void tcg_llvm_dump_tier_stats(FILE *f,
+                              int (*cpu_fprintf)(FILE *f, const char *fmt, ...))
+{
+    TCGLLVMTierStats *st = &tcg_llvm_tier_stats;
+    for(int i = 0; i < 2; ++i) {
+        cpu_fprintf(f, "LLVM tier %d TBs      %llu (%.1f ms compiling)\n",
+                    i, (unsigned long long) st->tbs[i],
+                    st->compile_ns[i] / 1e6);
+    }
+    for(int i = 0; i < 2; ++i) {
+        cpu_fprintf(f, "LLVM tier %d execs    %llu (%.0f ns avg)\n",
+                    i, (unsigned long long) st->execs[i],
+                    st->execs[i] ? (double) st->exec_ns[i] / st->execs[i] : 0.0);
+    }
+    if(st->hot_execs && st->execs[1] && st->exec_ns[1]) {
+        /* Same TBs before and after reoptimization */
+        cpu_fprintf(f, "LLVM tier 1 speedup  %.2fx\n",
+                    ((double) st->hot_exec_ns / st->hot_execs) /
+                    ((double) st->exec_ns[1] / st->execs[1]));
+    }
+}
+
+void tcg_llvm_dump_trace_stats(FILE *f,
+                               int (*cpu_fprintf)(FILE *f, const char *fmt, ...))
+{
+    TCGLLVMTraceStats *st = &tcg_llvm_trace_stats;
+    cpu_fprintf(f, "LLVM traces          %llu (%.1f TBs avg, %.1f ms compiling)\n",
+                (unsigned long long) st->traces,
+                st->traces ? (double) st->trace_tbs / st->traces : 0.0,
+                st->compile_ns / 1e6);
+    cpu_fprintf(f, "LLVM trace execs     %llu (%.1f TBs avg)\n",
+                (unsigned long long) st->execs,
+                st->execs ? (double) st->tbs_run / st->execs : 0.0);
+    cpu_fprintf(f, "LLVM trace exits     %llu early, %llu traces dropped\n",
+                (unsigned long long) st->early_exits,
+                (unsigned long long) st->dropped);
+}
+
+void tcg_llvm_dump_mem_stats(FILE *f,
+                             int (*cpu_fprintf)(FILE *f, const char *fmt, ...))
+{
+    TCGLLVMMemStats *st = &tcg_llvm_mem_stats;
+    cpu_fprintf(f, "LLVM functions       %llu (%llu KB IR, %llu KB code)\n",
+                (unsigned long long) st->functions,
+                (unsigned long long) st->ir_bytes >> 10,
+                (unsigned long long) st->code_bytes >> 10);
+    if(st->orphaned_bytes) {
+        cpu_fprintf(f, "LLVM orphaned code   %llu KB (replaced by tier 1)\n",
+                    (unsigned long long) st->orphaned_bytes >> 10);
+    }
+    if(llvm_mem_limit) {
+        cpu_fprintf(f, "LLVM collections     %llu (%llu TBs, %llu KB)\n",
+                    (unsigned long long) st->collections,
+                    (unsigned long long) st->collected_tbs,
+                    (unsigned long long) st->collected_bytes >> 10);
+    }
+}
+
 void tcg_llvm_write_module(TCGLLVMContext *l, char *path){
     l->writeModule(path);
 }
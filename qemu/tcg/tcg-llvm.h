@@ -38,6 +38,7 @@
 #define TCG_LLVM_H
 
 #include <inttypes.h>
+#include <stdio.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -67,14 +68,111 @@ struct TCGLLVMRuntime {
 
 extern struct TCGLLVMRuntime tcg_llvm_runtime;
 
+/* Tiered optimization. TBs are first compiled without any optimization
+   passes; once an LLVM TB has run llvm_opt_threshold times it is optimized
+   and compiled again (0, the default, turns this off). */
+extern uint64_t llvm_opt_threshold;
+
+struct TCGLLVMTierStats {
+    uint64_t tbs[2];            /* TBs compiled at each tier */
+    uint64_t compile_ns[2];     /* and the time spent compiling them */
+    uint64_t execs[2];          /* executions at each tier, and their time, */
+    uint64_t exec_ns[2];        /* only counted while tiering is on */
+    uint64_t hot_execs;         /* tier 0 executions of TBs that later */
+    uint64_t hot_exec_ns;       /* reached tier 1, and their time */
+};
+
+extern struct TCGLLVMTierStats tcg_llvm_tier_stats;
+
+void tcg_llvm_dump_tier_stats(FILE *f,
+                              int (*cpu_fprintf)(FILE *f, const char *fmt, ...));
+
+/* Background compilation. With llvm_async_compile set, tcg_llvm_gen_code
+   only builds the IR (and runs the function passes) and the JIT compiles it
+   on another thread; llvm_tc_ptr is NULL until then, and the TB runs under
+   TCG. tcg_llvm_gen_code returns -1, leaving the TB alone, if that thread
+   is busy. tcg_llvm_set_async(0) goes back to compiling synchronously and
+   waits for the compiles already queued. */
+extern int llvm_async_compile;
+void tcg_llvm_set_async(int on);
+
+/* Traces. With llvm_trace_threshold set, an LLVM TB that has been
+   followed by the same TB that many times in a row starts a trace: one
+   function calling the code of up to TCG_LLVM_TRACE_MAX_TBS TBs that
+   usually run one after the other. Between two of them the trace calls
+   cpu_llvm_trace_boundary (cpu-exec.c), which does what the cpu_exec loop
+   would have done, callbacks included, and leaves the trace whenever the
+   loop would not simply have run the next TB. */
+#define TCG_LLVM_TRACE_MAX_TBS 16
+
+struct TCGLLVMTrace {
+    void *function;             /* the trace's llvm::Function */
+    uint8_t *tc_ptr;
+    unsigned ntbs;
+    struct TranslationBlock *tbs[TCG_LLVM_TRACE_MAX_TBS];
+    uint64_t execs;
+    uint64_t early_exits;       /* executions that stopped before the end */
+    uint32_t ir_bytes;
+    uint32_t code_bytes;
+};
+
+extern uint64_t llvm_trace_threshold;
+
+struct TCGLLVMTraceStats {
+    uint64_t traces;            /* traces formed */
+    uint64_t trace_tbs;         /* and the TBs in them */
+    uint64_t compile_ns;
+    uint64_t dropped;           /* traces freed for exiting early too often */
+    uint64_t execs;             /* trace executions */
+    uint64_t tbs_run;           /* TBs they ran */
+    uint64_t early_exits;
+};
+
+extern struct TCGLLVMTraceStats tcg_llvm_trace_stats;
+
+void tcg_llvm_dump_trace_stats(FILE *f,
+                               int (*cpu_fprintf)(FILE *f, const char *fmt, ...));
+
+uintptr_t cpu_llvm_trace_boundary(struct TCGLLVMTrace *trace, uintptr_t i,
+                                  uintptr_t next_tb);
+
+/* Memory used by the LLVM module and the JIT. IR is only freed along with
+   its TB, so with llvm_mem_limit (bytes) set, once the IR and code of the
+   live functions grow past it, the LLVM code of the TBs that have gone
+   longest without running under LLVM is freed, down to three quarters of
+   the limit. Those TBs keep their TCG code, and are lowered again if they
+   run under LLVM again. IR sizes are estimates. Code orphaned by tiering
+   can't be freed but counts against the limit; the live functions are
+   still allowed at least half of it. */
+extern uint64_t llvm_mem_limit;
+
+struct TCGLLVMMemStats {
+    uint64_t functions;         /* live TB and trace functions */
+    uint64_t ir_bytes;          /* the size of their IR */
+    uint64_t code_bytes;        /* and of their JIT code, orphaned included */
+    uint64_t orphaned_bytes;    /* first tier code left behind by optimizing
+                                   a TB, which the JIT never frees */
+    uint64_t collections;
+    uint64_t collected_tbs;
+    uint64_t collected_bytes;
+};
+
+extern struct TCGLLVMMemStats tcg_llvm_mem_stats;
+
+void tcg_llvm_dump_mem_stats(FILE *f,
+                             int (*cpu_fprintf)(FILE *f, const char *fmt, ...));
+
 struct TCGLLVMContext* tcg_llvm_initialize(void);
 void tcg_llvm_destroy(void);
 
 void tcg_llvm_tb_alloc(struct TranslationBlock *tb);
 void tcg_llvm_tb_free(struct TranslationBlock *tb);
+/* frees the LLVM code of TBs in [begin, end) whose slots are reused */
+void tcg_llvm_tb_evict(struct TranslationBlock *begin,
+                       struct TranslationBlock *end);
 
-void tcg_llvm_gen_code(struct TCGLLVMContext *l, struct TCGContext *s,
-                       struct TranslationBlock *tb);
+int tcg_llvm_gen_code(struct TCGLLVMContext *l, struct TCGContext *s,
+                      struct TranslationBlock *tb);
 const char* tcg_llvm_get_func_name(struct TranslationBlock *tb);
 
 uintptr_t tcg_llvm_qemu_tb_exec(void *env, TranslationBlock *tb);
@@ -121,8 +219,18 @@ public:
     void deleteExecutionEngine();
     llvm::FunctionPassManager* getFunctionPassManager() const;
 
-    void generateCode(struct TCGContext *s,
+    bool generateCode(struct TCGContext *s,
                       struct TranslationBlock *tb);
+    bool optimizeCode(struct TranslationBlock *tb);
+    void freeCode(struct TranslationBlock *tb);
+    void waitForCompiles();
+
+    struct TCGLLVMTrace* formTrace(struct TranslationBlock *head);
+    void freeTrace(struct TCGLLVMTrace *trace);
+
+    void collectCode(struct TranslationBlock *keep);
+    void forgetTBs(struct TranslationBlock *begin,
+                   struct TranslationBlock *end);
 
     void writeModule(char *path);
 };
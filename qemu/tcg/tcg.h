@@ -588,6 +588,25 @@ void tcg_gen_shifti_i64(TCGv_i64 ret, TCGv_i64 arg1,
 TCGArg *tcg_optimize(TCGContext *s, uint16_t *tcg_opc_ptr, TCGArg *args,
                      TCGOpDef *tcg_op_def);
 
+/* 0: no optimization, 1: constant folding and copy propagation, 2: also
+   remove movs to globals that are overwritten before they are read. */
+extern int tcg_opt_level;
+
+typedef struct TCGOptStats {
+    int64_t runs;
+    int64_t ops_in;             /* ops before and after optimization */
+    int64_t ops_out;
+    int64_t folded;             /* ops computed into a movi */
+    int64_t conds;              /* brcond and setcond ops decided */
+    int64_t removed;            /* ops that did nothing */
+    int64_t copies;             /* inputs replaced by a better copy */
+    int64_t dead_stores;        /* movs to globals removed */
+} TCGOptStats;
+
+extern TCGOptStats tcg_opt_stats;
+
+void tcg_dump_opt_info(FILE *f, fprintf_function cpu_fprintf);
+
 /* only used for debugging purposes */
 void tcg_register_helper(void *func, const char *name);
 const char *tcg_helper_get_name(TCGContext *s, void *func);
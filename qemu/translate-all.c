@@ -60,6 +60,12 @@ target_ulong gen_opc_pc[OPC_BUF_SIZE];
 uint16_t gen_opc_icount[OPC_BUF_SIZE];
 uint8_t gen_opc_instr_start[OPC_BUF_SIZE];
 
+#if defined(CONFIG_LLVM)
+uint64_t llvm_tbs_translated;
+uint64_t llvm_tbs_lowered;
+uint64_t llvm_tbs_pending_execs;
+#endif
+
 void cpu_gen_init(void)
 {
     tcg_context_init(&tcg_ctx); 
@@ -111,8 +117,16 @@ int cpu_gen_code(CPUState *env, TranslationBlock *tb, int *gen_code_size_ptr)
     *gen_code_size_ptr = gen_code_size;
 
 #if defined(CONFIG_LLVM)
-    if(generate_llvm)
-        tcg_llvm_gen_code(tcg_llvm_ctx, s, tb);
+    /* The LLVM function is normally generated by cpu_gen_llvm the first
+       time it is needed. Only generate it up front when the LLVM output is
+       being logged, so the log still covers every TB. */
+    if(generate_llvm) {
+        llvm_tbs_translated++;
+        if(qemu_loglevel_mask(CPU_LOG_LLVM_IR | CPU_LOG_LLVM_ASM)) {
+            tcg_llvm_gen_code(tcg_llvm_ctx, s, tb);
+            llvm_tbs_lowered++;
+        }
+    }
 #endif
 
 #ifdef CONFIG_PROFILER
@@ -145,6 +159,33 @@ int cpu_gen_code(CPUState *env, TranslationBlock *tb, int *gen_code_size_ptr)
     return 0;
 }
 
+#if defined(CONFIG_LLVM)
+/* Generate the LLVM function for a TB that was translated without one.
+   The TCG ops are not kept around, so the guest code is translated again
+   the same way cpu_restore_state does it, which also limits the TB to the
+   instructions it had the first time during replay. */
+int cpu_gen_llvm(CPUState *env, TranslationBlock *tb)
+{
+    TCGContext *s = &tcg_ctx;
+
+    if (tb->llvm_function)
+        return 0;
+    if (!tcg_llvm_ctx)
+        return -1;
+
+    tcg_func_start(s);
+    gen_intermediate_code_pc(env, tb);
+#ifdef USE_TCG_OPTIMIZATIONS
+    gen_opparam_ptr =
+        tcg_optimize(s, gen_opc_ptr, gen_opparam_buf, tcg_op_defs);
+#endif
+    if (tcg_llvm_gen_code(tcg_llvm_ctx, s, tb) < 0)
+        return -1;
+    llvm_tbs_lowered++;
+    return 0;
+}
+#endif
+
 /* The cpu state corresponding to 'searched_pc' is restored.
  */
 int cpu_restore_state(TranslationBlock *tb,
@@ -179,7 +220,7 @@ int cpu_restore_state(TranslationBlock *tb,
     }
 
 #if defined(CONFIG_LLVM)
-    if(execute_llvm) {
+    if(execute_llvm && tb == tcg_llvm_runtime.last_tb) {
         assert(tb->llvm_function != NULL);
         j = tcg_llvm_search_last_pc(tb, searched_pc);
     } else {
@@ -203,6 +203,16 @@ extern void panda_unload_plugins(void);
 
 struct TCGLLVMContext* tcg_llvm_initialize(void);
 void tcg_llvm_destroy(void);
+extern uint64_t llvm_opt_threshold;
+extern int llvm_async_compile;
+extern uint64_t llvm_trace_threshold;
+extern uint64_t llvm_mem_limit;
+extern uint64_t llvm_inline_threshold;
+void tcg_llvm_dump_tier_stats(FILE *f, fprintf_function cpu_fprintf);
+void tcg_llvm_dump_trace_stats(FILE *f, fprintf_function cpu_fprintf);
+void tcg_llvm_dump_mem_stats(FILE *f, fprintf_function cpu_fprintf);
+void init_llvm_helpers(void);
+void dump_llvm_helper_inline_stats(FILE *f, fprintf_function cpu_fprintf);
 #endif
 
 #include "ui/qemu-spice.h"
@@ -249,6 +259,15 @@ int win2k_install_hack = 0;
 int rtc_td_hack = 0;
 int usb_enabled = 0;
 int singlestep = 0;
+extern int tcg_opt_level;
+void tcg_dump_opt_info(FILE *f, fprintf_function cpu_fprintf);
+static int tcg_opt_stats_at_exit = 0;
+extern int tb_regions;
+void tb_dump_cache_info(FILE *f, fprintf_function cpu_fprintf);
+static int tb_stats_at_exit = 0;
+extern int panda_vtlb_enabled;
+void panda_vtlb_dump_info(FILE *f, fprintf_function cpu_fprintf);
+static int panda_vtlb_stats_at_exit = 0;
 int smp_cpus = 1;
 int max_cpus = 0;
 int smp_cores = 1;
@@ -608,6 +627,18 @@ static void configure_rtc(QemuOpts *opts)
 #ifdef CONFIG_LLVM
 static void tcg_llvm_cleanup(void)
 {
+    if(llvm_opt_threshold) {
+        tcg_llvm_dump_tier_stats(stderr, fprintf);
+    }
+    if(llvm_trace_threshold) {
+        tcg_llvm_dump_trace_stats(stderr, fprintf);
+    }
+    if(llvm_mem_limit) {
+        tcg_llvm_dump_mem_stats(stderr, fprintf);
+    }
+    if(llvm_inline_threshold) {
+        dump_llvm_helper_inline_stats(stderr, fprintf);
+    }
     if(tcg_llvm_ctx) {
         tcg_llvm_destroy();
         tcg_llvm_ctx = NULL;
@@ -2719,6 +2750,25 @@ int main(int argc, char **argv, char **envp)
             case QEMU_OPTION_singlestep:
                 singlestep = 1;
                 break;
+            case QEMU_OPTION_tcg_opt_level:
+                tcg_opt_level = atoi(optarg);
+                tcg_opt_stats_at_exit = 1;
+                break;
+            case QEMU_OPTION_tb_regions:
+                tb_regions = atoi(optarg);
+                tb_stats_at_exit = 1;
+                break;
+            case QEMU_OPTION_panda_vtlb:
+                if (!strcmp(optarg, "on")) {
+                    panda_vtlb_enabled = 1;
+                } else if (!strcmp(optarg, "off")) {
+                    panda_vtlb_enabled = 0;
+                } else {
+                    fprintf(stderr, "-panda-vtlb: expected on or off\n");
+                    exit(1);
+                }
+                panda_vtlb_stats_at_exit = 1;
+                break;
             case QEMU_OPTION_S:
                 autostart = 0;
                 break;
@@ -3223,6 +3273,21 @@ int main(int argc, char **argv, char **envp)
 
                 generate_llvm = 1;
                 break;
+            case QEMU_OPTION_llvm_opt_threshold:
+                llvm_opt_threshold = strtoull(optarg, NULL, 0);
+                break;
+            case QEMU_OPTION_llvm_async:
+                llvm_async_compile = 1;
+                break;
+            case QEMU_OPTION_llvm_trace_threshold:
+                llvm_trace_threshold = strtoull(optarg, NULL, 0);
+                break;
+            case QEMU_OPTION_llvm_mem_limit:
+                llvm_mem_limit = strtoull(optarg, NULL, 0) << 20;
+                break;
+            case QEMU_OPTION_llvm_inline_helpers:
+                llvm_inline_threshold = strtoull(optarg, NULL, 0);
+                break;
 #endif
             case QEMU_OPTION_panda_arg:
                 if(!panda_add_arg(optarg, strlen(optarg))) {
@@ -3290,6 +3355,9 @@ int main(int argc, char **argv, char **envp)
         if (tcg_llvm_ctx == NULL){
             tcg_llvm_ctx = tcg_llvm_initialize();
         }
+        if (llvm_inline_threshold){
+            init_llvm_helpers();
+        }
     }
 #endif
 
@@ -3725,6 +3793,16 @@ int main(int argc, char **argv, char **envp)
     net_cleanup();
     res_free();
 
+    if (tcg_opt_stats_at_exit) {
+        tcg_dump_opt_info(stderr, fprintf);
+    }
+    if (tb_stats_at_exit) {
+        tb_dump_cache_info(stderr, fprintf);
+    }
+    if (panda_vtlb_stats_at_exit) {
+        panda_vtlb_dump_info(stderr, fprintf);
+    }
+
 #ifdef CONFIG_LLVM
     if (generate_llvm || execute_llvm){
         tcg_llvm_cleanup();
@@ -0,0 +1,38 @@
+#!/usr/bin/env python
+
+# Compare LLVM tiered optimization thresholds with -llvm-opt-threshold; the
+# command line should use -llvm. Reports TBs and compile time per tier,
+# and how much faster the hot TBs ran once optimized. See qemu_bench.py.
+#
+# usage: llvm_tier_bench.py "qemu-command-line" threshold...
+# e.g.   llvm_tier_bench.py "i386-softmmu/qemu-system-i386 -m 128 -llvm \
+#            -replay foo -display none" 100 1000 10000
+
+import re
+import qemu_bench
+
+REGEXES = {
+    "tbs": re.compile(r"LLVM tier (\d) TBs\s+(\d+) \(([\d.]+) ms compiling\)"),
+    "execs": re.compile(r"LLVM tier (\d) execs\s+(\d+) \(([\d.]+) ns avg\)"),
+    "speedup": re.compile(r"LLVM tier 1 speedup\s+([\d.]+)x"),
+}
+
+if __name__ == "__main__":
+    cmd, thresholds = qemu_bench.parse_args([])
+
+    print "%10s %9s %8s %11s %8s %11s %12s %8s" % ("threshold", "wall (s)",
+        "t0 TBs", "t0 compile", "t1 TBs", "t1 compile", "t1 execs", "speedup")
+    for t in thresholds:
+        r = qemu_bench.run(cmd, ["-llvm-opt-threshold", t], REGEXES)
+        tbs, compile_ms, execs = [0, 0], [0.0, 0.0], [0, 0]
+        for m in r["tbs"]:
+            tbs[int(m.group(1))] = int(m.group(2))
+            compile_ms[int(m.group(1))] = float(m.group(3))
+        for m in r["execs"]:
+            execs[int(m.group(1))] = int(m.group(2))
+        speedup = "-"
+        for m in r["speedup"]:
+            speedup = "%.2fx" % float(m.group(1))
+        print "%10d %9.2f %8d %9.1fms %8d %9.1fms %12d %8s" % (int(t),
+            r["wall"], tbs[0], compile_ms[0], tbs[1], compile_ms[1],
+            execs[1], speedup)
@@ -0,0 +1,47 @@
+#!/usr/bin/env python
+
+# Expand a sparse physical memory snapshot written by panda_memsavep_sparse
+# (memsnap with -panda-arg memsnap:sparse=1) into the flat image format
+# written by panda_memsavep. Pages not stored in the snapshot are zero, and
+# are left as holes in the output file.
+#
+# usage: memsavep_expand.py in.mem out.mem
+
+import struct
+import sys
+import zlib
+
+HEADER_FMT = "<8sIIQQ"
+EXTENT_FMT = "<QQQQ"
+
+def is_sparse(path):
+    f = open(path, "rb")
+    magic = f.read(8)
+    f.close()
+    return magic == b"PANDASPM"
+
+def expand(inpath, outpath):
+    f = open(inpath, "rb")
+    magic, version, page_size, ram_size, nextents = struct.unpack(
+        HEADER_FMT, f.read(struct.calcsize(HEADER_FMT)))
+    if magic != b"PANDASPM" or version != 1:
+        raise ValueError("%s is not a sparse PANDA memory snapshot" % inpath)
+
+    esize = struct.calcsize(EXTENT_FMT)
+    table = f.read(esize * nextents)
+    out = open(outpath, "wb")
+    for i in range(nextents):
+        addr, length, offset, stored_len = struct.unpack_from(EXTENT_FMT, table, i*esize)
+        f.seek(offset)
+        data = f.read(stored_len)
+        if stored_len != length:
+            data = zlib.decompress(data)
+        assert len(data) == length
+        out.seek(addr)
+        out.write(data)
+    out.truncate(ram_size)
+    out.close()
+    f.close()
+
+if __name__ == "__main__":
+    expand(sys.argv[1], sys.argv[2])
@@ -0,0 +1,44 @@
+#!/usr/bin/env python
+
+# Rebuild a full physical memory image from the output of memsnap in
+# incremental mode (-panda-arg memsnap:incremental=1).
+#
+# usage: memsnap_restore.py memsnap_index.txt memsnap.delta <snapshot #> <out.mem>
+
+import mmap
+import shutil
+import struct
+import sys
+
+import memsavep_expand
+
+index_file, delta_file, snap, outfile = sys.argv[1:5]
+snap = int(snap)
+
+entries = [line.split() for line in open(index_file)]
+base = entries[0]
+base_path, page_size = base[4], int(base[5])
+
+if memsavep_expand.is_sparse(base_path):
+    memsavep_expand.expand(base_path, outfile)
+else:
+    shutil.copyfile(base_path, outfile)
+if snap == 0:
+    sys.exit(0)
+
+out = open(outfile, 'r+b')
+outmap = mmap.mmap(out.fileno(), 0)
+delta = open(delta_file, 'rb')
+deltamap = mmap.mmap(delta.fileno(), 0, access=mmap.ACCESS_READ)
+
+rec_size = 8 + page_size
+for num, caller, pc, cr3, off, npages in entries[1:snap+1]:
+    off, npages = int(off), int(npages)
+    for i in xrange(npages):
+        rec = off + i*rec_size
+        addr, = struct.unpack_from("<Q", deltamap, rec)
+        outmap[addr:addr+page_size] = deltamap[rec+8:rec+rec_size]
+
+outmap.flush()
+outmap.close()
+out.close()
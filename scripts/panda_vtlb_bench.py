@@ -0,0 +1,32 @@
+#!/usr/bin/env python
+
+# Compare plugin guest memory reads with and without the software TLB that
+# panda_virtual_memory_rw and panda_virt_to_host use, via -panda-vtlb. Load
+# a plugin that reads guest memory often, e.g. syscalls, whose log_string
+# reads every string argument. With the cache off, every lookup is a miss,
+# i.e. a walk of the guest page tables. Repeat a mode to run it again.
+# See qemu_bench.py.
+#
+# usage: panda_vtlb_bench.py "qemu-command-line" [on|off...]
+# e.g.   panda_vtlb_bench.py "i386-softmmu/qemu-system-i386 -m 128 \
+#            -replay foo -display none -panda-plugin \
+#            i386-softmmu/panda_plugins/panda_syscalls.so" off on off on
+
+import re
+import qemu_bench
+
+REGEXES = {"vtlb": re.compile(r"PANDA vtlb (on|off)\s+(\d+) hits, (\d+) misses")}
+
+if __name__ == "__main__":
+    cmd, modes = qemu_bench.parse_args(["off", "on"])
+
+    print "%5s %9s %12s %12s %9s" % ("vtlb", "wall (s)", "lookups",
+        "page walks", "hit rate")
+    for mode in modes:
+        r = qemu_bench.run(cmd, ["-panda-vtlb", mode], REGEXES)
+        hits, misses = 0, 0
+        for m in r["vtlb"]:
+            hits, misses = int(m.group(2)), int(m.group(3))
+        lookups = hits + misses
+        print "%5s %9.2f %12d %12d %8.1f%%" % (mode, r["wall"], lookups,
+            misses, 100.0 * hits / lookups if lookups else 0)
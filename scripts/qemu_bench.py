@@ -0,0 +1,43 @@
+#!/usr/bin/env python
+
+# Shared runner for the *_bench.py scripts. Each one takes a QEMU command
+# line and a list of values for one QEMU option, runs the command once per
+# value with the option appended, and tabulates the wall clock time along
+# with the statistics QEMU prints when it exits. Give it a recorded
+# workload (-replay) so every run executes the same guest code.
+
+import shlex
+import subprocess
+import sys
+import time
+
+def run(cmd, extra_args, regexes):
+    """Run cmd (one string, shell quoted) with extra_args appended.
+
+    Returns a dict with the wall clock time under "wall" and, for each
+    name in regexes, the match objects of that regex over QEMU's output,
+    one per matching line."""
+    args = shlex.split(cmd) + [str(a) for a in extra_args]
+    start = time.time()
+    p = subprocess.Popen(args, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    out = p.communicate()[0]
+    wall = time.time() - start
+
+    res = {"wall": wall}
+    for name in regexes:
+        res[name] = []
+    for line in out.splitlines():
+        for name, regex in regexes.items():
+            m = regex.search(line)
+            if m:
+                res[name].append(m)
+    return res
+
+def parse_args(defaults):
+    """Returns the command line and the option values from sys.argv, or
+    defaults if no values were given."""
+    if len(sys.argv) < 2:
+        sys.stderr.write("usage: %s \"qemu-command-line\" [value...]\n"
+                         % sys.argv[0])
+        sys.exit(1)
+    return sys.argv[1], sys.argv[2:] or defaults
@@ -0,0 +1,32 @@
+#!/usr/bin/env python
+
+# Compare translated code buffer region counts with -tb-regions. Use a
+# small -tb-size so the buffer fills up. Reports flushes, region
+# evictions, and how much code was translated, and translated again after
+# being discarded. See qemu_bench.py.
+#
+# usage: tb_regions_bench.py "qemu-command-line" [regions...]
+# e.g.   tb_regions_bench.py "i386-softmmu/qemu-system-i386 -m 128 \
+#            -tb-size 16 -replay foo -display none" 1 4 8 16
+
+import re
+import qemu_bench
+
+REGEXES = {"stat": re.compile(r"^TB (flushes|region evictions|translations|"
+                              r"retranslations)\s+(\d+) \(([\d.]+)/s")}
+
+if __name__ == "__main__":
+    cmd, counts = qemu_bench.parse_args([1, 8])
+
+    print "%8s %9s %8s %10s %12s %12s %10s" % ("regions", "wall (s)",
+        "flushes", "evictions", "translations", "retranslated", "retrans/s")
+    for n in counts:
+        r = qemu_bench.run(cmd, ["-tb-regions", n], REGEXES)
+        stats = dict((m.group(1), (int(m.group(2)), float(m.group(3))))
+                     for m in r["stat"])
+        print "%8d %9.2f %8d %10d %12d %12d %10.1f" % (int(n), r["wall"],
+            stats.get("flushes", (0, 0))[0],
+            stats.get("region evictions", (0, 0))[0],
+            stats.get("translations", (0, 0))[0],
+            stats.get("retranslations", (0, 0))[0],
+            stats.get("retranslations", (0, 0.0))[1])
@@ -0,0 +1,35 @@
+#!/usr/bin/env python
+
+# Compare TCG optimizer levels with -tcg-opt-level, with or without -llvm.
+# Reports ops per translation before and after optimization, and what the
+# optimizer folded and removed. See qemu_bench.py.
+#
+# usage: tcg_opt_bench.py "qemu-command-line" [level...]
+# e.g.   tcg_opt_bench.py "i386-softmmu/qemu-system-i386 -m 128 \
+#            -replay foo -display none" 0 1 2
+
+import re
+import qemu_bench
+
+REGEXES = {
+    "ops": re.compile(r"ops/run\s+([\d.]+) -> ([\d.]+) \((\d+) runs\)"),
+    "stat": re.compile(r"^\s+(folded ops|folded conds|removed ops|"
+                       r"copies propagated|dead global movs)\s+(\d+)"),
+}
+
+if __name__ == "__main__":
+    cmd, levels = qemu_bench.parse_args([0, 1, 2])
+
+    print "%6s %9s %10s %8s %8s %8s %8s %10s" % ("level", "wall (s)",
+        "runs", "ops in", "ops out", "folded", "copies", "dead movs")
+    for l in levels:
+        r = qemu_bench.run(cmd, ["-tcg-opt-level", l], REGEXES)
+        ops_in, ops_out, runs = 0.0, 0.0, 0
+        for m in r["ops"]:
+            ops_in, ops_out, runs = (float(m.group(1)), float(m.group(2)),
+                                     int(m.group(3)))
+        stats = dict((m.group(1), int(m.group(2))) for m in r["stat"])
+        print "%6d %9.2f %10d %8.1f %8.1f %8d %8d %10d" % (int(l), r["wall"],
+            runs, ops_in, ops_out,
+            stats.get("folded ops", 0) + stats.get("folded conds", 0),
+            stats.get("copies propagated", 0), stats.get("dead global movs", 0))
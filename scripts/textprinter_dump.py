@@ -0,0 +1,73 @@
+#!/usr/bin/env python
+
+# Convert the binary output of the textprinter plugin back into its old
+# text format ("callers... caller pc cr3 addr counter byte", one line per
+# byte). Given a tap point, only the chunks for that tap are decompressed.
+#
+# usage: textprinter_dump.py write_tap_buffers [caller pc cr3]
+
+import struct
+import sys
+import zlib
+
+def read_varint(buf, pos):
+    shift = 0
+    val = 0
+    while True:
+        b = ord(buf[pos])
+        pos += 1
+        val |= (b & 0x7f) << shift
+        if b < 0x80: return val, pos
+        shift += 7
+
+def unzigzag(v):
+    return (v >> 1) ^ -(v & 1)
+
+base = sys.argv[1]
+want = None
+if len(sys.argv) > 2:
+    want = tuple(int(x, 16) for x in sys.argv[2:5])
+
+idx = open(base + ".idx", "rb")
+data = open(base + ".bin", "rb")
+
+ulong_size = struct.unpack("<I", idx.read(4))[0]
+ulong_fmt = "I" if ulong_size == 4 else "Q"
+ent_fmt = "<" + ulong_fmt*3 + "QIIQI"
+ent_size = struct.calcsize(ent_fmt)
+FMT = "%%0%dx" % (ulong_size*2)
+mask = (1 << (ulong_size*8)) - 1
+
+while True:
+    ent = idx.read(ent_size)
+    if len(ent) < ent_size: break
+    caller, pc, cr3, offset, zlen, rawlen, counter, nrecords = struct.unpack(ent_fmt, ent)
+    if want and (caller, pc, cr3) != want: continue
+
+    data.seek(offset)
+    raw = zlib.decompress(data.read(zlen))
+    assert len(raw) == rawlen
+
+    pos = 0
+    counter = 0
+    addr = 0
+    callers = []
+    for i in xrange(nrecords):
+        delta, pos = read_varint(raw, pos)
+        counter += delta
+        delta, pos = read_varint(raw, pos)
+        addr = (addr + unzigzag(delta)) & mask
+        n, pos = read_varint(raw, pos)
+        if n != 0:
+            callers = []
+            for j in xrange(n-1):
+                c, pos = read_varint(raw, pos)
+                callers.append(c)
+        size, pos = read_varint(raw, pos)
+        vals = raw[pos:pos+size]
+        pos += size
+
+        prefix = "".join((FMT + " ") % c for c in callers)
+        for j in xrange(size):
+            print (prefix + FMT + " " + FMT + " " + FMT + " " + FMT + " %d %02x") % (
+                caller, pc, cr3, addr+j, counter, ord(vals[j]))